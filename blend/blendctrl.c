@@ -277,6 +277,7 @@ blendCtrlInit( pastix_data_t *pastix_data,
     ctrl->etree   = NULL;
     ctrl->costmtx = NULL;
     ctrl->candtab = NULL;
+    ctrl->bottomlvl = NULL;
 
 #ifdef PASTIX_DYNSCHED
     MALLOC_INTERN(ctrl->btree, 1, BubbleTree);
@@ -312,4 +313,7 @@ blendCtrlExit(BlendCtrl *ctrl)
         candExit( ctrl->candtab );
         ctrl->candtab = NULL;
     }
+    if(ctrl->bottomlvl) {
+        memFree_null(ctrl->bottomlvl);
+    }
 }
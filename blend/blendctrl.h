@@ -97,6 +97,7 @@ typedef struct blendctrl_s {
     CostMatrix        *costmtx;      /**< the cost bounded to each cblk and blok                            */
     Cand              *candtab;      /**< processor candidate tab                                           */
     FILE              *tracefile;    /**< File holding the simulated trace                                  */
+    double            *bottomlvl;    /**< Critical path priority of each cblk, NULL if not used             */
     /**
      * @}
      */
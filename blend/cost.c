@@ -21,6 +21,7 @@
 
 #include "common.h"
 #include "symbol/symbol.h"
+#include "common/models.h"
 #include "blend/cost.h"
 
 /**
@@ -106,6 +107,96 @@ costMatrixBuild( const symbol_matrix_t *symbmtx,
     return costmtx;
 }
 
+/**
+ *******************************************************************************
+ *
+ * @brief Compute the cost of each panel from the kernel performance models.
+ *
+ * The cost of a panel is the sum of the factorization of its diagonal block,
+ * of the solve of its off-diagonal blocks, and of the updates it generates on
+ * the rest of the matrix. Contrary to the costmtx->cblkcost array, the kernels
+ * are weighted with the coefficients of the given model, that can be loaded
+ * from a file measured on the actual architecture.
+ *
+ *******************************************************************************
+ *
+ * @param[in] symbmtx
+ *          The symbol matrix structure.
+ *
+ * @param[in] model
+ *          The performance model used to weight the kernels.
+ *
+ * @param[in] flttype
+ *          The arithmetic type of the factorization.
+ *
+ * @param[in] factotype
+ *          The factorization that will be appplied.
+ *
+ * @param[inout] cblkcost
+ *          Array of size symbmtx->cblknbr. On exit, cblkcost[k] holds the
+ *          estimated time in s of all the operations linked to the panel k.
+ *
+ *******************************************************************************/
+void
+costMatrixModels( const symbol_matrix_t *symbmtx,
+                  const pastix_model_t  *model,
+                  pastix_coeftype_t      flttype,
+                  pastix_factotype_t     factotype,
+                  double                *cblkcost )
+{
+    symbol_cblk_t *cblk;
+    symbol_blok_t *blok, *lblok;
+    const double  *coefsfac, *coefstrsm, *coefsgemm;
+    pastix_int_t   k, M, N, mj, fnum, lnum;
+    pastix_ktype_t ktype;
+    int            arithm = ( flttype < PastixFloat ) ? 1 : flttype - 2;
+    double         ratio  = ( factotype == PastixFactLU ) ? 2. : 1.;
+
+    switch( factotype ) {
+    case PastixFactLU:
+        ktype = PastixKernelGETRF;
+        break;
+    case PastixFactLDLT:
+        ktype = PastixKernelSYTRF;
+        break;
+    case PastixFactLDLH:
+        ktype = PastixKernelHETRF;
+        break;
+    case PastixFactLLT:
+        ktype = PastixKernelPXTRF;
+        break;
+    case PastixFactLLH:
+    default:
+        ktype = PastixKernelPOTRF;
+    }
+
+    coefsfac  = model->coefficients[arithm][ktype];
+    coefstrsm = model->coefficients[arithm][PastixKernelTRSMCblk2d];
+    coefsgemm = model->coefficients[arithm][PastixKernelGEMMCblk2d2d];
+
+    cblk = symbmtx->cblktab;
+    for( k=0; k<symbmtx->cblknbr; k++, cblk++ ) {
+        N = symbol_cblk_get_colnum( symbmtx, cblk, &fnum, &lnum );
+
+        /* Number of rows in the off-diagonal blocks */
+        M     = 0;
+        lblok = symbmtx->bloktab + cblk[1].bloknum;
+        for( blok = symbmtx->bloktab + cblk->bloknum + 1; blok < lblok; blok++ ) {
+            M += symbol_blok_get_rownum( symbmtx, blok, &fnum, &lnum );
+        }
+
+        cblkcost[k]  = modelsGetCost1Param( coefsfac, N );
+        cblkcost[k] += ratio * modelsGetCost2Param( coefstrsm, M, N );
+
+        /* Each off-diagonal block generates the update of the blocks below it */
+        for( blok = symbmtx->bloktab + cblk->bloknum + 1; blok < lblok; blok++ ) {
+            mj = symbol_blok_get_rownum( symbmtx, blok, &fnum, &lnum );
+            cblkcost[k] += ratio * modelsGetCost3Param( coefsgemm, M, mj, N );
+            M -= mj;
+        }
+    }
+}
+
 /**
  * @}
  */
@@ -38,6 +38,11 @@ void        costMatrixExit ( CostMatrix *costmtx );
 CostMatrix *costMatrixBuild( const symbol_matrix_t *symbmtx,
                              pastix_coeftype_t      flttype,
                              pastix_factotype_t     factotype );
+void        costMatrixModels( const symbol_matrix_t *symbmtx,
+                              const pastix_model_t  *model,
+                              pastix_coeftype_t      flttype,
+                              pastix_factotype_t     factotype,
+                              double                *cblkcost );
 
 #endif /* _cost_h_ */
 
@@ -454,6 +454,52 @@ eTreeGetLevelMinIdx( const EliminTree *etree,
     return idx;
 }
 
+/**
+ *******************************************************************************
+ *
+ * @brief Compute the bottom level of each node of the elimination tree.
+ *
+ * The bottom level of a node is the cost of the longest path from this node to
+ * the root of the tree, including the node itself. As a node can be processed
+ * only after all its descendants, the nodes with the largest bottom levels are
+ * the ones on the critical path of the factorization.
+ *
+ *******************************************************************************
+ *
+ * @param[in] etree
+ *          The pointer to the elimination tree.
+ *
+ * @param[in] nodecost
+ *          Array of size etree->nodenbr with the cost of each node.
+ *
+ *******************************************************************************
+ *
+ * @return The array of size etree->nodenbr of the bottom levels. It must be
+ *         freed by the caller.
+ *
+ *******************************************************************************/
+double *
+eTreeBottomLevels( const EliminTree *etree,
+                   const double     *nodecost )
+{
+    double      *bottomlvl;
+    pastix_int_t i, fathnum;
+
+    MALLOC_INTERN( bottomlvl, etree->nodenbr, double );
+
+    /* Fathers always have a larger index than their sons */
+    for( i=etree->nodenbr-1; i>=0; i-- ) {
+        fathnum = etree->nodetab[i].fathnum;
+        assert( (fathnum == -1) || (fathnum > i) );
+
+        bottomlvl[i] = nodecost[i];
+        if ( fathnum != -1 ) {
+            bottomlvl[i] += bottomlvl[fathnum];
+        }
+    }
+    return bottomlvl;
+}
+
 /**
  *******************************************************************************
  *
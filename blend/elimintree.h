@@ -55,6 +55,7 @@ EliminTree   *eTreeBuild     (const symbol_matrix_t *);
 
 pastix_int_t eTreeComputeLevels   ( EliminTree *, pastix_int_t, pastix_int_t );
 pastix_int_t eTreeGetLevelMinIdx  ( const EliminTree *, pastix_int_t, pastix_int_t, pastix_int_t );
+double      *eTreeBottomLevels    ( const EliminTree *, const double * );
 
 /**
  *******************************************************************************
@@ -21,6 +21,7 @@
 #include <spm.h>
 #include "graph/graph.h"
 #include "order/order_internal.h"
+#include "common/models.h"
 #include "blend/perf.h"
 #include "blend/elimintree.h"
 #include "blend/cost.h"
@@ -487,6 +488,28 @@ pastix_subtask_blend( pastix_data_t *pastix_data )
     }
 #endif
 
+    /*
+     * Compute the critical path priorities of the cblks for the dynamic
+     * scheduler. The costs are given by the kernel models when available, and
+     * by the cost matrix otherwise.
+     */
+    if ( iparm[IPARM_SCHED_PRIORITY] == PastixSchedPrioCriticalPath ) {
+        double *cblkcost = ctrl.costmtx->cblkcost;
+
+        if ( pastix_data->cpu_models != NULL ) {
+            MALLOC_INTERN( cblkcost, symbmtx->cblknbr, double );
+            costMatrixModels( symbmtx, pastix_data->cpu_models,
+                              iparm[IPARM_FLOAT], iparm[IPARM_FACTORIZATION],
+                              cblkcost );
+        }
+
+        ctrl.bottomlvl = eTreeBottomLevels( ctrl.etree, cblkcost );
+
+        if ( cblkcost != ctrl.costmtx->cblkcost ) {
+            memFree_null( cblkcost );
+        }
+    }
+
     /* CostMatrix and Elimination Tree are no further used */
     costMatrixExit( ctrl.costmtx );
     memFree_null( ctrl.costmtx );
@@ -62,6 +62,9 @@ solver_size( const SolverMatrix *solvptr )
     if ( solvptr->browtab ) {
         mem += solvptr->brownbr * sizeof( pastix_int_t );
     }
+    if ( solvptr->scattab ) {
+        mem += solvptr->scatnbr * sizeof( pastix_int_t );
+    }
 #if defined(PASTIX_WITH_PARSEC)
     if ( solvptr->parsec_desc ) {
         mem += sizeof( parsec_sparse_matrix_desc_t );
@@ -156,6 +159,15 @@ solverExit(SolverMatrix *solvmtx)
     if(solvmtx->browtab) {
         memFree_null(solvmtx->browtab);
     }
+    if(solvmtx->scattab) {
+        memFree_null(solvmtx->scattab);
+    }
+    if(solvmtx->pivtab) {
+        memFree_null(solvmtx->pivtab);
+    }
+    if(solvmtx->cblkpivots) {
+        memFree_null(solvmtx->cblkpivots);
+    }
     if(solvmtx->gcbl2loc) {
         memFree_null(solvmtx->gcbl2loc);
     }
@@ -170,6 +182,15 @@ solverExit(SolverMatrix *solvmtx)
         }
     }
     memFree_null(solvmtx->ttsktab);
+    if ( solvmtx->thrdstats ) {
+        memFree_null( solvmtx->thrdstats );
+    }
+    solvmtx->thrdstatsnbr = 0;
+    if ( solvmtx->idle ) {
+        pthread_cond_destroy( &(solvmtx->idle->cond) );
+        pthread_mutex_destroy( &(solvmtx->idle->mutex) );
+        memFree_null( solvmtx->idle );
+    }
 #if defined(PASTIX_WITH_STARPU)
     {
         if ( solvmtx->starpu_desc_rhs != NULL ) {
@@ -408,6 +429,985 @@ solverPrintStats( const SolverMatrix *solvptr )
              gemm_dense, gemm_starpu_full2, gemm_starpu_hybrid, gemm_full1 );
 }
 
+/**
+ *******************************************************************************
+ *
+ * @brief Allocate and reset the statistics of the dynamic scheduler.
+ *
+ * The parking area of the idle threads is also created at the first call.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] solvmtx
+ *          The pointer to the solver matrix structure.
+ *
+ * @param[in] nbthreads
+ *          The number of threads of the dynamic scheduler.
+ *
+ *******************************************************************************/
+void
+solverThrdStatsInit( SolverMatrix *solvmtx,
+                     int           nbthreads )
+{
+    if ( solvmtx->thrdstatsnbr != nbthreads ) {
+        if ( solvmtx->thrdstats ) {
+            memFree_null( solvmtx->thrdstats );
+        }
+        MALLOC_INTERN( solvmtx->thrdstats, nbthreads, SolverThrdStats );
+        solvmtx->thrdstatsnbr = nbthreads;
+    }
+    memset( solvmtx->thrdstats, 0, nbthreads * sizeof(SolverThrdStats) );
+
+    if ( solvmtx->idle == NULL ) {
+        MALLOC_INTERN( solvmtx->idle, 1, SolverIdle );
+        pthread_mutex_init( &(solvmtx->idle->mutex), NULL );
+        pthread_cond_init( &(solvmtx->idle->cond), NULL );
+        solvmtx->idle->parked = 0;
+    }
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Print the statistics of the dynamic scheduler.
+ *
+ *******************************************************************************
+ *
+ * @param[in] solvmtx
+ *          The pointer to the solver matrix structure.
+ *
+ * @param[in] procnum
+ *          The rank of the process in the communicator. Only the process 0
+ *          prints the statistics.
+ *
+ *******************************************************************************/
+void
+solverThrdStatsPrint( const SolverMatrix *solvmtx,
+                      int                 procnum )
+{
+    const SolverThrdStats *stats = solvmtx->thrdstats;
+    pastix_int_t           nbsteals = 0;
+    pastix_int_t           nbxsteals = 0;
+    pastix_int_t           nbparks = 0;
+    double                 idlesum = 0.;
+    double                 idlemax = 0.;
+#if defined(PASTIX_WITH_PAPI)
+    long long              misses[2] = { 0, 0 };
+#endif
+    pastix_int_t           i;
+
+    if ( stats == NULL ) {
+        return;
+    }
+
+    for( i=0; i<solvmtx->thrdstatsnbr; i++, stats++ ) {
+        nbsteals  += stats->nbsteals;
+        nbxsteals += stats->nbxsteals;
+        nbparks   += stats->nbparks;
+        idlesum   += stats->idletime;
+        idlemax    = (stats->idletime > idlemax) ? stats->idletime : idlemax;
+    }
+
+    pastix_print( procnum, 0, OUT_SCHED_STEALS,
+                  (long)nbsteals, (long)nbxsteals );
+    pastix_print( procnum, 0, OUT_SCHED_IDLE,
+                  idlesum / (double)(solvmtx->thrdstatsnbr), idlemax,
+                  (long)nbparks );
+#if defined(PASTIX_WITH_PAPI)
+    stats = solvmtx->thrdstats;
+    for( i=0; i<solvmtx->thrdstatsnbr; i++, stats++ ) {
+        misses[0] += stats->misses[0];
+        misses[1] += stats->misses[1];
+    }
+    pastix_print( procnum, 0, OUT_SCHED_CACHE, misses[0], misses[1] );
+#endif
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Update the steal statistics of a thread.
+ *
+ *******************************************************************************/
+static inline void
+steal_stats_update( SolverMatrix *solvmtx,
+                    const int    *socketids,
+                    int           rank,
+                    int           victim )
+{
+    SolverThrdStats *stats;
+
+    if ( solvmtx->thrdstats == NULL ) {
+        return;
+    }
+    stats = solvmtx->thrdstats + rank;
+    stats->nbsteals++;
+    if ( socketids[rank] != socketids[victim] ) {
+        stats->nbxsteals++;
+    }
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Steal a task to the other threads of the dynamic scheduler.
+ *
+ * The victims are selected according to solvmtx->stealpolicy:
+ *   - PastixSchedStealRoundRobin: the threads are visited in a round-robin
+ *     order starting from rank+1, and the first available task is stolen.
+ *   - PastixSchedStealLocality: the threads of the same socket are visited
+ *     first, and the task with the highest priority among their queues is
+ *     stolen. If none is found, the threads of the other sockets are visited
+ *     the same way.
+ *   - PastixSchedStealLocalityRandom: same as locality, but the visit starts
+ *     from a random thread to avoid convoys of thieves on the same victim.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] solvmtx
+ *          The pointer to the solver matrix structure.
+ *
+ * @param[inout] ctx
+ *          The context of the thief thread.
+ *
+ *******************************************************************************
+ *
+ * @return The stolen task if it exists, -1 otherwise.
+ *
+ *******************************************************************************/
+pastix_int_t
+stealQueue( SolverMatrix    *solvmtx,
+            isched_thread_t *ctx )
+{
+    pastix_queue_t **queues    = solvmtx->computeQueue;
+    const int       *socketids = ctx->global_ctx->socketids;
+    int              rank      = ctx->rank;
+    int              size      = ctx->global_ctx->world_size;
+    pastix_int_t     cblknum   = -1;
+    int              first, pass, local, best, rk, i;
+    double           key, bestkey = 0.;
+
+    if ( size == 1 ) {
+        return -1;
+    }
+
+    if ( solvmtx->stealpolicy == PastixSchedStealRoundRobin ) {
+        for( rk = (rank+1)%size; rk != rank; rk = (rk+1)%size ) {
+            assert( queues[rk] );
+            cblknum = pqueuePop( queues[rk] );
+            if ( cblknum != -1 ) {
+                steal_stats_update( solvmtx, socketids, rank, rk );
+                return cblknum;
+            }
+        }
+        return -1;
+    }
+
+    first = 1;
+    if ( solvmtx->stealpolicy == PastixSchedStealLocalityRandom ) {
+        first += rand_r( &(ctx->seed) ) % (size-1);
+    }
+
+    /* Visit the threads of the same socket first, then the other ones */
+    for( pass=0; pass<2; pass++ ) {
+        local = (pass == 0);
+
+        /* Look for the victim with the highest priority task */
+        best = -1;
+        for( i=0; i<size; i++ ) {
+            rk = (rank + first + i) % size;
+            if ( (rk == rank) || ((socketids[rk] == socketids[rank]) != local) ) {
+                continue;
+            }
+            assert( queues[rk] );
+            if ( pqueuePeek( queues[rk], &key ) &&
+                 ( (best == -1) || (key < bestkey) ) )
+            {
+                best    = rk;
+                bestkey = key;
+            }
+        }
+
+        if ( best == -1 ) {
+            continue;
+        }
+
+        cblknum = pqueuePop( queues[best] );
+        if ( cblknum != -1 ) {
+            steal_stats_update( solvmtx, socketids, rank, best );
+            return cblknum;
+        }
+
+        /* The task has been taken by someone else, take any task in this group */
+        for( i=0; i<size; i++ ) {
+            rk = (rank + first + i) % size;
+            if ( (rk == rank) || ((socketids[rk] == socketids[rank]) != local) ) {
+                continue;
+            }
+            cblknum = pqueuePop( queues[rk] );
+            if ( cblknum != -1 ) {
+                steal_stats_update( solvmtx, socketids, rank, rk );
+                return cblknum;
+            }
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Number of unsuccessful attempts to find a task before backing off.
+ */
+#define SOLVER_IDLE_SPIN     64
+
+/**
+ * @brief Number of backoff steps before parking. The sleep time starts at 1us
+ * and doubles at each step.
+ */
+#define SOLVER_IDLE_BACKOFF  10
+
+/**
+ * @brief Maximal parking time in ns before looking at the queues again.
+ */
+#define SOLVER_IDLE_PARK     1000000
+
+/**
+ * @brief Check if a thread about to be parked has some work to do: the
+ * factorization is over, some work is shared by a team, or a queue is not
+ * empty.
+ */
+static inline int
+solver_idle_pending( const SolverMatrix     *solvmtx,
+                     const volatile int32_t *taskcnt )
+{
+    int i;
+
+    if ( ((taskcnt != NULL) && (*taskcnt <= 0)) ||
+         (solvmtx->team != NULL) )
+    {
+        return 1;
+    }
+    if ( solvmtx->computeQueue == NULL ) {
+        return 0;
+    }
+    for( i=0; i<solvmtx->thrdstatsnbr; i++ ) {
+        const pastix_queue_t *queue = solvmtx->computeQueue[i];
+        if ( (queue != NULL) && (pqueueSize( queue ) > 0) ) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Make a thread of the dynamic scheduler wait when it did not find any
+ * task to execute.
+ *
+ * The behavior depends on solvmtx->idlepolicy:
+ *   - PastixSchedIdleSpin: returns immediately to look at the queues again.
+ *   - PastixSchedIdleBackoff: returns immediately for the first
+ *     SOLVER_IDLE_SPIN attempts, and then sleeps for an exponentially
+ *     increasing time, up to 2^(SOLVER_IDLE_BACKOFF-1) us.
+ *   - PastixSchedIdlePark: same as backoff, but after SOLVER_IDLE_BACKOFF
+ *     steps the thread is parked until solverIdleWakeup() is called, or
+ *     SOLVER_IDLE_PARK ns elapsed.
+ *
+ * To park safely, the thread registers itself as parked, and then looks again
+ * for pending work before sleeping, while the waker pushes the tasks before
+ * reading the number of parked threads. With a fence on both sides, either
+ * the parked thread sees the new tasks, or the waker sees the parked thread
+ * and signals it.
+ *
+ * The time spent between the first unsuccessful attempt and the next call to
+ * solverIdleStop() is accumulated in the idle time of the thread.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] solvmtx
+ *          The pointer to the solver matrix structure.
+ *
+ * @param[in] rank
+ *          The rank of the calling thread.
+ *
+ * @param[in] taskcnt
+ *          The number of tasks remaining in the factorization or the solve.
+ *          The thread is not parked if it reached 0.
+ *
+ *******************************************************************************/
+void
+solverIdleWait( SolverMatrix     *solvmtx,
+                int               rank,
+                volatile int32_t *taskcnt )
+{
+    SolverThrdStats *stats;
+    SolverIdle      *idle = solvmtx->idle;
+    struct timespec  ts;
+    int              nbtries;
+
+    if ( (solvmtx->thrdstats == NULL) || (rank >= solvmtx->thrdstatsnbr) ) {
+        return;
+    }
+
+    stats = solvmtx->thrdstats + rank;
+    if ( stats->nbtries == 0 ) {
+        stats->idlestart = clockGetLocal();
+    }
+    stats->nbtries++;
+
+    if ( solvmtx->idlepolicy == PastixSchedIdleSpin ) {
+        return;
+    }
+
+    nbtries = stats->nbtries - SOLVER_IDLE_SPIN;
+    if ( nbtries <= 0 ) {
+        return;
+    }
+
+    /*
+     * Back off if required, or if the communications need to make progress
+     * regularly
+     */
+    if ( (solvmtx->idlepolicy == PastixSchedIdleBackoff) ||
+         (nbtries <= SOLVER_IDLE_BACKOFF) ||
+         (idle == NULL) || (solvmtx->clustnbr > 1) )
+    {
+        nbtries = pastix_imin( nbtries, SOLVER_IDLE_BACKOFF );
+        ts.tv_sec  = 0;
+        ts.tv_nsec = 1000L << (nbtries - 1);
+        nanosleep( &ts, NULL );
+        return;
+    }
+
+    /* Park the thread */
+    clock_gettime( CLOCK_REALTIME, &ts );
+    ts.tv_nsec += SOLVER_IDLE_PARK;
+    if ( ts.tv_nsec >= 1000000000L ) {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000L;
+    }
+
+    pthread_mutex_lock( &(idle->mutex) );
+    pastix_atomic_inc_32b( &(idle->parked) );
+    pastix_mfence();
+
+    /* Work may have been released before the waker could see this thread */
+    if ( solver_idle_pending( solvmtx, taskcnt ) ) {
+        pastix_atomic_dec_32b( &(idle->parked) );
+        pthread_mutex_unlock( &(idle->mutex) );
+        return;
+    }
+
+    pthread_cond_timedwait( &(idle->cond), &(idle->mutex), &ts );
+    pastix_atomic_dec_32b( &(idle->parked) );
+    pthread_mutex_unlock( &(idle->mutex) );
+
+    stats->nbparks++;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Close the current idle period of a thread of the dynamic scheduler.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] solvmtx
+ *          The pointer to the solver matrix structure.
+ *
+ * @param[in] rank
+ *          The rank of the calling thread.
+ *
+ *******************************************************************************/
+void
+solverIdleStop( SolverMatrix *solvmtx,
+                int           rank )
+{
+    SolverThrdStats *stats;
+
+    if ( (solvmtx->thrdstats == NULL) || (rank >= solvmtx->thrdstatsnbr) ) {
+        return;
+    }
+
+    stats = solvmtx->thrdstats + rank;
+    if ( stats->nbtries > 0 ) {
+        stats->idletime += clockGetLocal() - stats->idlestart;
+        stats->nbtries   = 0;
+    }
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Wake up the parked threads of the dynamic scheduler.
+ *
+ * This function must be called after new tasks have been pushed in the
+ * queues, or when the last task completed. It costs a single fence when no
+ * thread is parked, and nothing if the threads are never parked.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] solvmtx
+ *          The pointer to the solver matrix structure.
+ *
+ * @param[in] all
+ *          If true, all the parked threads are woken up, otherwise only one
+ *          of them.
+ *
+ *******************************************************************************/
+void
+solverIdleWakeup( SolverMatrix *solvmtx,
+                  int           all )
+{
+    SolverIdle *idle = solvmtx->idle;
+
+    if ( (idle == NULL) || (solvmtx->idlepolicy != PastixSchedIdlePark) ) {
+        return;
+    }
+
+    /*
+     * Order the read of the number of parked threads after the push of the
+     * tasks (see solverIdleWait())
+     */
+    pastix_mfence();
+    if ( idle->parked == 0 ) {
+        return;
+    }
+
+    pthread_mutex_lock( &(idle->mutex) );
+    if ( all ) {
+        pthread_cond_broadcast( &(idle->cond) );
+    }
+    else {
+        pthread_cond_signal( &(idle->cond) );
+    }
+    pthread_mutex_unlock( &(idle->mutex) );
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#define SOLVER_PREFETCH_LINE 64
+#define SOLVER_PREFETCH_MAX  (128 * 1024)
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+/**
+ *******************************************************************************
+ *
+ * @brief Prefetch a contiguous memory area, one cache line at a time.
+ *
+ *******************************************************************************/
+static inline void
+solver_prefetch_area( const char *ptr,
+                      size_t      size,
+                      int         rw )
+{
+    const char *end = ptr + size;
+
+    if ( rw ) {
+        for( ; ptr < end; ptr += SOLVER_PREFETCH_LINE ) {
+            pastix_prefetch_write( ptr );
+        }
+    }
+    else {
+        for( ; ptr < end; ptr += SOLVER_PREFETCH_LINE ) {
+            pastix_prefetch_read( ptr );
+        }
+    }
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Prefetch the coefficients of a set of consecutive blocks of a cblk.
+ *
+ * Only the leading blocks of the set that fit in SOLVER_PREFETCH_MAX bytes are
+ * prefetched, such that the prefetched data is not evicted by the end of the
+ * set before it is used. For the compressed cblks, only the low-rank
+ * structures and the dense diagonal block are prefetched.
+ *
+ *******************************************************************************
+ *
+ * @param[in] solvmtx
+ *          The pointer to the solver matrix structure.
+ *
+ * @param[in] cblk
+ *          The column block that holds the blocks.
+ *
+ * @param[in] fblok
+ *          The first block of the set.
+ *
+ * @param[in] lblok
+ *          The block following the last block of the set.
+ *
+ * @param[in] rw
+ *          If true, the blocks are prefetched for a write access.
+ *
+ *******************************************************************************/
+static inline void
+solver_prefetch_bloks( const SolverMatrix *solvmtx,
+                       const SolverCblk   *cblk,
+                       const SolverBlok   *fblok,
+                       const SolverBlok   *lblok,
+                       int                 rw )
+{
+    const SolverBlok *blok;
+    size_t            eltsize = pastix_size_of( solvmtx->flttype );
+    size_t            colsize, size;
+    pastix_int_t      ncols = cblk_colnbr( cblk );
+    pastix_int_t      nrows, j;
+    int               side, nbsides;
+
+    nbsides = ( solvmtx->factotype == PastixFactLU ) ? 2 : 1;
+
+    if ( cblk->cblktype & CBLK_COMPRESSED ) {
+        const pastix_lrblock_t *lrblok;
+
+        for( side=0; side<nbsides; side++ ) {
+            lrblok = fblok->LRblock[side];
+            if ( lrblok == NULL ) {
+                continue;
+            }
+            solver_prefetch_area( (const char *)lrblok,
+                                  (lblok - fblok) * sizeof(pastix_lrblock_t), 0 );
+            if ( (fblok == cblk->fblokptr) && (lrblok->u != NULL) ) {
+                solver_prefetch_area( lrblok->u, ncols * ncols * eltsize, rw );
+            }
+        }
+        return;
+    }
+
+    /* Keep the leading blocks that fit in the budget */
+    nrows = 0;
+    for( blok = fblok; blok < lblok; blok++ ) {
+        nrows += blok_rownbr( blok );
+        if ( (size_t)(nrows * ncols * nbsides) * eltsize >= SOLVER_PREFETCH_MAX ) {
+            break;
+        }
+    }
+    nrows   = pastix_imin( nrows, SOLVER_PREFETCH_MAX / (ncols * nbsides * eltsize) + 1 );
+    colsize = nrows * eltsize;
+
+    for( side=0; side<nbsides; side++ ) {
+        const char *coeftab = (side == PastixUCoef) ? cblk->ucoeftab : cblk->lcoeftab;
+
+        if ( coeftab == NULL ) {
+            continue;
+        }
+        coeftab += fblok->coefind * eltsize;
+
+        /* The blocks of the 2D layout are stored contiguously */
+        if ( cblk->cblktype & CBLK_LAYOUT_2D ) {
+            size = colsize * ncols;
+            solver_prefetch_area( coeftab, size, rw );
+            continue;
+        }
+
+        for( j=0; j<ncols; j++, coeftab += cblk->stride * eltsize ) {
+            solver_prefetch_area( coeftab, colsize, rw );
+        }
+    }
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Prefetch the data of the next task of a queue of the dynamic
+ * scheduler.
+ *
+ * The function is called by the owner of the queue before the execution of the
+ * task it just popped, such that the data of the next one is brought to the
+ * cache while the current task is executed, instead of being touched cold
+ * once it is popped. The prefetched data is:
+ *    - for a cblk task, the diagonal block and the first off-diagonal blocks,
+ *    - for a TRSM task, the diagonal block and the off-diagonal blocks
+ *      facing the same cblk,
+ *    - for a GEMM task, the off-diagonal blocks that generate the update.
+ * The next element of the queue is only a hint, so the prefetch may be wasted
+ * if it is stolen, or if a task with a higher priority is pushed meanwhile.
+ *
+ *******************************************************************************
+ *
+ * @param[in] solvmtx
+ *          The pointer to the solver matrix structure.
+ *
+ * @param[in] queue
+ *          The queue of the calling thread.
+ *
+ *******************************************************************************/
+void
+solverPrefetchNext( const SolverMatrix *solvmtx,
+                    pastix_queue_t     *queue )
+{
+    const SolverCblk *cblk;
+    const SolverBlok *blok, *lblk;
+    pastix_int_t      num;
+
+    if ( !solvmtx->prefetch ) {
+        return;
+    }
+
+    num = pqueueRead( queue );
+    if ( num == -1 ) {
+        return;
+    }
+
+    switch( solver_task_decode( solvmtx, &num ) ) {
+    case SolverTaskCblk:
+        cblk = solvmtx->cblktab + num;
+        solver_prefetch_bloks( solvmtx, cblk, cblk->fblokptr, cblk[1].fblokptr, 1 );
+        break;
+
+    case SolverTaskTrsm:
+        blok = solvmtx->bloktab + num;
+        cblk = solvmtx->cblktab + blok->lcblknm;
+        lblk = blok + 1;
+        while( ( lblk < cblk[1].fblokptr ) &&
+               ( lblk->fcblknm == blok->fcblknm ) )
+        {
+            lblk++;
+        }
+        solver_prefetch_bloks( solvmtx, cblk, cblk->fblokptr, cblk->fblokptr + 1, 0 );
+        solver_prefetch_bloks( solvmtx, cblk, blok, lblk, 1 );
+        break;
+
+    case SolverTaskGemm:
+        blok = solvmtx->bloktab + num;
+        cblk = solvmtx->cblktab + blok->lcblknm;
+        solver_prefetch_bloks( solvmtx, cblk, blok, cblk[1].fblokptr, 0 );
+        break;
+    }
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Start the counters of the cache misses of a thread of the dynamic
+ * scheduler.
+ *
+ * The counters are only available if PaStiX is compiled with PAPI.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] solvmtx
+ *          The pointer to the solver matrix structure.
+ *
+ * @param[in] rank
+ *          The rank of the calling thread.
+ *
+ *******************************************************************************/
+void
+solverCacheStart( SolverMatrix *solvmtx,
+                  int           rank )
+{
+    if ( solvmtx->thrdstats == NULL ) {
+        return;
+    }
+    solvmtx->thrdstats[rank].papievts = papiCacheStart();
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Stop the counters of the cache misses of a thread of the dynamic
+ * scheduler, and accumulate them in its statistics.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] solvmtx
+ *          The pointer to the solver matrix structure.
+ *
+ * @param[in] rank
+ *          The rank of the calling thread.
+ *
+ *******************************************************************************/
+void
+solverCacheStop( SolverMatrix *solvmtx,
+                 int           rank )
+{
+    SolverThrdStats *stats;
+
+    if ( solvmtx->thrdstats == NULL ) {
+        return;
+    }
+    stats = solvmtx->thrdstats + rank;
+    papiCacheStop( stats->papievts, stats->misses );
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Submit the 2D tasks of a cblk to the queue of the calling thread.
+ *
+ * The counter cblk->subtasks is initialized to the number of submitted tasks
+ * before they are made visible to the other threads, such that the thread
+ * executing the last one can submit the next stage, or release the cblk.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] solvmtx
+ *          The pointer to the solver matrix structure.
+ *
+ * @param[inout] queue
+ *          The queue of the calling thread.
+ *
+ * @param[inout] cblk
+ *          The 2D column block for which the tasks are submitted.
+ *
+ * @param[in] type
+ *          SolverTaskTrsm to submit one task per set of off-diagonal blocks
+ *          facing the same cblk, SolverTaskGemm to submit one task per
+ *          off-diagonal block.
+ *
+ *******************************************************************************
+ *
+ * @return The number of tasks submitted.
+ *
+ *******************************************************************************/
+pastix_int_t
+solverSubmit2DTasks( SolverMatrix   *solvmtx,
+                     pastix_queue_t *queue,
+                     SolverCblk     *cblk,
+                     solver_task_t   type )
+{
+    SolverBlok  *fblk = cblk->fblokptr + 1; /* First off-diagonal block */
+    SolverBlok  *lblk = cblk[1].fblokptr;   /* Next diagonal block      */
+    SolverBlok  *blok;
+    pastix_int_t nbtasks = 0;
+
+    assert( cblk->cblktype & CBLK_TASKS_2D );
+    assert( type != SolverTaskCblk );
+
+    for( blok = fblk; blok < lblk; blok++, nbtasks++ ) {
+        if ( type == SolverTaskGemm ) {
+            continue;
+        }
+        /* Skip blocks facing the same cblk */
+        while( ( blok < lblk-1 ) &&
+               ( blok[0].fcblknm == blok[1].fcblknm ) &&
+               ( blok[0].lcblknm == blok[1].lcblknm ) )
+        {
+            blok++;
+        }
+    }
+
+    if ( nbtasks == 0 ) {
+        return 0;
+    }
+    cblk->subtasks = nbtasks;
+    pastix_mfence();
+
+    for( blok = fblk; blok < lblk; blok++ ) {
+        pqueuePush1( queue,
+                     solver_task_encode( solvmtx, type, blok - solvmtx->bloktab ),
+                     cblk->priority );
+
+        if ( type == SolverTaskGemm ) {
+            continue;
+        }
+        while( ( blok < lblk-1 ) &&
+               ( blok[0].fcblknm == blok[1].fcblknm ) &&
+               ( blok[0].lcblknm == blok[1].lcblknm ) )
+        {
+            blok++;
+        }
+    }
+    solverIdleWakeup( solvmtx, nbtasks > 1 );
+    return nbtasks;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Select the next task to execute in the static list of a thread.
+ *
+ * Without lookahead, the tasks are returned in the order of the list computed
+ * by the simulation, and the caller waits for the dependencies of each one of
+ * them. With a lookahead window of size w, the first task among the w+1 next
+ * tasks of the list whose contributions have all been received is returned.
+ * The mapping of the simulation is thus kept, but a thread does not remain
+ * idle on a task that is late while another task of its list is ready.
+ *
+ *******************************************************************************
+ *
+ * @param[in] solvmtx
+ *          The pointer to the solver matrix structure.
+ *
+ * @param[in] rank
+ *          The rank of the calling thread.
+ *
+ * @param[inout] first
+ *          On entry, the index in ttsktab[rank] of the first task that has not
+ *          been executed yet. On exit, updated to skip the returned task.
+ *
+ * @param[inout] done
+ *          Array of size ttsknbr[rank] that flags the tasks already executed.
+ *          Only referenced if solvmtx->lookahead > 0.
+ *
+ *******************************************************************************
+ *
+ * @return The index in ttsktab[rank] of the task to execute, -1 if no task of
+ *         the window is ready.
+ *
+ *******************************************************************************/
+pastix_int_t
+solverStaticNext( const SolverMatrix *solvmtx,
+                  int                 rank,
+                  pastix_int_t       *first,
+                  int8_t             *done )
+{
+    const pastix_int_t *tasktab = solvmtx->ttsktab[rank];
+    pastix_int_t        tasknbr = solvmtx->ttsknbr[rank];
+    const SolverCblk   *cblk;
+    pastix_int_t        ii, last;
+
+    if ( solvmtx->lookahead <= 0 ) {
+        ii = *first;
+        (*first)++;
+        return ii;
+    }
+
+    last = pastix_imin( *first + solvmtx->lookahead + 1, tasknbr );
+    for ( ii = *first; ii < last; ii++ ) {
+        if ( done[ii] ) {
+            continue;
+        }
+
+        cblk = solvmtx->cblktab + solvmtx->tasktab[ tasktab[ii] ].cblknum;
+
+        /* The remote cblks and the skipped Schur complement never wait */
+        if ( ( cblk->cblktype & (CBLK_FANIN | CBLK_RECV) ) ||
+             ( (cblk->cblktype & CBLK_IN_SCHUR) &&
+               (solvmtx->lookside != PastixFactLeftLooking) ) ||
+             ( cblk->ctrbcnt == 0 ) )
+        {
+            break;
+        }
+    }
+
+    if ( ii == last ) {
+        return -1;
+    }
+
+    done[ii] = 1;
+    while ( (*first < tasknbr) && done[*first] ) {
+        (*first)++;
+    }
+    return ii;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Process the items of a work with the help of the idle threads.
+ *
+ * The work is published in the solver matrix such that the threads of the
+ * static scheduler waiting for their dependencies, or the idle threads of the
+ * dynamic scheduler, can pick some of its items through solverTeamHelp(). If a
+ * work is already published by another thread, the calling thread processes
+ * all its items alone. The function returns when all the items have been
+ * processed.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] solvmtx
+ *          The pointer to the solver matrix structure.
+ *
+ * @param[in] fct
+ *          The function applied to each item.
+ *
+ * @param[in] args
+ *          The arguments given to fct.
+ *
+ * @param[in] nbitems
+ *          The number of items of the work.
+ *
+ * @param[in] work
+ *          Temporary memory buffer of the calling thread.
+ *
+ * @param[in] lwork
+ *          Temporary workspace dimension.
+ *
+ *******************************************************************************/
+void
+solverTeamRun( SolverMatrix     *solvmtx,
+               solver_team_fct_t fct,
+               void             *args,
+               pastix_int_t      nbitems,
+               void             *work,
+               pastix_int_t      lwork )
+{
+    SolverTeam   team;
+    pastix_int_t item;
+    int          shared;
+
+    team.fct     = fct;
+    team.args    = args;
+    team.nbitems = nbitems;
+    team.next    = 0;
+
+    shared = pastix_atomic_cas( &(solvmtx->team), NULL, &team );
+    if ( shared ) {
+        /* The parked threads of the dynamic scheduler may help */
+        solverIdleWakeup( solvmtx, 1 );
+    }
+
+    while ( (item = pastix_atomic_inc_32b( &(team.next) ) - 1) < nbitems ) {
+        fct( solvmtx, args, item, work, lwork );
+    }
+
+    if ( shared ) {
+        /* Wait for the helpers that may still reference the team */
+        pastix_atomic_cas( &(solvmtx->team), &team, NULL );
+        while ( solvmtx->teamhelpers > 0 ) {
+            pastix_yield();
+        }
+    }
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Process some items of the work published by another thread.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] solvmtx
+ *          The pointer to the solver matrix structure.
+ *
+ * @param[in] work
+ *          Temporary memory buffer of the calling thread.
+ *
+ * @param[in] lwork
+ *          Temporary workspace dimension.
+ *
+ *******************************************************************************
+ *
+ * @return 1 if a work was published, 0 otherwise.
+ *
+ *******************************************************************************/
+int
+solverTeamHelp( SolverMatrix *solvmtx,
+                void         *work,
+                pastix_int_t  lwork )
+{
+    SolverTeam  *team;
+    pastix_int_t item;
+
+    if ( solvmtx->team == NULL ) {
+        return 0;
+    }
+
+    pastix_atomic_inc_32b( &(solvmtx->teamhelpers) );
+    team = solvmtx->team;
+    if ( team != NULL ) {
+        while ( (item = pastix_atomic_inc_32b( &(team->next) ) - 1) < team->nbitems ) {
+            team->fct( solvmtx, team->args, item, work, lwork );
+        }
+    }
+    pastix_atomic_dec_32b( &(solvmtx->teamhelpers) );
+
+    return ( team != NULL );
+}
+
 /**
  *******************************************************************************
  *
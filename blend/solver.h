@@ -145,9 +145,15 @@ typedef struct solver_blok_s {
     pastix_int_t browind;    /**< Index in browtab                         */
     int8_t       inlast;     /**< Index of the block among last separator (2), coupling with last separator (1) or other blocks (0) */
     int          iluklvl;    /**< The block ILU(k) level */
+    pastix_atomic_lock_t lock; /**< Lock to protect the accumulation of the updates in the block */
+    const pastix_int_t *scatmap; /**< Facing blocks of the 1D updates in scattab, NULL if none */
 
     /* LR structures */
     pastix_lrblock_t *LRblock[2]; /**< Store the blok (L/U) in LR format. Allocated for the cblk. */
+    pastix_lrblock_t *LRacc[2];   /**< Deferred LR updates (L/U) not yet added to LRblock, NULL if none */
+    int               rkcache[2]; /**< Rank (L/U) of the last compression: -1 if incompressible, -2 if unknown */
+    int               rkskip[2];  /**< Number (L/U) of compressions left to skip for an incompressible block */
+    float             rktime[2];  /**< Time (L/U) of the last compression made without the rank cache, 0 once credited */
 } SolverBlok;
 
 /**
@@ -158,6 +164,7 @@ typedef struct solver_cblk_s  {
     volatile int32_t     ctrbcnt;     /**< Number of contribution to receive               */
     int8_t               cblktype;    /**< Type of cblk                                    */
     int8_t               partitioned; /**< Bitmask to know if one of the side has been partitioned or not */
+    volatile int32_t     subtasks;    /**< Number of 2D tasks remaining in the dynamic scheduler */
     pastix_int_t         fcolnum;     /**< First column index (Global numbering)           */
     pastix_int_t         lcolnum;     /**< Last column index (Global numbering, inclusive) */
     SolverBlok          *fblokptr;    /**< First block in column (diagonal)                */
@@ -189,6 +196,45 @@ struct starpu_dense_matrix_desc_s;
 typedef struct starpu_dense_matrix_desc_s starpu_dense_matrix_desc_t;
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
+/**
+ * @brief Statistics of the dynamic scheduler for one thread.
+ */
+typedef struct solver_thrd_stats_s {
+    pastix_int_t nbsteals;  /**< Number of tasks stolen to the other threads            */
+    pastix_int_t nbxsteals; /**< Number of tasks stolen to threads of another socket    */
+    pastix_int_t nbparks;   /**< Number of times the thread has been parked             */
+    double       idletime;  /**< Time spent without task to execute                     */
+    double       idlestart; /**< Beginning of the current idle period                   */
+    int          nbtries;   /**< Number of consecutive attempts to find a task          */
+    int          papievts;  /**< PAPI EventSet of the cache miss counters               */
+    long long    misses[2]; /**< L2 and L3 cache misses measured with PAPI              */
+} SolverThrdStats;
+
+/**
+ * @brief Parking area of the idle threads of the dynamic scheduler.
+ */
+typedef struct solver_idle_s {
+    pthread_mutex_t  mutex;  /**< Mutex associated to the condition                    */
+    pthread_cond_t   cond;   /**< Condition signaled when new tasks are released        */
+    volatile int32_t parked; /**< Number of threads currently parked                    */
+} SolverIdle;
+
+/**
+ * @brief Function applied to one item of a team work.
+ */
+typedef void (*solver_team_fct_t)( SolverMatrix *solvmtx, void *args,
+                                   pastix_int_t item, void *work, pastix_int_t lwork );
+
+/**
+ * @brief Work shared by a thread of the static scheduler with the idle ones.
+ */
+typedef struct solver_team_s {
+    solver_team_fct_t fct;     /**< Function applied to each item                     */
+    void             *args;    /**< Arguments of the function                         */
+    int32_t           nbitems; /**< Number of items of the work                       */
+    volatile int32_t  next;    /**< Next item to process                              */
+} SolverTeam;
+
 /**
  * @brief Solver column block structure.
  *
@@ -222,6 +268,8 @@ struct solver_matrix_s {
     SolverCblk   * restrict cblktab;       /**< Array of solver column blocks [+1]                           */
     SolverBlok   * restrict bloktab;       /**< Array of solver blocks        [+1]                           */
     pastix_int_t * restrict browtab;       /**< Array of blocks                                              */
+    pastix_int_t            scatnbr;       /**< Size of the scattab array                                    */
+    pastix_int_t * restrict scattab;       /**< Facing block of each block updated by a 1D update            */
     pastix_coeftype_t       flttype;       /**< valtab datatype: PastixFloat, PastixDouble, PastixComplex32 or PastixComplex64 */
     int                     globalalloc;   /**< Boolean for global allocation of coeftab  */
 
@@ -231,6 +279,10 @@ struct solver_matrix_s {
     pastix_factotype_t      factotype;     /**< General or symmetric factorization?       */
     double                  diagthreshold; /**< Diagonal threshold for pivoting           */
     volatile int32_t        nbpivots;      /**< Number of pivots during the factorization */
+    pastix_int_t           *cblkpivots;    /**< Number of pivots of each cblk during the factorization */
+    double                  pivthreshold;  /**< Threshold of the partial pivoting in the diagonal blocks */
+    pastix_int_t           *pivtab;        /**< Row interchanges of the diagonal blocks, NULL if none */
+    int                     lufused;       /**< Apply the L and U updates of the 1D panels in a single pass */
 
 #if defined(PASTIX_WITH_PARSEC)
     parsec_sparse_matrix_desc_t *parsec_desc;
@@ -257,6 +309,18 @@ struct solver_matrix_s {
     pastix_int_t **           ttsktab;              /*+ Task access vector by thread              +*/
     pastix_int_t *            ttsknbr;              /*+ Number of tasks by thread                 +*/
     pastix_queue_t **         computeQueue;         /*+ Queue of task to compute by thread        +*/
+    pastix_sched_queue_t      queuetype;            /*+ Implementation of the computeQueues       +*/
+    pastix_sched_steal_t      stealpolicy;          /*+ Victim selection policy for the steals    +*/
+    pastix_sched_idle_t       idlepolicy;           /*+ Behavior of the threads without task      +*/
+    pastix_factolookside_t    lookside;             /*+ Left- or right-looking factorization      +*/
+    pastix_int_t              lookahead;            /*+ Lookahead window of the static scheduler  +*/
+    pastix_int_t              teamwidth;            /*+ Minimal width of the cblks shared by team +*/
+    int                       prefetch;             /*+ Prefetch the data of the next dynamic task +*/
+    SolverTeam * volatile     team;                 /*+ Work currently shared with the idle threads +*/
+    volatile int32_t          teamhelpers;          /*+ Number of threads working on the team     +*/
+    SolverIdle               *idle;                 /*+ Parking area of the idle threads          +*/
+    SolverThrdStats          *thrdstats;            /*+ Scheduler statistics per thread           +*/
+    pastix_int_t              thrdstatsnbr;         /*+ Size of the thrdstats array               +*/
 
     pastix_int_t             *selevtx;              /*+ Array to identify which cblk are pre-selected +*/
 
@@ -367,6 +431,33 @@ cblk_getdata( const SolverCblk *cblk, pastix_coefside_t side ) {
                                  : cblk->lcoeftab;
 }
 
+/**
+ * @brief     Get the pointer to the data associated to a block of a 2D cblk.
+ * @param[in] cblk
+ *            The pointer to the column block stored with the 2D layout.
+ * @param[in] blok
+ *            The pointer to the block that belongs to cblk.
+ * @param[in] side
+ *            PastixLCoef for the lower part PastixUCoef for the upper part.
+ * @param[in] flttype
+ *            The arithmetic of the coefficients.
+ * @return    The address of the block in [lu]coeftab if the cblk is not compressed.
+ *            blok->LRblock[side] if the cblk is compressed.
+ */
+static inline void *
+blok_getdata( const SolverCblk *cblk, const SolverBlok *blok,
+              pastix_coefside_t side, pastix_coeftype_t flttype )
+{
+    char *coeftab;
+
+    assert( cblk->cblktype & CBLK_LAYOUT_2D );
+    if ( cblk->cblktype & CBLK_COMPRESSED ) {
+        return blok->LRblock[side];
+    }
+    coeftab = (side == PastixUCoef) ? cblk->ucoeftab : cblk->lcoeftab;
+    return coeftab + pastix_size_of( flttype ) * blok->coefind;
+}
+
 /**
  * @brief     Compute the number of blocks in a column block.
  * @param[in] cblk
@@ -450,37 +541,6 @@ cblk_rownbr( const SolverCblk *cblk )
     return rownbr;
 }
 
-/**
- * @brief    Task stealing method.
- *
- * @param[inout] solvmtx
- *            The pointer to the solverMatrix.
- * @param[in] rank
- *            Rank of the computeQueue.
- * @param[in] nbthreads
- *            Total amount of threads in the node.
- * @return    The concerned cblk if it exists. -1 otherwhise.
- */
-static inline pastix_int_t
-stealQueue( SolverMatrix *solvmtx,
-            int           rank,
-            int           nbthreads )
-{
-    int rk = (rank + 1)%nbthreads;
-    pastix_queue_t *stoleQueue;
-    pastix_int_t    cblknum = -1;
-    while( rk != rank )
-    {
-        assert( solvmtx->computeQueue[ rk ] );
-        stoleQueue = solvmtx->computeQueue[ rk ];
-        if( (cblknum = pqueuePop(stoleQueue)) != -1 ){
-            return cblknum;
-        }
-        rk = (rk + 1)%nbthreads;
-    }
-    return cblknum;
-}
-
 /**
  * @brief Check if a block is included inside another one.
  *
@@ -513,6 +573,70 @@ is_block_inside_fblock( const SolverBlok *blok,
 #  endif /* defined(NAPA_SOPALIN) */
 }
 
+/**
+ * @brief Type of the tasks stored in the computeQueues of the dynamic scheduler.
+ *
+ * The 1D cblks are processed by a single SolverTaskCblk task. The 2D cblks are
+ * split into a SolverTaskCblk task that factorizes the diagonal block, one
+ * SolverTaskTrsm task per set of off-diagonal blocks facing the same cblk, and
+ * one SolverTaskGemm task per off-diagonal block to apply the updates.
+ */
+typedef enum solver_task_e {
+    SolverTaskCblk = 0, /**< Task on a cblk, indexed by its cblknum  */
+    SolverTaskTrsm = 1, /**< TRSM task, indexed by its first bloknum */
+    SolverTaskGemm = 2  /**< GEMM task, indexed by its bloknum       */
+} solver_task_t;
+
+/**
+ * @brief     Encode a task of the dynamic scheduler as a queue element.
+ * @param[in] solvmtx
+ *            The solver matrix structure.
+ * @param[in] type
+ *            The type of the task.
+ * @param[in] num
+ *            The cblk index for SolverTaskCblk, the block index otherwise.
+ * @return    The element to push in the computeQueues.
+ */
+static inline pastix_int_t
+solver_task_encode( const SolverMatrix *solvmtx,
+                    solver_task_t       type,
+                    pastix_int_t        num )
+{
+    switch( type ) {
+    case SolverTaskTrsm:
+        return solvmtx->cblknbr + num;
+    case SolverTaskGemm:
+        return solvmtx->cblknbr + solvmtx->bloknbr + num;
+    case SolverTaskCblk:
+    default:
+        return num;
+    }
+}
+
+/**
+ * @brief        Decode an element of the computeQueues of the dynamic scheduler.
+ * @param[in]    solvmtx
+ *               The solver matrix structure.
+ * @param[inout] num
+ *               On entry, the element popped from a queue. On exit, the cblk
+ *               index for SolverTaskCblk, the block index otherwise.
+ * @return       The type of the task.
+ */
+static inline solver_task_t
+solver_task_decode( const SolverMatrix *solvmtx,
+                    pastix_int_t       *num )
+{
+    if ( *num < solvmtx->cblknbr ) {
+        return SolverTaskCblk;
+    }
+    *num -= solvmtx->cblknbr;
+    if ( *num < solvmtx->bloknbr ) {
+        return SolverTaskTrsm;
+    }
+    *num -= solvmtx->bloknbr;
+    return SolverTaskGemm;
+}
+
 void solverInit( SolverMatrix *solvmtx );
 void solverExit( SolverMatrix *solvmtx );
 
@@ -549,6 +673,23 @@ int           solverDraw      ( const SolverMatrix *solvptr,
                                 const char         *directory );
 void          solverPrintStats( const SolverMatrix *solvptr );
 
+void         solverThrdStatsInit ( SolverMatrix *solvmtx, int nbthreads );
+void         solverThrdStatsPrint( const SolverMatrix *solvmtx, int procnum );
+pastix_int_t stealQueue( SolverMatrix *solvmtx, isched_thread_t *ctx );
+void         solverIdleWait  ( SolverMatrix *solvmtx, int rank, volatile int32_t *taskcnt );
+void         solverIdleStop  ( SolverMatrix *solvmtx, int rank );
+void         solverIdleWakeup( SolverMatrix *solvmtx, int all );
+void         solverPrefetchNext( const SolverMatrix *solvmtx, pastix_queue_t *queue );
+void         solverCacheStart( SolverMatrix *solvmtx, int rank );
+void         solverCacheStop ( SolverMatrix *solvmtx, int rank );
+pastix_int_t solverSubmit2DTasks( SolverMatrix *solvmtx, pastix_queue_t *queue,
+                                  SolverCblk *cblk, solver_task_t type );
+void         solverTeamRun   ( SolverMatrix *solvmtx, solver_team_fct_t fct, void *args,
+                               pastix_int_t nbitems, void *work, pastix_int_t lwork );
+int          solverTeamHelp  ( SolverMatrix *solvmtx, void *work, pastix_int_t lwork );
+pastix_int_t solverStaticNext( const SolverMatrix *solvmtx, int rank,
+                               pastix_int_t *first, int8_t *done );
+
 void solverRequestInit( solve_step_t  solve_step,
                         SolverMatrix *solvmtx );
 void solverRequestExit( SolverMatrix *solvmtx );
@@ -73,6 +73,39 @@ solver_copy( const SolverMatrix *solvin,
     memcpy(solvout->browtab, solvin->browtab,
            solvout->brownbr*sizeof(pastix_int_t));
 
+    if ( solvin->scattab ) {
+        MALLOC_INTERN(solvout->scattab, solvout->scatnbr, pastix_int_t);
+        memcpy(solvout->scattab, solvin->scattab,
+               solvout->scatnbr*sizeof(pastix_int_t));
+
+        for (solvblok = solvout->bloktab; solvblok < solvout->bloktab + solvout->bloknbr; solvblok++) {
+            if ( solvblok->scatmap != NULL ) {
+                solvblok->scatmap = solvout->scattab + (solvblok->scatmap - solvin->scattab);
+            }
+        }
+    }
+    else {
+        solvout->scattab = NULL;
+    }
+
+    if ( solvin->pivtab ) {
+        MALLOC_INTERN(solvout->pivtab, solvout->nodenbr, pastix_int_t);
+        memcpy(solvout->pivtab, solvin->pivtab,
+               solvout->nodenbr*sizeof(pastix_int_t));
+    }
+    else {
+        solvout->pivtab = NULL;
+    }
+
+    if ( solvin->cblkpivots ) {
+        MALLOC_INTERN(solvout->cblkpivots, solvout->cblknbr, pastix_int_t);
+        memcpy(solvout->cblkpivots, solvin->cblkpivots,
+               solvout->cblknbr*sizeof(pastix_int_t));
+    }
+    else {
+        solvout->cblkpivots = NULL;
+    }
+
     if ( solvin->gcbl2loc ) {
         MALLOC_INTERN(solvout->gcbl2loc, solvout->gcblknbr, pastix_int_t);
         memcpy(solvout->gcbl2loc, solvin->gcbl2loc,
@@ -104,7 +137,7 @@ solver_copy( const SolverMatrix *solvin,
 
                 if ( ucoeftab ) {
                     MALLOC_INTERN( solvcblk->lcoeftab, 2 * size, char );
-                    solvcblk->ucoeftab = (char*)lcoeftab + size;
+                    solvcblk->ucoeftab = (char*)(solvcblk->lcoeftab) + size;
                     memcpy(solvcblk->lcoeftab, lcoeftab, size );
                     memcpy(solvcblk->ucoeftab, ucoeftab, size );
                 }
@@ -197,7 +197,16 @@ solverLoad( SolverMatrix *solvptr,
             solverExit (solvptr);
             return     PASTIX_ERR_FILE;
         }
-
+        blokptr->lock       = PASTIX_ATOMIC_UNLOCKED;
+        blokptr->scatmap    = NULL;
+        blokptr->LRacc[0]   = NULL;
+        blokptr->LRacc[1]   = NULL;
+        blokptr->rkcache[0] = -2;
+        blokptr->rkcache[1] = -2;
+        blokptr->rkskip[0]  = 0;
+        blokptr->rkskip[1]  = 0;
+        blokptr->rktime[0]  = 0.;
+        blokptr->rktime[1]  = 0.;
     }
 
     for (taskptr = solvptr->tasktab,                /** Read Task data **/
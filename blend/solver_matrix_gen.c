@@ -389,6 +389,9 @@ solverMatrixGen( SolverMatrix          *solvmtx,
     solvMatGen_fill_tasktab( solvmtx, isched, simuctrl,
                              tasklocalnum, cblklocalnum,
                              bloklocalnum, ctrl->clustnum, 0 );
+    if ( ctrl->bottomlvl != NULL ) {
+        solvMatGen_set_priorities( solvmtx, ctrl->bottomlvl );
+    }
 
     memFree_null(cblklocalnum);
     memFree_null(bloklocalnum);
@@ -397,6 +400,7 @@ solverMatrixGen( SolverMatrix          *solvmtx,
 
     /* Compute the maximum area of the temporary buffer */
     solvMatGen_max_buffers( solvmtx );
+    solvMatGen_scatter_maps( solvmtx );
     solvMatGen_stats_last( solvmtx );
 
     return PASTIX_SUCCESS;
@@ -614,9 +618,13 @@ solverMatrixGenSeq( SolverMatrix          *solvmtx,
     /* Fill in tasktab */
     solvMatGen_fill_tasktab( solvmtx, isched, simuctrl,
                              NULL, NULL, NULL, ctrl->clustnum, is_dbg );
+    if ( ctrl->bottomlvl != NULL ) {
+        solvMatGen_set_priorities( solvmtx, ctrl->bottomlvl );
+    }
 
     /* Compute the maximum area of the temporary buffer */
     solvMatGen_max_buffers( solvmtx );
+    solvMatGen_scatter_maps( solvmtx );
     solvMatGen_stats_last( solvmtx );
 
     return PASTIX_SUCCESS;
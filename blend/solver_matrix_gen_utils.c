@@ -23,6 +23,7 @@
 #include "common.h"
 #include "symbol/symbol.h"
 #include "blend/solver.h"
+#include "kernels/queue.h"
 #include "elimintree.h"
 #include "cost.h"
 #include "cand.h"
@@ -704,6 +705,57 @@ solvMatGen_fill_tasktab( SolverMatrix       *solvmtx,
     }
 }
 
+/**
+ *******************************************************************************
+ *
+ * @brief Replace the priorities of the cblks by their critical path order.
+ *
+ * The cblks with a task are sorted by decreasing bottom level, and their
+ * priority is replaced by their rank in this order. The priorities thus keep
+ * the same range as the ones given by the simulation, such that the queues of
+ * the dynamic scheduler, and the backward solve, are unchanged. The task
+ * priorities used by the static scheduler are not modified.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] solvmtx
+ *          Pointer to the solver matrix. On exit, the priority field of the
+ *          local cblks with a task is updated.
+ *
+ * @param[in] bottomlvl
+ *          Array of the bottom levels of the cblks in the global numbering of
+ *          the symbol matrix.
+ *
+ *******************************************************************************/
+void
+solvMatGen_set_priorities( SolverMatrix *solvmtx,
+                           const double *bottomlvl )
+{
+    SolverCblk    *cblk;
+    pastix_queue_t queue;
+    pastix_int_t   i, cblknum, prionum;
+
+    pqueueInit( &queue, solvmtx->tasknbr );
+
+    cblk = solvmtx->cblktab;
+    for( i=0; i<solvmtx->cblknbr; i++, cblk++ ) {
+        if ( (cblk->priority == -1) || (cblk->gcblknum < 0) ) {
+            continue;
+        }
+        pqueuePush2( &queue, i, -bottomlvl[ cblk->gcblknum ], (double)(cblk->priority) );
+    }
+
+    /* Ties are broken with the simulation priority */
+    prionum = 0;
+    while( (cblknum = pqueuePop( &queue )) != -1 ) {
+        solvmtx->cblktab[cblknum].priority = prionum;
+        prionum++;
+    }
+    assert( prionum <= solvmtx->tasknbr );
+
+    pqueueExit( &queue );
+}
+
 /**
  *******************************************************************************
  *
@@ -715,7 +767,8 @@ solvMatGen_fill_tasktab( SolverMatrix       *solvmtx,
  *    - diagmax: Only for hetrf/sytrf factorization, this the maximum size
  *               of a panel of MAXSIZEOFBLOCKS width in a diagonal block
  *    - gemmmax: For all, this is the maximum area used to compute the
- *               compacted gemm on a CPU.
+ *               compacted gemm on a CPU, or to store an off-diagonal block
+ *               scaled by the diagonal for hetrf/sytrf factorizations.
  *
  * Rk: This loop is not merged within the main block loop, since strides have
  * to be peviously computed.
@@ -770,6 +823,12 @@ solvMatGen_max_buffers( SolverMatrix *solvmtx )
                 gemmmax = pastix_imax( gemmmax, gemmarea );
             }
 
+            /*
+             * Block scaled by the diagonal in the full-rank updates of the
+             * LDL^[th] factorizations
+             */
+            gemmmax = pastix_imax( gemmmax, n * k );
+
             /*
              * Max size for off-diagonal blocks for 2-terms version of the
              * 2D LDL
@@ -793,6 +852,91 @@ solvMatGen_max_buffers( SolverMatrix *solvmtx )
     solvmtx->blokmax = blokmax;
 }
 
+/**
+ *******************************************************************************
+ *
+ * @brief Compute the facing blocks of the 1D updates.
+ *
+ * The 1D update generated by an off-diagonal block of a cblk is accumulated
+ * in the work buffer, and then added to the facing cblk block by block. For
+ * each group of off-diagonal blocks facing the same cblk, this function
+ * stores in scattab the index, relatively to the first block of the facing
+ * cblk, of the block receiving the contribution of each block from the first
+ * one of the group down to the last one of the cblk. The blocks of the group
+ * point to their own entry in this map through scatmap, such that the update
+ * kernels do not have to search for the facing blocks anymore.
+ *
+ * Only the updates between two cblks stored with the 1D layout are mapped.
+ *
+ *******************************************************************************
+ *
+ *  @param[inout] solvmtx
+ *           Pointer to the solver matrix.
+ *
+ *******************************************************************************/
+void
+solvMatGen_scatter_maps( SolverMatrix *solvmtx )
+{
+    SolverCblk   *cblk, *fcblk;
+    SolverBlok   *blok, *fblok, *gblok, *iterblok, *lblok;
+    pastix_int_t *scatptr;
+    pastix_int_t  scatnbr = 0;
+    pastix_int_t  i;
+    int           step;
+
+    /* First step counts the entries, second one fills them */
+    for( step=0; step<2; step++ ) {
+        scatptr = solvmtx->scattab;
+        cblk    = solvmtx->cblktab;
+
+        for( i=0; i<solvmtx->cblknbr; i++, cblk++ ) {
+            if ( cblk->cblktype & CBLK_LAYOUT_2D ) {
+                continue;
+            }
+
+            lblok = cblk[1].fblokptr;
+            gblok = NULL;
+            for( blok=cblk->fblokptr+1; blok<lblok; blok++ ) {
+                fcblk = solvmtx->cblktab + blok->fcblknm;
+                if ( fcblk->cblktype & CBLK_LAYOUT_2D ) {
+                    continue;
+                }
+
+                if ( (gblok == NULL) || (gblok->fcblknm != blok->fcblknm) ) {
+                    gblok = blok;
+                    if ( step == 0 ) {
+                        scatnbr += lblok - gblok;
+                        continue;
+                    }
+
+                    fblok = fcblk->fblokptr;
+                    for( iterblok=gblok; iterblok<lblok; iterblok++, scatptr++ ) {
+                        while ( !is_block_inside_fblock( iterblok, fblok ) ) {
+                            fblok++;
+                            assert( fblok < fcblk[1].fblokptr );
+                        }
+                        *scatptr = fblok - fcblk->fblokptr;
+                    }
+                    blok->scatmap = scatptr - (lblok - gblok);
+                }
+                else if ( step == 1 ) {
+                    blok->scatmap = (blok-1)->scatmap + 1;
+                }
+            }
+        }
+
+        if ( step == 0 ) {
+            solvmtx->scatnbr = scatnbr;
+            solvmtx->scattab = NULL;
+            if ( scatnbr == 0 ) {
+                return;
+            }
+            MALLOC_INTERN( solvmtx->scattab, scatnbr, pastix_int_t );
+        }
+    }
+    assert( scatptr == solvmtx->scattab + solvmtx->scatnbr );
+}
+
 /**
  *******************************************************************************
  *
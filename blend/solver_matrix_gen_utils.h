@@ -90,8 +90,18 @@ solvMatGen_init_blok( SolverBlok  *solvblok,
     solvblok->coefind    = layout2D ? stride * nbcols : stride;
     solvblok->browind    = -1;
     solvblok->inlast     = 0;
+    solvblok->lock       = PASTIX_ATOMIC_UNLOCKED;
+    solvblok->scatmap    = NULL;
     solvblok->LRblock[0] = NULL;
     solvblok->LRblock[1] = NULL;
+    solvblok->LRacc[0]   = NULL;
+    solvblok->LRacc[1]   = NULL;
+    solvblok->rkcache[0] = -2;
+    solvblok->rkcache[1] = -2;
+    solvblok->rkskip[0]  = 0;
+    solvblok->rkskip[1]  = 0;
+    solvblok->rktime[0]  = 0.;
+    solvblok->rktime[1]  = 0.;
 }
 
 /**
@@ -328,9 +338,12 @@ void solvMatGen_fill_tasktab( SolverMatrix       *solvmtx,
                               const pastix_int_t *bloklocalnum,
                               pastix_int_t        clustnum,
                               int                 is_dbg );
+void solvMatGen_set_priorities( SolverMatrix *solvmtx,
+                                const double *bottomlvl );
 
 void solvMatGen_stats_last( SolverMatrix *solvmtx );
 void solvMatGen_max_buffers( SolverMatrix *solvmtx );
+void solvMatGen_scatter_maps( SolverMatrix *solvmtx );
 
 void solver_recv_update_fanin( solver_cblk_recv_t   **faninptr,
                                const symbol_matrix_t *symbmtx,
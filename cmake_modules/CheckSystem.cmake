@@ -120,6 +120,39 @@ int main(void) {
   HAVE_BUILTIN_EXPECT
   )
 
+# Check for __builtin_prefetch
+# ----------------------------
+check_c_source_compiles("
+int main(void) {
+  double a[8] = { 0., 0., 0., 0., 0., 0., 0., 0. };
+  __builtin_prefetch( a, 0, 2 );
+  __builtin_prefetch( a + 4, 1, 2 );
+  return (int)a[0];
+}
+"
+  HAVE_BUILTIN_PREFETCH
+  )
+
+# Check for attribute target_clones (function multiversioning)
+# ------------------------------------------------------------
+check_c_source_compiles("
+__attribute__((target_clones(\"avx512f\",\"avx2\",\"default\")))
+static void add( int n, double *a, const double *b ) {
+  int i;
+  for( i=0; i<n; i++ ) {
+    a[i] += b[i];
+  }
+}
+int main(void) {
+  double a[4] = { 0., 0., 0., 0. };
+  double b[4] = { 1., 1., 1., 1. };
+  add( 4, a, b );
+  return 0;
+}
+"
+  HAVE_TARGET_CLONES
+  )
+
 # Check for Thread library
 # ------------------------
 set( CMAKE_THREAD_PREFER_PTHREAD TRUE )
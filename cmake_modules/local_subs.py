@@ -42,6 +42,7 @@ subs = {
         ('',                     'spotrf',               'dpotrf',               'cpxtrf',               'zpxtrf'              ),
         ('',                     'srqrcp',               'drqrcp',               'crqrcp',               'zrqrcp'              ),
         ('',                     'srqrrt',               'drqrrt',               'crqrrt',               'zrqrrt'              ),
+        ('',                     'sarrf',                'darrf',                'carrf',                'zarrf'               ),
         ('',                     'stqrcp',               'dtqrcp',               'ctqrcp',               'ztqrcp'              ),
         ('',                     'sxx2fr',               'dxx2fr',               'cxx2fr',               'zxx2fr'              ),
         ('',                     'sxx2lr',               'dxx2lr',               'cxx2lr',               'zxx2lr'              ),
@@ -36,6 +36,7 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include "models.h"
+#include "kernels/kernels.h"
 #if defined(PASTIX_WITH_PARSEC)
 #include "sopalin/parsec/pastix_parsec.h"
 #endif
@@ -501,6 +502,7 @@ pastixInitParam( pastix_int_t *iparm,
     iparm[IPARM_STATIC_PIVOTING]       = 0;
     iparm[IPARM_FREE_CSCUSER]          = 0;
     iparm[IPARM_SCHUR_FACT_MODE]       = PastixFactModeLocal;
+    iparm[IPARM_FACTO_LU_FUSED]        = 0;
 
     /* Solve */
     iparm[IPARM_TRANSPOSE_SOLVE]       = PastixNoTrans;
@@ -515,6 +517,14 @@ pastixInitParam( pastix_int_t *iparm,
 
     /* Context */
     iparm[IPARM_SCHEDULER]             = PastixSchedDynamic;
+    iparm[IPARM_SCHED_QUEUE]           = PastixSchedQueueHeap;
+    iparm[IPARM_SCHED_STEAL]           = PastixSchedStealLocality;
+    iparm[IPARM_SCHED_IDLE]            = PastixSchedIdlePark;
+    iparm[IPARM_SCHED_PRIORITY]        = PastixSchedPrioSimulation;
+    iparm[IPARM_SCHED_DISPATCH]        = PastixSchedDispatchSleep;
+    iparm[IPARM_SCHED_LOOKAHEAD]       = 0;
+    iparm[IPARM_SCHED_TEAM_WIDTH]      = 0;
+    iparm[IPARM_SCHED_PREFETCH]        = 0;
     iparm[IPARM_THREAD_NBR]            = -1;
     iparm[IPARM_SOCKET_NBR]            = -1;
     iparm[IPARM_AUTOSPLIT_COMM]        = 0;
@@ -533,6 +543,10 @@ pastixInitParam( pastix_int_t *iparm,
     iparm[IPARM_COMPRESS_ORTHO]        = PastixCompressOrthoCGS;
     iparm[IPARM_COMPRESS_PRESELECT]    = 1;
     iparm[IPARM_COMPRESS_ILUK]         = -2;
+    iparm[IPARM_COMPRESS_DEFERRED]     = 0;
+    iparm[IPARM_COMPRESS_TEAM_BLOKNBR] = 0;
+    iparm[IPARM_COMPRESS_RANK_CACHE]   = 0;
+    iparm[IPARM_COMPRESS_MEM_POOL]     = 0;
 
     /* Mixed-Precision */
     iparm[IPARM_MIXED] = 0;
@@ -552,6 +566,7 @@ pastixInitParam( pastix_int_t *iparm,
     dparm[DPARM_EPSILON_REFINEMENT] = -1.;
     dparm[DPARM_RELATIVE_ERROR]     = -1.;
     dparm[DPARM_EPSILON_MAGN_CTRL]  =  0.;
+    dparm[DPARM_PIVOT_THRESHOLD]    =  0.;
     dparm[DPARM_ANALYZE_TIME]       =  0.;
     dparm[DPARM_PRED_FACT_TIME]     =  0.;
     dparm[DPARM_FACT_TIME]          =  0.;
@@ -562,6 +577,7 @@ pastixInitParam( pastix_int_t *iparm,
     dparm[DPARM_FACT_ENERGY]        =  0.;
     dparm[DPARM_MEM_FR]             =  0.;
     dparm[DPARM_MEM_LR]             =  0.;
+    dparm[DPARM_MEM_LR_PEAK]        =  0.;
     dparm[DPARM_SOLV_FLOPS]         =  0.;
     dparm[DPARM_SOLV_THFLOPS]       =  0.;
     dparm[DPARM_SOLV_RLFLOPS]       =  0.;
@@ -665,12 +681,8 @@ apiInitMPI( pastix_data_t *pastix,
  *
  * @ingroup pastix_api
  *
- * @brief Initialize the solver instance with a bintab array to specify the
- * thread binding.
- *
- * @remark You should always prefer the pastixInit() function when hwloc is
- * available, and use the pastixInitWithAffinity() function only if you know
- * what you want to do with your threads.
+ * @brief Internal function to initialize the solver instance, either with its
+ * own threads or attached to a shared pool.
  *
  *******************************************************************************
  *
@@ -688,20 +700,20 @@ apiInitMPI( pastix_data_t *pastix,
  *
  * @param[in] bindtab
  *          Integer array of size iparm[IPARM_THREAD_NBR] that will specify the
- *          thread binding. NULL if let to the system.
- *          Each thread i will be bound to to the core bindtab[i] if
- *          bindtab[i] >= 0, or not bound if bindtab[i] < 0.
- *          If other libraries of the main application are spawning their own threads
- *          too (eg. OpenMP), we strongly recommend not to bind the main thread,
- *          and let bindtab[0] = -1 to avoid binding impact on other libraries.
+ *          thread binding. NULL if let to the system. Unused if pool != NULL.
+ *
+ * @param[inout] pool
+ *          The shared pool of threads, NULL if the instance starts its own
+ *          threads.
  *
  *******************************************************************************/
-void
-pastixInitWithAffinity( pastix_data_t **pastix_data,
-                        PASTIX_Comm     pastix_comm,
-                        pastix_int_t   *iparm,
-                        double         *dparm,
-                        const int      *bindtab )
+static void
+apiInit( pastix_data_t **pastix_data,
+         PASTIX_Comm     pastix_comm,
+         pastix_int_t   *iparm,
+         double         *dparm,
+         const int      *bindtab,
+         pastix_pool_t  *pool )
 {
     pastix_data_t *pastix;
 
@@ -801,9 +813,28 @@ pastixInitWithAffinity( pastix_data_t **pastix_data,
 #endif
 
     /*
-     * Start the internal threads
+     * Start the internal threads, or attach the instance to a shared pool
      */
-    pastix->isched = ischedInit( pastix->iparm[IPARM_THREAD_NBR], bindtab );
+    if ( pool != NULL ) {
+        pastix->pool   = pool;
+        pastix->isched = ischedPoolAttach( pool );
+        if ( (iparm[IPARM_THREAD_NBR] != -1) &&
+             (iparm[IPARM_THREAD_NBR] != pastix->isched->world_size) )
+        {
+            pastix_print( pastix->procnum, 0,
+                          "WARNING: Thread number forced by the shared pool partition size\n" );
+        }
+        if ( iparm[IPARM_SCHED_DISPATCH] != PastixSchedDispatchSleep ) {
+            pastix_print( pastix->procnum, 0,
+                          "WARNING: Spin dispatch mode is not supported by shared pools, sleep mode is used\n" );
+            iparm[IPARM_SCHED_DISPATCH] = PastixSchedDispatchSleep;
+        }
+    }
+    else {
+        pastix->pool   = NULL;
+        pastix->isched = ischedInit( pastix->iparm[IPARM_THREAD_NBR], bindtab,
+                                     iparm[IPARM_SCHED_DISPATCH] == PastixSchedDispatchSpin );
+    }
     pastix->iparm[IPARM_THREAD_NBR] = pastix->isched->world_size;
 
     if ( ( pastix->iparm[IPARM_SOCKET_NBR] == -1 ) ||
@@ -852,6 +883,7 @@ pastixInitWithAffinity( pastix_data_t **pastix_data,
     pastix->dir_local  = NULL;
 
     pastixModelsLoad( pastix );
+    kernelsSmallInit();
 
     if (iparm[IPARM_VERBOSE] > PastixVerboseNot) {
         pastixWelcome( pastix );
@@ -865,6 +897,99 @@ pastixInitWithAffinity( pastix_data_t **pastix_data,
     *pastix_data = pastix;
 }
 
+/**
+ *******************************************************************************
+ *
+ * @ingroup pastix_api
+ *
+ * @brief Initialize the solver instance with a bintab array to specify the
+ * thread binding.
+ *
+ * @remark You should always prefer the pastixInit() function when hwloc is
+ * available, and use the pastixInitWithAffinity() function only if you know
+ * what you want to do with your threads.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] pastix_data
+ *          The main data structure.
+ *
+ * @param[in] pastix_comm
+ *          The MPI communicator.
+ *
+ * @param[inout] iparm
+ *          The integer array of parameters to initialize.
+ *
+ * @param[inout] dparm
+ *          The floating point array of parameters to initialize.
+ *
+ * @param[in] bindtab
+ *          Integer array of size iparm[IPARM_THREAD_NBR] that will specify the
+ *          thread binding. NULL if let to the system.
+ *          Each thread i will be bound to to the core bindtab[i] if
+ *          bindtab[i] >= 0, or not bound if bindtab[i] < 0.
+ *          If other libraries of the main application are spawning their own threads
+ *          too (eg. OpenMP), we strongly recommend not to bind the main thread,
+ *          and let bindtab[0] = -1 to avoid binding impact on other libraries.
+ *
+ *******************************************************************************/
+void
+pastixInitWithAffinity( pastix_data_t **pastix_data,
+                        PASTIX_Comm     pastix_comm,
+                        pastix_int_t   *iparm,
+                        double         *dparm,
+                        const int      *bindtab )
+{
+    apiInit( pastix_data, pastix_comm, iparm, dparm, bindtab, NULL );
+}
+
+/**
+ *******************************************************************************
+ *
+ * @ingroup pastix_api
+ *
+ * @brief Initialize the solver instance on a thread pool shared with other
+ * instances.
+ *
+ * The instance does not start its own threads, but is attached to the pool.
+ * iparm[IPARM_THREAD_NBR] is set to the size of the partitions. Each parallel
+ * step of the instance is executed by a free partition, preferably the one to
+ * which the instance is attached, and is queued only if all the partitions
+ * are busy.
+ *
+ * The threads of a partition are shared, so they can not poll for the calls
+ * of one instance: iparm[IPARM_SCHED_DISPATCH] is forced to
+ * PastixSchedDispatchSleep.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] pastix_data
+ *          The main data structure.
+ *
+ * @param[in] pastix_comm
+ *          The MPI communicator.
+ *
+ * @param[inout] iparm
+ *          The integer array of parameters to initialize.
+ *
+ * @param[inout] dparm
+ *          The floating point array of parameters to initialize.
+ *
+ * @param[inout] pool
+ *          The pool created with pastixPoolInit(). It must not be finalized
+ *          before the instance.
+ *
+ *******************************************************************************/
+void
+pastixInitWithPool( pastix_data_t **pastix_data,
+                    PASTIX_Comm     pastix_comm,
+                    pastix_int_t   *iparm,
+                    double         *dparm,
+                    pastix_pool_t  *pool )
+{
+    apiInit( pastix_data, pastix_comm, iparm, dparm, NULL, pool );
+}
+
 /**
  *******************************************************************************
  *
@@ -919,7 +1044,12 @@ pastixFinalize( pastix_data_t **pastix_data )
 
     pastixSummary( *pastix_data );
 
-    ischedFinalize( pastix->isched );
+    if ( pastix->pool != NULL ) {
+        ischedPoolDetach( pastix->pool, pastix->isched );
+    }
+    else {
+        ischedFinalize( pastix->isched );
+    }
 
     if ( pastix->graph != NULL )
     {
@@ -1081,3 +1211,95 @@ pastixCheckParam( const pastix_int_t *iparm,
 
     return irc + drc;
 }
+
+/**
+ *******************************************************************************
+ *
+ * @ingroup pastix_api
+ *
+ * @brief Create a pool of threads that can be shared by several instances of
+ * the solver.
+ *
+ * The cores of the pool are split in partnbr partitions of cores/partnbr
+ * threads. Each parallel step of an instance initialized with
+ * pastixInitWithPool() is executed by a free partition, such that independent
+ * problems run concurrently on disjoint sets of cores, and are queued only
+ * when all the partitions are busy. The first thread of each partition is the
+ * one calling the solver, and is never bound.
+ *
+ *******************************************************************************
+ *
+ * @param[out] pool
+ *          On exit, the pool of threads.
+ *
+ * @param[in] cores
+ *          Number of cores of the pool. If cores < 1, PASTIX_NUM_THREADS or
+ *          the number of cores of the system is used.
+ *
+ * @param[in] partnbr
+ *          Number of partitions of the pool, between 1 and cores. It must
+ *          divide cores.
+ *
+ * @param[in] bindtab
+ *          Integer array of size cores that specifies the binding of the
+ *          threads of the pool. NULL if the identity distribution is used.
+ *
+ *******************************************************************************
+ *
+ * @retval PASTIX_SUCCESS on successful exit,
+ * @retval PASTIX_ERR_BADPARAMETER if one parameter is incorrect.
+ *
+ *******************************************************************************/
+int
+pastixPoolInit( pastix_pool_t **pool,
+                int             cores,
+                int             partnbr,
+                const int      *bindtab )
+{
+    if ( pool == NULL ) {
+        pastix_print_error( "pastixPoolInit: pool parameter can not be NULL" );
+        return PASTIX_ERR_BADPARAMETER;
+    }
+
+    *pool = ischedPoolInit( cores, partnbr, bindtab );
+    if ( *pool == NULL ) {
+        return PASTIX_ERR_BADPARAMETER;
+    }
+    return PASTIX_SUCCESS;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @ingroup pastix_api
+ *
+ * @brief Destroy a pool of threads created with pastixPoolInit().
+ *
+ *******************************************************************************
+ *
+ * @param[inout] pool
+ *          The pool to destroy. All the instances attached to the pool must
+ *          have been finalized. On exit, *pool is set to NULL.
+ *
+ *******************************************************************************
+ *
+ * @retval PASTIX_SUCCESS on successful exit,
+ * @retval PASTIX_ERR_BADPARAMETER if instances are still attached to the pool.
+ *
+ *******************************************************************************/
+int
+pastixPoolFinalize( pastix_pool_t **pool )
+{
+    int rc;
+
+    if ( (pool == NULL) || (*pool == NULL) ) {
+        pastix_print_error( "pastixPoolFinalize: pool parameter can not be NULL" );
+        return PASTIX_ERR_BADPARAMETER;
+    }
+
+    rc = ischedPoolFinalize( *pool );
+    if ( rc == PASTIX_SUCCESS ) {
+        *pool = NULL;
+    }
+    return rc;
+}
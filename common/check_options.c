@@ -162,6 +162,58 @@ pastix_scheduler_check_value( pastix_scheduler_t value )
     return 1;
 }
 
+static inline int
+pastix_sched_queue_check_value( pastix_sched_queue_t value )
+{
+    if( (value == PastixSchedQueueHeap) ||
+        (value == PastixSchedQueueWorkStealing) ) {
+        return 0;
+    }
+    return 1;
+}
+
+static inline int
+pastix_sched_steal_check_value( pastix_sched_steal_t value )
+{
+    if( (value == PastixSchedStealRoundRobin) ||
+        (value == PastixSchedStealLocality) ||
+        (value == PastixSchedStealLocalityRandom) ) {
+        return 0;
+    }
+    return 1;
+}
+
+static inline int
+pastix_sched_idle_check_value( pastix_sched_idle_t value )
+{
+    if( (value == PastixSchedIdleSpin) ||
+        (value == PastixSchedIdleBackoff) ||
+        (value == PastixSchedIdlePark) ) {
+        return 0;
+    }
+    return 1;
+}
+
+static inline int
+pastix_sched_prio_check_value( pastix_sched_prio_t value )
+{
+    if( (value == PastixSchedPrioSimulation) ||
+        (value == PastixSchedPrioCriticalPath) ) {
+        return 0;
+    }
+    return 1;
+}
+
+static inline int
+pastix_sched_dispatch_check_value( pastix_sched_dispatch_t value )
+{
+    if( (value == PastixSchedDispatchSleep) ||
+        (value == PastixSchedDispatchSpin) ) {
+        return 0;
+    }
+    return 1;
+}
+
 static inline int
 pastix_compress_when_check_value( pastix_compress_when_t value )
 {
@@ -182,6 +234,7 @@ pastix_compress_method_check_value( pastix_compress_method_t value )
         (value == PastixCompressMethodRQRCP) ||
         (value == PastixCompressMethodTQRCP) ||
         (value == PastixCompressMethodRQRRT) ||
+        (value == PastixCompressMethodARRF) ||
         (value == PastixCompressMethodNbr) ) {
         return 0;
     }
@@ -604,6 +657,14 @@ iparm_schur_fact_mode_check_value( pastix_int_t iparm )
     return rc;
 }
 
+static inline int
+iparm_facto_lu_fused_check_value( pastix_int_t iparm )
+{
+    /* TODO : Check range iparm[IPARM_FACTO_LU_FUSED] */
+    (void)iparm;
+    return 0;
+}
+
 static inline int
 iparm_transpose_solve_check_value( pastix_int_t iparm )
 {
@@ -672,6 +733,85 @@ iparm_scheduler_check_value( pastix_int_t iparm )
     return rc;
 }
 
+static inline int
+iparm_sched_queue_check_value( pastix_int_t iparm )
+{
+    int rc;
+    rc = pastix_sched_queue_check_value( iparm );
+    if ( rc == 1 ) {
+        fprintf(stderr, "IPARM_SCHED_QUEUE: The value is incorrect\n");
+    }
+    return rc;
+}
+
+static inline int
+iparm_sched_steal_check_value( pastix_int_t iparm )
+{
+    int rc;
+    rc = pastix_sched_steal_check_value( iparm );
+    if ( rc == 1 ) {
+        fprintf(stderr, "IPARM_SCHED_STEAL: The value is incorrect\n");
+    }
+    return rc;
+}
+
+static inline int
+iparm_sched_idle_check_value( pastix_int_t iparm )
+{
+    int rc;
+    rc = pastix_sched_idle_check_value( iparm );
+    if ( rc == 1 ) {
+        fprintf(stderr, "IPARM_SCHED_IDLE: The value is incorrect\n");
+    }
+    return rc;
+}
+
+static inline int
+iparm_sched_priority_check_value( pastix_int_t iparm )
+{
+    int rc;
+    rc = pastix_sched_prio_check_value( iparm );
+    if ( rc == 1 ) {
+        fprintf(stderr, "IPARM_SCHED_PRIORITY: The value is incorrect\n");
+    }
+    return rc;
+}
+
+static inline int
+iparm_sched_dispatch_check_value( pastix_int_t iparm )
+{
+    int rc;
+    rc = pastix_sched_dispatch_check_value( iparm );
+    if ( rc == 1 ) {
+        fprintf(stderr, "IPARM_SCHED_DISPATCH: The value is incorrect\n");
+    }
+    return rc;
+}
+
+static inline int
+iparm_sched_lookahead_check_value( pastix_int_t iparm )
+{
+    /* TODO : Check range iparm[IPARM_SCHED_LOOKAHEAD] */
+    (void)iparm;
+    return 0;
+}
+
+static inline int
+iparm_sched_team_width_check_value( pastix_int_t iparm )
+{
+    /* TODO : Check range iparm[IPARM_SCHED_TEAM_WIDTH] */
+    (void)iparm;
+    return 0;
+}
+
+static inline int
+iparm_sched_prefetch_check_value( pastix_int_t iparm )
+{
+    /* TODO : Check range iparm[IPARM_SCHED_PREFETCH] */
+    (void)iparm;
+    return 0;
+}
+
 static inline int
 iparm_thread_nbr_check_value( pastix_int_t iparm )
 {
@@ -801,6 +941,38 @@ iparm_compress_iluk_check_value( pastix_int_t iparm )
     return 0;
 }
 
+static inline int
+iparm_compress_deferred_check_value( pastix_int_t iparm )
+{
+    /* TODO : Check range iparm[IPARM_COMPRESS_DEFERRED] */
+    (void)iparm;
+    return 0;
+}
+
+static inline int
+iparm_compress_team_bloknbr_check_value( pastix_int_t iparm )
+{
+    /* TODO : Check range iparm[IPARM_COMPRESS_TEAM_BLOKNBR] */
+    (void)iparm;
+    return 0;
+}
+
+static inline int
+iparm_compress_rank_cache_check_value( pastix_int_t iparm )
+{
+    /* TODO : Check range iparm[IPARM_COMPRESS_RANK_CACHE] */
+    (void)iparm;
+    return 0;
+}
+
+static inline int
+iparm_compress_mem_pool_check_value( pastix_int_t iparm )
+{
+    /* TODO : Check range iparm[IPARM_COMPRESS_MEM_POOL] */
+    (void)iparm;
+    return 0;
+}
+
 static inline int
 iparm_mixed_check_value( pastix_int_t iparm )
 {
@@ -879,6 +1051,14 @@ dparm_epsilon_magn_ctrl_check_value( double dparm )
     return 0;
 }
 
+static inline int
+dparm_pivot_threshold_check_value( double dparm )
+{
+    /* TODO : Check range dparm[DPARM_PIVOT_THRESHOLD] */
+    (void)dparm;
+    return 0;
+}
+
 static inline int
 dparm_compress_tolerance_check_value( double dparm )
 {
@@ -958,6 +1138,7 @@ iparm_check_values( const pastix_int_t *iparm )
     error += iparm_facto_look_side_check_value( iparm[IPARM_FACTO_LOOK_SIDE] );
     error += iparm_free_cscuser_check_value( iparm[IPARM_FREE_CSCUSER] );
     error += iparm_schur_fact_mode_check_value( iparm[IPARM_SCHUR_FACT_MODE] );
+    error += iparm_facto_lu_fused_check_value( iparm[IPARM_FACTO_LU_FUSED] );
     error += iparm_transpose_solve_check_value( iparm[IPARM_TRANSPOSE_SOLVE] );
     error += iparm_schur_solv_mode_check_value( iparm[IPARM_SCHUR_SOLV_MODE] );
     error += iparm_applyperm_ws_check_value( iparm[IPARM_APPLYPERM_WS] );
@@ -965,6 +1146,14 @@ iparm_check_values( const pastix_int_t *iparm )
     error += iparm_itermax_check_value( iparm[IPARM_ITERMAX] );
     error += iparm_gmres_im_check_value( iparm[IPARM_GMRES_IM] );
     error += iparm_scheduler_check_value( iparm[IPARM_SCHEDULER] );
+    error += iparm_sched_queue_check_value( iparm[IPARM_SCHED_QUEUE] );
+    error += iparm_sched_steal_check_value( iparm[IPARM_SCHED_STEAL] );
+    error += iparm_sched_idle_check_value( iparm[IPARM_SCHED_IDLE] );
+    error += iparm_sched_priority_check_value( iparm[IPARM_SCHED_PRIORITY] );
+    error += iparm_sched_dispatch_check_value( iparm[IPARM_SCHED_DISPATCH] );
+    error += iparm_sched_lookahead_check_value( iparm[IPARM_SCHED_LOOKAHEAD] );
+    error += iparm_sched_team_width_check_value( iparm[IPARM_SCHED_TEAM_WIDTH] );
+    error += iparm_sched_prefetch_check_value( iparm[IPARM_SCHED_PREFETCH] );
     error += iparm_thread_nbr_check_value( iparm[IPARM_THREAD_NBR] );
     error += iparm_socket_nbr_check_value( iparm[IPARM_SOCKET_NBR] );
     error += iparm_autosplit_comm_check_value( iparm[IPARM_AUTOSPLIT_COMM] );
@@ -980,6 +1169,10 @@ iparm_check_values( const pastix_int_t *iparm )
     error += iparm_compress_reltol_check_value( iparm[IPARM_COMPRESS_RELTOL] );
     error += iparm_compress_preselect_check_value( iparm[IPARM_COMPRESS_PRESELECT] );
     error += iparm_compress_iluk_check_value( iparm[IPARM_COMPRESS_ILUK] );
+    error += iparm_compress_deferred_check_value( iparm[IPARM_COMPRESS_DEFERRED] );
+    error += iparm_compress_team_bloknbr_check_value( iparm[IPARM_COMPRESS_TEAM_BLOKNBR] );
+    error += iparm_compress_rank_cache_check_value( iparm[IPARM_COMPRESS_RANK_CACHE] );
+    error += iparm_compress_mem_pool_check_value( iparm[IPARM_COMPRESS_MEM_POOL] );
     error += iparm_mixed_check_value( iparm[IPARM_MIXED] );
     error += iparm_ftz_check_value( iparm[IPARM_FTZ] );
     error += iparm_modify_parameter_check_value( iparm[IPARM_MODIFY_PARAMETER] );
@@ -1011,6 +1204,7 @@ dparm_check_values( const double *dparm )
     int error = 0;
     error += dparm_epsilon_refinement_check_value( dparm[DPARM_EPSILON_REFINEMENT] );
     error += dparm_epsilon_magn_ctrl_check_value( dparm[DPARM_EPSILON_MAGN_CTRL] );
+    error += dparm_pivot_threshold_check_value( dparm[DPARM_PIVOT_THRESHOLD] );
     error += dparm_compress_tolerance_check_value( dparm[DPARM_COMPRESS_TOLERANCE] );
     error += dparm_compress_min_ratio_check_value( dparm[DPARM_COMPRESS_MIN_RATIO] );
     return error;
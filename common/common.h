@@ -66,6 +66,38 @@
 #define pastix_unlikely( _x_ ) ( _x_ )
 #endif
 
+/*
+ * Non-blocking prefetch of a cache line in the L2 cache, for a later read or
+ * write access
+ */
+#if defined(HAVE_BUILTIN_PREFETCH)
+#define pastix_prefetch_read( _ptr_ )  __builtin_prefetch( (_ptr_), 0, 2 )
+#define pastix_prefetch_write( _ptr_ ) __builtin_prefetch( (_ptr_), 1, 2 )
+#else
+#define pastix_prefetch_read( _ptr_ )  do { (void)(_ptr_); } while(0)
+#define pastix_prefetch_write( _ptr_ ) do { (void)(_ptr_); } while(0)
+#endif
+
+/*
+ * Generates the AVX-512, AVX2 and generic versions of a function, the best
+ * one being selected at runtime
+ */
+#if defined(HAVE_TARGET_CLONES)
+#define pastix_target_clones __attribute__((target_clones("avx512f","avx2","default")))
+#else
+#define pastix_target_clones
+#endif
+
+/*
+ * Forces the inlining of the templates instantiated for several compile-time
+ * dimensions
+ */
+#if defined(__GNUC__)
+#define pastix_always_inline inline __attribute__((always_inline))
+#else
+#define pastix_always_inline inline
+#endif
+
 #if defined(PASTIX_OS_WINDOWS)
 #include <windows.h>
 #define COMMON_RANDOM_RAND 1
@@ -38,6 +38,18 @@ extern kern_return_t thread_policy_set( thread_t               thread,
                                         mach_msg_type_number_t count);
 #endif  /* define(HAVE_HWLOC) */
 
+/**
+ * Number of polling iterations of the spinning threads before they start
+ * to yield their core at each iteration.
+ */
+#define ISCHED_SPIN_YIELD 4096
+
+/**
+ * Number of polling iterations of the spinning threads before they sleep on
+ * the status condition until the next parallel call.
+ */
+#define ISCHED_SPIN_SLEEP (1 << 14)
+
 #if ISCHED_IMPLEMENT_BARRIERS
 
 int
@@ -52,6 +64,7 @@ isched_barrier_init(isched_barrier_t* barrier,
     }
 
     barrier->count      = count;
+    barrier->spin       = 0;
     barrier->curcount   = 0;
     barrier->generation = 0;
     if( 0 != (rc = pthread_cond_init(&(barrier->cond), NULL)) ) {
@@ -66,6 +79,29 @@ isched_barrier_wait(isched_barrier_t* barrier)
 {
     int generation;
 
+    /*
+     * Spinning barrier: the generation plays the role of the sense that is
+     * reversed by the last thread to release the others.
+     */
+    if ( barrier->spin ) {
+        int spin = 0;
+
+        generation = barrier->generation;
+        if ( pastix_atomic_add_32b( (volatile int32_t*)&(barrier->curcount), 1 ) == barrier->count ) {
+            barrier->curcount = 0;
+            pastix_mfence();
+            barrier->generation++;
+            return 1;
+        }
+        while ( generation == barrier->generation ) {
+            spin++;
+            if ( spin > ISCHED_SPIN_YIELD ) {
+                sched_yield();
+            }
+        }
+        return 0;
+    }
+
     pthread_mutex_lock( &(barrier->mutex) );
     if( (barrier->curcount + 1) == barrier->count) {
         barrier->generation++;
@@ -125,10 +161,22 @@ isched_thread_init(void *ptr)
     thread_ctx->global_ctx = isched->global_ctx;
     thread_ctx->rank       = isched->rank;
     thread_ctx->bindto     = isched->bindto;
+    thread_ctx->seed       = isched->rank + 1;
 
-    /* Set thread affinity for the worker */
+    /*
+     * Set thread affinity for the worker. The core index is taken modulo the
+     * number of cores of the machine, and not of the scheduler, such that
+     * several schedulers can be bound to disjoint sets of cores.
+     */
     if ( isched->bindto >= 0 ) {
-        isched_topo_bind_on_core_index( isched->bindto % isched->global_ctx->world_size );
+        isched_topo_bind_on_core_index( isched->bindto % isched_topo_world_size() );
+    }
+
+    /* Store the socket of the worker, the master is considered on the socket of the first core */
+    {
+        int core = (isched->bindto >= 0) ? isched->bindto : isched->rank;
+        isched->global_ctx->socketids[ isched->rank ] =
+            isched_topo_socket_id( core % isched_topo_world_size() );
     }
 
     if ( thread_ctx->rank != 0 ) {
@@ -163,6 +211,50 @@ isched_parallel_section(isched_thread_t *ctx)
     /* Wait for everyone but the master thread to enter this section */
     isched_barrier_wait( &(isched->barrier) );
 
+    if ( isched->spinning ) {
+        int32_t callgen = 0;
+        int     spin;
+
+        while(1) {
+            /*
+             * Poll the call generation, yield the core after a while, and
+             * finally sleep until the next call
+             */
+            spin = 0;
+            while ( isched->callgen == callgen ) {
+                spin++;
+                if ( spin > ISCHED_SPIN_SLEEP ) {
+                    pthread_mutex_lock( &(isched->statuslock) );
+                    pastix_atomic_inc_32b( &(isched->sleeping) );
+                    pastix_mfence();
+                    while ( isched->callgen == callgen ) {
+                        pthread_cond_wait( &(isched->statuscond), &(isched->statuslock) );
+                    }
+                    pastix_atomic_dec_32b( &(isched->sleeping) );
+                    pthread_mutex_unlock( &(isched->statuslock) );
+                }
+                else if ( spin > ISCHED_SPIN_YIELD ) {
+                    sched_yield();
+                }
+            }
+            pastix_mfence();
+            callgen = isched->callgen;
+            action  = isched->status;
+
+            switch (action) {
+                case ISCHED_ACT_PARALLEL:
+                    isched->pfunc( ctx, isched->pargs );
+                    break;
+                case ISCHED_ACT_FINALIZE:
+                    return isched_thread_destroy( ctx );
+                default:
+                    fprintf(stderr, "isched_parallel_section: undefined action\n");
+                    return NULL;
+            }
+            isched_barrier_wait(&(isched->barrier) );
+        }
+    }
+
     while(1) {
         pthread_mutex_lock( &(isched->statuslock) );
         while ((action = isched->status) == ISCHED_ACT_STAND_BY)
@@ -206,12 +298,17 @@ isched_parallel_section(isched_thread_t *ctx)
  *          provided, or to coresbind[i] otherwise.
  *          If coresbind = NULL, the identity function distribution is used.
  *
+ * @param[in] spinning
+ *          If true, the threads spin between the parallel calls instead of
+ *          sleeping on a condition variable. This reduces the cost of each
+ *          parallel call, at the price of keeping the cores busy.
+ *
  *******************************************************************************
  *
  * @retval PASTIX_SUCCESS successful exit
  *
  ******************************************************************************/
-isched_t *ischedInit(int cores, const int *coresbind)
+isched_t *ischedInit(int cores, const int *coresbind, int spinning)
 {
     __isched_init_t *initdata;
     isched_t *isched;
@@ -224,12 +321,17 @@ isched_t *ischedInit(int cores, const int *coresbind)
         return NULL;
     }
 
+    pthread_mutex_init(&(isched->calllock), NULL);
     pthread_mutex_init(&(isched->statuslock), NULL);
     pthread_cond_init( &(isched->statuscond), NULL);
     isched->status = ISCHED_ACT_STAND_BY;
+    isched->spinning = spinning;
+    isched->callgen  = 0;
+    isched->sleeping = 0;
 
     isched->pfunc = NULL;
     isched->pargs = NULL;
+    isched->pool  = NULL;
 
     /* Init number of cores and topology */
     isched_topo_init();
@@ -254,6 +356,7 @@ isched_t *ischedInit(int cores, const int *coresbind)
 
     /* Initialize barrier */
     isched_barrier_init( &(isched->barrier), NULL, isched->world_size );
+    isched->barrier.spin = spinning;
 
     /* If the given coresbind is NULL, try to get one from the environment */
     if (coresbind == NULL) {
@@ -261,6 +364,7 @@ isched_t *ischedInit(int cores, const int *coresbind)
     }
 
     MALLOC_INTERN( initdata, isched->world_size, __isched_init_t );
+    MALLOC_INTERN( isched->socketids, isched->world_size, int );
 
     /* Initialize default thread attributes */
     if ( isched->world_size > 1 ) {
@@ -317,12 +421,18 @@ int ischedFinalize(isched_t *isched)
     void *exitcodep;
 
     /* Make sure the threads exit the parallel function */
-    pthread_mutex_lock(&isched->statuslock);
-    isched->status = ISCHED_ACT_FINALIZE;
-    pthread_mutex_unlock(&isched->statuslock);
-    pthread_cond_broadcast(&isched->statuscond);
-    isched_barrier_wait(&(isched->barrier));
-    isched->status = ISCHED_ACT_STAND_BY;
+    if ( isched->spinning ) {
+        isched->status = ISCHED_ACT_FINALIZE;
+        isched_spin_release( isched );
+    }
+    else {
+        pthread_mutex_lock(&isched->statuslock);
+        isched->status = ISCHED_ACT_FINALIZE;
+        pthread_mutex_unlock(&isched->statuslock);
+        pthread_cond_broadcast(&isched->statuscond);
+        isched_barrier_wait(&(isched->barrier));
+        isched->status = ISCHED_ACT_STAND_BY;
+    }
 
     // Join threads
     for (core = 1; core < isched->world_size; core++) {
@@ -337,12 +447,304 @@ int ischedFinalize(isched_t *isched)
     isched_thread_destroy( isched->master );
 
     isched_barrier_destroy(&(isched->barrier));
+    pthread_mutex_destroy(&(isched->calllock));
+    pthread_mutex_destroy(&(isched->statuslock));
+    pthread_cond_destroy(&(isched->statuscond));
 
     /* Destroy topology */
     isched_topo_destroy();
 
     memFree_null(isched->tids);
+    memFree_null(isched->socketids);
     memFree_null(isched);
 
     return PASTIX_SUCCESS;
 }
+
+/**
+ *******************************************************************************
+ *
+ * @ingroup pastix_isched
+ *
+ * @brief Initialize a pool of internal schedulers shared by several instances.
+ *
+ * The cores of the pool are split in partnbr partitions of the same size. Each
+ * partition is an independent internal scheduler with its own threads. The
+ * rank 0 of each partition is executed by the thread submitting the parallel
+ * call, and is thus never bound.
+ *
+ * All the partitions have the same size, such that any of them can execute
+ * the parallel calls of any instance attached to the pool.
+ *
+ *******************************************************************************
+ *
+ * @param[in] cores
+ *          Number of cores of the pool.
+ *          If cores < 1, cores = PASTIX_NUM_THREADS if it is set, the
+ *          system number of core otherwise.
+ *
+ * @param[in] partnbr
+ *          Number of partitions of the pool. Must be between 1 and cores, and
+ *          divide cores.
+ *
+ * @param[in] coresbind
+ *          Array of size cores to specify where to bind each thread of the
+ *          pool. If coresbind = NULL, the identity function distribution is
+ *          used.
+ *
+ *******************************************************************************
+ *
+ * @return The pool of schedulers, NULL if the initialization failed.
+ *
+ ******************************************************************************/
+struct pastix_pool_s *
+ischedPoolInit( int cores, int partnbr, const int *coresbind )
+{
+    struct pastix_pool_s *pool;
+    int *bindtab;
+    int  p, i;
+
+    if ( cores < 1 ) {
+        cores = pastix_getenv_get_value_int("PASTIX_NUM_THREADS", -1);
+        if (( cores <= -1 ) || ( cores >= 0x10000 )) { /* 65536 */
+            isched_topo_init();
+            cores = isched_topo_world_size();
+            isched_topo_destroy();
+        }
+    }
+    if ( cores < 1 ) {
+        cores = 1;
+    }
+    if ( (partnbr < 1) || (partnbr > cores) || ((cores % partnbr) != 0) ) {
+        fprintf(stderr, "ischedPoolInit: Incorrect number of partitions (%d) for %d cores\n",
+                partnbr, cores );
+        return NULL;
+    }
+
+    MALLOC_INTERN( pool, 1, struct pastix_pool_s );
+    pool->partnbr  = partnbr;
+    pool->partsize = cores / partnbr;
+    MALLOC_INTERN( pool->partitions, partnbr, isched_t * );
+    MALLOC_INTERN( pool->instnbr,    partnbr, int );
+    pthread_mutex_init( &(pool->lock), NULL );
+    pthread_cond_init( &(pool->cond), NULL );
+
+    MALLOC_INTERN( bindtab, pool->partsize, int );
+    for ( p = 0; p < partnbr; p++ ) {
+        bindtab[0] = -1;
+        for ( i = 1; i < pool->partsize; i++ ) {
+            int core = p * pool->partsize + i;
+            bindtab[i] = (coresbind == NULL) ? core : coresbind[core];
+        }
+        pool->partitions[p] = ischedInit( pool->partsize, bindtab, 0 );
+        pool->instnbr[p]    = 0;
+
+        if ( pool->partitions[p] == NULL ) {
+            fprintf(stderr, "ischedPoolInit: Failed to initialize the partition %d\n", p );
+            for ( i = 0; i < p; i++ ) {
+                ischedFinalize( pool->partitions[i] );
+            }
+            memFree_null( bindtab );
+            pthread_mutex_destroy( &(pool->lock) );
+            pthread_cond_destroy( &(pool->cond) );
+            memFree_null( pool->partitions );
+            memFree_null( pool->instnbr );
+            memFree_null( pool );
+            return NULL;
+        }
+        pool->partitions[p]->pool = pool;
+    }
+    memFree_null( bindtab );
+
+    return pool;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @ingroup pastix_isched
+ *
+ * @brief Finalize a pool of internal schedulers.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] pool
+ *          The pool to finalize. All the instances must have been detached.
+ *
+ *******************************************************************************
+ *
+ * @retval PASTIX_SUCCESS successful exit
+ * @retval PASTIX_ERR_BADPARAMETER if instances are still attached to the pool.
+ *
+ ******************************************************************************/
+int
+ischedPoolFinalize( struct pastix_pool_s *pool )
+{
+    int p;
+
+    for ( p = 0; p < pool->partnbr; p++ ) {
+        if ( pool->instnbr[p] > 0 ) {
+            fprintf(stderr, "ischedPoolFinalize: %d instance(s) still attached to the partition %d\n",
+                    pool->instnbr[p], p );
+            return PASTIX_ERR_BADPARAMETER;
+        }
+    }
+
+    for ( p = 0; p < pool->partnbr; p++ ) {
+        ischedFinalize( pool->partitions[p] );
+    }
+
+    pthread_mutex_destroy( &(pool->lock) );
+    pthread_cond_destroy( &(pool->cond) );
+    memFree_null( pool->partitions );
+    memFree_null( pool->instnbr );
+    memFree_null( pool );
+
+    return PASTIX_SUCCESS;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @ingroup pastix_isched
+ *
+ * @brief Attach an instance to the least loaded partition of the pool.
+ *
+ * The partition is only used to describe the threads of the instance: its
+ * parallel calls are executed by any free partition of the pool.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] pool
+ *          The pool of schedulers.
+ *
+ *******************************************************************************
+ *
+ * @return The internal scheduler of the partition to use.
+ *
+ ******************************************************************************/
+isched_t *
+ischedPoolAttach( struct pastix_pool_s *pool )
+{
+    int p, pmin = 0;
+
+    pthread_mutex_lock( &(pool->lock) );
+    for ( p = 1; p < pool->partnbr; p++ ) {
+        if ( pool->instnbr[p] < pool->instnbr[pmin] ) {
+            pmin = p;
+        }
+    }
+    pool->instnbr[pmin]++;
+    pthread_mutex_unlock( &(pool->lock) );
+
+    return pool->partitions[pmin];
+}
+
+/**
+ *******************************************************************************
+ *
+ * @ingroup pastix_isched
+ *
+ * @brief Detach an instance from its partition of the pool.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] pool
+ *          The pool of schedulers.
+ *
+ * @param[in] isched
+ *          The internal scheduler returned by ischedPoolAttach().
+ *
+ ******************************************************************************/
+void
+ischedPoolDetach( struct pastix_pool_s *pool, isched_t *isched )
+{
+    int p;
+
+    pthread_mutex_lock( &(pool->lock) );
+    for ( p = 0; p < pool->partnbr; p++ ) {
+        if ( pool->partitions[p] == isched ) {
+            assert( pool->instnbr[p] > 0 );
+            pool->instnbr[p]--;
+            break;
+        }
+    }
+    assert( p < pool->partnbr );
+    pthread_mutex_unlock( &(pool->lock) );
+}
+
+/**
+ *******************************************************************************
+ *
+ * @ingroup pastix_isched
+ *
+ * @brief Get a free partition of the pool to execute a parallel call.
+ *
+ * The partition of the instance is tried first to keep its data in the
+ * caches, and then the other ones. If all of them are busy, the caller waits
+ * until one of them is released.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] pool
+ *          The pool of schedulers.
+ *
+ * @param[in] isched
+ *          The partition to which the instance is attached.
+ *
+ *******************************************************************************
+ *
+ * @return The internal scheduler of the partition, with its calllock held.
+ *         It must be given back with ischedPoolRelease().
+ *
+ ******************************************************************************/
+isched_t *
+ischedPoolAcquire( struct pastix_pool_s *pool,
+                   isched_t             *isched )
+{
+    int p;
+
+    pthread_mutex_lock( &(pool->lock) );
+    for (;;) {
+        if ( pthread_mutex_trylock( &(isched->calllock) ) == 0 ) {
+            pthread_mutex_unlock( &(pool->lock) );
+            return isched;
+        }
+        for ( p = 0; p < pool->partnbr; p++ ) {
+            isched_t *part = pool->partitions[p];
+            if ( (part != isched) &&
+                 (pthread_mutex_trylock( &(part->calllock) ) == 0) )
+            {
+                pthread_mutex_unlock( &(pool->lock) );
+                return part;
+            }
+        }
+        pthread_cond_wait( &(pool->cond), &(pool->lock) );
+    }
+}
+
+/**
+ *******************************************************************************
+ *
+ * @ingroup pastix_isched
+ *
+ * @brief Give back a partition acquired with ischedPoolAcquire().
+ *
+ *******************************************************************************
+ *
+ * @param[inout] pool
+ *          The pool of schedulers.
+ *
+ * @param[in] isched
+ *          The internal scheduler of the partition.
+ *
+ ******************************************************************************/
+void
+ischedPoolRelease( struct pastix_pool_s *pool, isched_t *isched )
+{
+    pthread_mutex_unlock( &(isched->calllock) );
+
+    pthread_mutex_lock( &(pool->lock) );
+    pthread_cond_signal( &(pool->cond) );
+    pthread_mutex_unlock( &(pool->lock) );
+}
@@ -30,6 +30,7 @@ enum isched_action_e {
 
 struct isched_s;
 typedef struct isched_s isched_t;
+struct pastix_pool_s;
 
 /**
  * Thread structure of the execution context of one instance of the scheduler
@@ -38,6 +39,7 @@ typedef struct isched_thread_s {
     isched_t        *global_ctx;
     int              rank;
     int              bindto;
+    unsigned int     seed;
 } isched_thread_t;
 
 /**
@@ -46,8 +48,13 @@ typedef struct isched_thread_s {
 struct isched_s {
     int              world_size;
     int              socketsnbr;
+    int             *socketids;
+    int              spinning;
+    volatile int32_t callgen;
+    volatile int32_t sleeping;
 
     isched_barrier_t barrier;
+    pthread_mutex_t  calllock;
     pthread_mutex_t  statuslock;
     pthread_cond_t   statuscond;
     volatile int     status;
@@ -57,6 +64,8 @@ struct isched_s {
 
     void           (*pfunc)(isched_thread_t*, void*);
     void            *pargs;
+
+    struct pastix_pool_s *pool; /* Pool of the scheduler if it is a partition of a pool */
 };
 
 #if defined(HAVE_HWLOC)
@@ -67,6 +76,7 @@ struct isched_s {
 #define isched_topo_unbind             isched_hwloc_unbind
 #define isched_topo_world_size         isched_hwloc_world_size
 #define isched_topo_socketsnbr         isched_hwloc_socketsnbr
+#define isched_topo_socket_id          isched_hwloc_socket_id
 #else
 #define isched_topo_init               isched_nohwloc_init
 #define isched_topo_destroy            isched_nohwloc_destroy
@@ -74,6 +84,7 @@ struct isched_s {
 #define isched_topo_unbind             isched_nohwloc_unbind
 #define isched_topo_world_size         isched_nohwloc_world_size
 #define isched_topo_socketsnbr         isched_nohwloc_socketsnbr
+#define isched_topo_socket_id          isched_nohwloc_socket_id
 #endif
 
 int  isched_topo_init(void);
@@ -82,25 +93,110 @@ int  isched_topo_bind_on_core_index(int);
 int  isched_topo_unbind();
 int  isched_topo_world_size();
 int  isched_topo_socketsnbr();
+int  isched_topo_socket_id(int);
+
+/**
+ * Pool of internal schedulers shared by several instances of the solver. The
+ * cores of the pool are split in partitions of the same size, each one driven
+ * by its own isched_t structure. Each parallel call of an instance is executed
+ * by the first free partition, and is queued only if all the partitions are
+ * busy.
+ */
+struct pastix_pool_s {
+    int              partnbr;    /**< Number of partitions in the pool                 */
+    int              partsize;   /**< Number of cores per partition                    */
+    isched_t       **partitions; /**< Internal scheduler of each partition             */
+    int             *instnbr;    /**< Number of instances attached to each partition   */
+    pthread_mutex_t  lock;       /**< Lock to protect the attachment of the instances  */
+    pthread_cond_t   cond;       /**< Condition signaled when a partition is released  */
+};
+
+isched_t *ischedPoolAcquire( struct pastix_pool_s *pool, isched_t *isched );
+void      ischedPoolRelease( struct pastix_pool_s *pool, isched_t *isched );
+
+/**
+ * @brief Release the workers of a spinning scheduler waiting for the next call
+ * generation.
+ *
+ * The workers that spun for too long sleep on the status condition. They
+ * register themselves before checking the call generation one last time, so
+ * the fence between the new generation and the read of the number of sleeping
+ * workers ensures that none of them misses the call.
+ */
+static inline void
+isched_spin_release( isched_t *isched )
+{
+    pastix_mfence();
+    isched->callgen++;
+    pastix_mfence();
+    if ( isched->sleeping > 0 ) {
+        pthread_mutex_lock(&isched->statuslock);
+        pthread_cond_broadcast(&isched->statuscond);
+        pthread_mutex_unlock(&isched->statuslock);
+    }
+}
 
+/**
+ * @brief Submit a function to all the threads of the scheduler.
+ *
+ * The calllock serializes the parallel calls of the instances that share the
+ * same scheduler, such that the tasks are queued while the cores are busy. If
+ * the scheduler is a partition of a pool, the call is executed by the first
+ * free partition of the pool.
+ *
+ * In spinning mode, the workers are released by incrementing the call
+ * generation they are polling, and joined by a single spinning barrier, such
+ * that no system call is involved in the fork/join as long as the calls are
+ * close enough. The workers that spun for too long fall back on the status
+ * condition.
+ */
 static inline void
 isched_parallel_call( isched_t *isched, void (*func)(isched_thread_t*, void*), void *args )
 {
-    pthread_mutex_lock(&isched->statuslock);
-    isched->pfunc  = func;
-    isched->pargs  = args;
-    isched->status = ISCHED_ACT_PARALLEL;
-    pthread_mutex_unlock(&isched->statuslock);
-    pthread_cond_broadcast(&isched->statuscond);
-    isched_barrier_wait( &(isched->barrier) );
-    isched->status = ISCHED_ACT_STAND_BY;
-    func( isched->master, args );
-    isched_barrier_wait( &(isched->barrier) );
+    if ( isched->pool != NULL ) {
+        isched = ischedPoolAcquire( isched->pool, isched );
+    }
+    else {
+        pthread_mutex_lock(&isched->calllock);
+    }
+
+    if ( isched->spinning ) {
+        isched->pfunc  = func;
+        isched->pargs  = args;
+        isched->status = ISCHED_ACT_PARALLEL;
+        isched_spin_release( isched );
+        func( isched->master, args );
+        isched_barrier_wait( &(isched->barrier) );
+    }
+    else {
+        pthread_mutex_lock(&isched->statuslock);
+        isched->pfunc  = func;
+        isched->pargs  = args;
+        isched->status = ISCHED_ACT_PARALLEL;
+        pthread_mutex_unlock(&isched->statuslock);
+        pthread_cond_broadcast(&isched->statuscond);
+        isched_barrier_wait( &(isched->barrier) );
+        isched->status = ISCHED_ACT_STAND_BY;
+        func( isched->master, args );
+        isched_barrier_wait( &(isched->barrier) );
+    }
+
+    if ( isched->pool != NULL ) {
+        ischedPoolRelease( isched->pool, isched );
+    }
+    else {
+        pthread_mutex_unlock(&isched->calllock);
+    }
 }
 
-isched_t *ischedInit(int cores, const int *coresbind);
+isched_t *ischedInit(int cores, const int *coresbind, int spinning);
 int ischedFinalize(isched_t *isched);
 
+struct pastix_pool_s *ischedPoolInit( int cores, int partnbr, const int *coresbind );
+int       ischedPoolFinalize( struct pastix_pool_s *pool );
+isched_t *ischedPoolAttach( struct pastix_pool_s *pool );
+void      ischedPoolDetach( struct pastix_pool_s *pool, isched_t *isched );
+
 END_C_DECLS
 
 #endif /* _isched_h_ */
@@ -40,6 +40,7 @@ typedef pthread_barrier_t isched_barrier_t;
 
 typedef struct isched_barrier_s {
     int                 count;
+    int                 spin;
     volatile int        curcount;
     volatile int        generation;
     pthread_mutex_t     mutex;
@@ -118,6 +118,22 @@ int isched_hwloc_world_size()
     return isched_hwloc_nb_cores_per_obj( HWLOC_OBJ_MACHINE, 0 );
 }
 
+int isched_hwloc_socket_id(int core_id)
+{
+    hwloc_obj_t core, socket;
+
+    core = hwloc_get_obj_by_type(topology, HWLOC_OBJ_CORE, core_id);
+    if (!core) {
+        return 0;
+    }
+
+    socket = hwloc_get_ancestor_obj_by_type(topology, HWLOC_OBJ_PACKAGE, core);
+    if (!socket) {
+        return 0;
+    }
+    return socket->logical_index;
+}
+
 int isched_hwloc_bind_on_core_index(int cpu_index)
 {
     hwloc_obj_t    core;     /* Hwloc object    */
@@ -97,6 +97,12 @@ int isched_nohwloc_socketsnbr()
     return 0;
 }
 
+int isched_nohwloc_socket_id(int core_id)
+{
+    (void)core_id;
+    return 0;
+}
+
 int isched_nohwloc_bind_on_core_index(int cpu)
 {
     if( -1 == cpu ) { /* Don't try binding if not required */
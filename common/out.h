@@ -178,6 +178,27 @@
     "    Number of operations                       %5.2lf %cFlops\n"   \
     "    Number of static pivots               %8ld\n"
 
+#define OUT_SOPALIN_CBLKPIVOTS                                          \
+    "    Cblks with static pivots              %8ld (at most %ld per cblk)\n"
+
+#define OUT_SCHED_STEALS                                        \
+    "    Number of stolen tasks                %8ld (%ld from another socket)\n"
+
+#define OUT_SCHED_IDLE                                          \
+    "    Idle time per thread (avg/max)        %e s / %e s (%ld parks)\n"
+
+#define OUT_SCHED_CACHE                                         \
+    "    Cache misses of the threads (L2/L3)   %8lld / %lld\n"
+
+#define OUT_KERNELS_LOCKWAIT                                    \
+    "    Contended update locks                %8ld (%e s of wait)\n"
+
+#define OUT_LOWRANK_RKCACHE                                     \
+    "    Ranks reused from the rank cache      %8ld / %ld (%e s saved)\n"
+
+#define OUT_LOWRANK_MEMPOOL                                     \
+    "    Peak memory of the low-rank buffers   %8.3g %co (%ld / %ld allocations reused)\n"
+
 #define OUT_SOPALIN_ENERGY                                      \
     "    Energy consumed during factorization: %e %cJ\n"        \
     "    Average power during factorization:   %e %cW\n"
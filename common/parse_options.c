@@ -103,6 +103,7 @@ parse_iparm( const char *iparm )
     if(0 == strcasecmp("iparm_facto_look_side",                iparm)) { return IPARM_FACTO_LOOK_SIDE; }
     if(0 == strcasecmp("iparm_free_cscuser",                   iparm)) { return IPARM_FREE_CSCUSER; }
     if(0 == strcasecmp("iparm_schur_fact_mode",                iparm)) { return IPARM_SCHUR_FACT_MODE; }
+    if(0 == strcasecmp("iparm_facto_lu_fused",                 iparm)) { return IPARM_FACTO_LU_FUSED; }
 
     if(0 == strcasecmp("iparm_transpose_solve",                iparm)) { return IPARM_TRANSPOSE_SOLVE; }
     if(0 == strcasecmp("iparm_schur_solv_mode",                iparm)) { return IPARM_SCHUR_SOLV_MODE; }
@@ -113,6 +114,14 @@ parse_iparm( const char *iparm )
     if(0 == strcasecmp("iparm_gmres_im",                       iparm)) { return IPARM_GMRES_IM; }
 
     if(0 == strcasecmp("iparm_scheduler",                      iparm)) { return IPARM_SCHEDULER; }
+    if(0 == strcasecmp("iparm_sched_queue",                    iparm)) { return IPARM_SCHED_QUEUE; }
+    if(0 == strcasecmp("iparm_sched_steal",                    iparm)) { return IPARM_SCHED_STEAL; }
+    if(0 == strcasecmp("iparm_sched_idle",                     iparm)) { return IPARM_SCHED_IDLE; }
+    if(0 == strcasecmp("iparm_sched_priority",                 iparm)) { return IPARM_SCHED_PRIORITY; }
+    if(0 == strcasecmp("iparm_sched_dispatch",                 iparm)) { return IPARM_SCHED_DISPATCH; }
+    if(0 == strcasecmp("iparm_sched_lookahead",                iparm)) { return IPARM_SCHED_LOOKAHEAD; }
+    if(0 == strcasecmp("iparm_sched_team_width",               iparm)) { return IPARM_SCHED_TEAM_WIDTH; }
+    if(0 == strcasecmp("iparm_sched_prefetch",                 iparm)) { return IPARM_SCHED_PREFETCH; }
     if(0 == strcasecmp("iparm_thread_nbr",                     iparm)) { return IPARM_THREAD_NBR; }
     if(0 == strcasecmp("iparm_socket_nbr",                     iparm)) { return IPARM_SOCKET_NBR; }
     if(0 == strcasecmp("iparm_autosplit_comm",                 iparm)) { return IPARM_AUTOSPLIT_COMM; }
@@ -130,6 +139,10 @@ parse_iparm( const char *iparm )
     if(0 == strcasecmp("iparm_compress_reltol",                iparm)) { return IPARM_COMPRESS_RELTOL; }
     if(0 == strcasecmp("iparm_compress_preselect",             iparm)) { return IPARM_COMPRESS_PRESELECT; }
     if(0 == strcasecmp("iparm_compress_iluk",                  iparm)) { return IPARM_COMPRESS_ILUK; }
+    if(0 == strcasecmp("iparm_compress_deferred",              iparm)) { return IPARM_COMPRESS_DEFERRED; }
+    if(0 == strcasecmp("iparm_compress_team_bloknbr",          iparm)) { return IPARM_COMPRESS_TEAM_BLOKNBR; }
+    if(0 == strcasecmp("iparm_compress_rank_cache",            iparm)) { return IPARM_COMPRESS_RANK_CACHE; }
+    if(0 == strcasecmp("iparm_compress_mem_pool",              iparm)) { return IPARM_COMPRESS_MEM_POOL; }
 
     if(0 == strcasecmp("iparm_mixed",                          iparm)) { return IPARM_MIXED; }
     if(0 == strcasecmp("iparm_ftz",                            iparm)) { return IPARM_FTZ; }
@@ -170,6 +183,7 @@ parse_dparm( const char *dparm )
 {
     if(0 == strcasecmp("dparm_epsilon_refinement", dparm)) { return DPARM_EPSILON_REFINEMENT; }
     if(0 == strcasecmp("dparm_epsilon_magn_ctrl",  dparm)) { return DPARM_EPSILON_MAGN_CTRL; }
+    if(0 == strcasecmp("dparm_pivot_threshold",    dparm)) { return DPARM_PIVOT_THRESHOLD; }
     if(0 == strcasecmp("dparm_compress_tolerance", dparm)) { return DPARM_COMPRESS_TOLERANCE; }
     if(0 == strcasecmp("dparm_compress_min_ratio", dparm)) { return DPARM_COMPRESS_MIN_RATIO; }
 
@@ -260,6 +274,23 @@ parse_enums( const char *string )
     if(0 == strcasecmp("pastixschedstarpu",     string)) { return PastixSchedStarPU; }
     if(0 == strcasecmp("pastixscheddynamic",    string)) { return PastixSchedDynamic; }
 
+    if(0 == strcasecmp("pastixschedqueueheap",         string)) { return PastixSchedQueueHeap; }
+    if(0 == strcasecmp("pastixschedqueueworkstealing", string)) { return PastixSchedQueueWorkStealing; }
+
+    if(0 == strcasecmp("pastixschedstealroundrobin",     string)) { return PastixSchedStealRoundRobin; }
+    if(0 == strcasecmp("pastixschedsteallocality",       string)) { return PastixSchedStealLocality; }
+    if(0 == strcasecmp("pastixschedsteallocalityrandom", string)) { return PastixSchedStealLocalityRandom; }
+
+    if(0 == strcasecmp("pastixschedidlespin",    string)) { return PastixSchedIdleSpin; }
+    if(0 == strcasecmp("pastixschedidlebackoff", string)) { return PastixSchedIdleBackoff; }
+    if(0 == strcasecmp("pastixschedidlepark",    string)) { return PastixSchedIdlePark; }
+
+    if(0 == strcasecmp("pastixschedpriosimulation",   string)) { return PastixSchedPrioSimulation; }
+    if(0 == strcasecmp("pastixschedpriocriticalpath", string)) { return PastixSchedPrioCriticalPath; }
+
+    if(0 == strcasecmp("pastixscheddispatchsleep", string)) { return PastixSchedDispatchSleep; }
+    if(0 == strcasecmp("pastixscheddispatchspin",  string)) { return PastixSchedDispatchSpin; }
+
     if(0 == strcasecmp("pastixcompressnever",      string)) { return PastixCompressNever; }
     if(0 == strcasecmp("pastixcompresswhenbegin",  string)) { return PastixCompressWhenBegin; }
     if(0 == strcasecmp("pastixcompresswhenend",    string)) { return PastixCompressWhenEnd; }
@@ -270,6 +301,7 @@ parse_enums( const char *string )
     if(0 == strcasecmp("pastixcompressmethodrqrcp", string)) { return PastixCompressMethodRQRCP; }
     if(0 == strcasecmp("pastixcompressmethodtqrcp", string)) { return PastixCompressMethodTQRCP; }
     if(0 == strcasecmp("pastixcompressmethodrqrrt", string)) { return PastixCompressMethodRQRRT; }
+    if(0 == strcasecmp("pastixcompressmethodarrf",  string)) { return PastixCompressMethodARRF; }
     if(0 == strcasecmp("pastixcompressmethodnbr",   string)) { return PastixCompressMethodNbr; }
 
     if(0 == strcasecmp("pastixcompressorthocgs",       string)) { return PastixCompressOrthoCGS; }
@@ -496,6 +528,75 @@ pastix_scheduler_getstr( pastix_scheduler_t value )
     }
 }
 
+const char*
+pastix_sched_queue_getstr( pastix_sched_queue_t value )
+{
+    switch( value ) {
+    case PastixSchedQueueHeap:
+        return "PastixSchedQueueHeap";
+    case PastixSchedQueueWorkStealing:
+        return "PastixSchedQueueWorkStealing";
+    default :
+        return "Bad sched_queue given";
+    }
+}
+
+const char*
+pastix_sched_steal_getstr( pastix_sched_steal_t value )
+{
+    switch( value ) {
+    case PastixSchedStealRoundRobin:
+        return "PastixSchedStealRoundRobin";
+    case PastixSchedStealLocality:
+        return "PastixSchedStealLocality";
+    case PastixSchedStealLocalityRandom:
+        return "PastixSchedStealLocalityRandom";
+    default :
+        return "Bad sched_steal given";
+    }
+}
+
+const char*
+pastix_sched_idle_getstr( pastix_sched_idle_t value )
+{
+    switch( value ) {
+    case PastixSchedIdleSpin:
+        return "PastixSchedIdleSpin";
+    case PastixSchedIdleBackoff:
+        return "PastixSchedIdleBackoff";
+    case PastixSchedIdlePark:
+        return "PastixSchedIdlePark";
+    default :
+        return "Bad sched_idle given";
+    }
+}
+
+const char*
+pastix_sched_prio_getstr( pastix_sched_prio_t value )
+{
+    switch( value ) {
+    case PastixSchedPrioSimulation:
+        return "PastixSchedPrioSimulation";
+    case PastixSchedPrioCriticalPath:
+        return "PastixSchedPrioCriticalPath";
+    default :
+        return "Bad sched_prio given";
+    }
+}
+
+const char*
+pastix_sched_dispatch_getstr( pastix_sched_dispatch_t value )
+{
+    switch( value ) {
+    case PastixSchedDispatchSleep:
+        return "PastixSchedDispatchSleep";
+    case PastixSchedDispatchSpin:
+        return "PastixSchedDispatchSpin";
+    default :
+        return "Bad sched_dispatch given";
+    }
+}
+
 const char*
 pastix_ordering_getstr( pastix_ordering_t value )
 {
@@ -598,6 +699,8 @@ pastix_compress_method_getstr( pastix_compress_method_t value )
         return "PastixCompressMethodTQRCP";
     case PastixCompressMethodRQRRT:
         return "PastixCompressMethodRQRRT";
+    case PastixCompressMethodARRF:
+        return "PastixCompressMethodARRF";
     case PastixCompressMethodNbr:
         return "PastixCompressMethodNbr";
     default :
@@ -843,6 +946,7 @@ pastix_param2csv( const pastix_data_t *pastix_data,
     fprintf( csv, "%s,%ld\n", "iparm_static_pivoting", (long)iparm[IPARM_STATIC_PIVOTING] );
     fprintf( csv, "%s,%ld\n", "iparm_free_cscuser",    (long)iparm[IPARM_FREE_CSCUSER] );
     fprintf( csv, "%s,%s\n",  "iparm_schur_fact_mode",  pastix_fact_mode_getstr(iparm[IPARM_SCHUR_FACT_MODE]) );
+    fprintf( csv, "%s,%ld\n", "iparm_facto_lu_fused",  (long)iparm[IPARM_FACTO_LU_FUSED] );
 
     fprintf( csv, "%s,%s\n",  "iparm_transpose_solve",  pastix_trans_getstr(iparm[IPARM_TRANSPOSE_SOLVE]) );
     fprintf( csv, "%s,%s\n",  "iparm_schur_solv_mode",  pastix_solv_mode_getstr(iparm[IPARM_SCHUR_SOLV_MODE]) );
@@ -853,24 +957,36 @@ pastix_param2csv( const pastix_data_t *pastix_data,
     fprintf( csv, "%s,%ld\n", "iparm_itermax",    (long)iparm[IPARM_ITERMAX] );
     fprintf( csv, "%s,%ld\n", "iparm_gmres_im",   (long)iparm[IPARM_GMRES_IM] );
 
-    fprintf( csv, "%s,%s\n",  "iparm_scheduler",       pastix_scheduler_getstr(iparm[IPARM_SCHEDULER]) );
-    fprintf( csv, "%s,%ld\n", "iparm_thread_nbr",     (long)iparm[IPARM_THREAD_NBR] );
-    fprintf( csv, "%s,%ld\n", "iparm_socket_nbr",     (long)iparm[IPARM_SOCKET_NBR] );
-    fprintf( csv, "%s,%ld\n", "iparm_autosplit_comm", (long)iparm[IPARM_AUTOSPLIT_COMM] );
+    fprintf( csv, "%s,%s\n",  "iparm_scheduler",         pastix_scheduler_getstr(iparm[IPARM_SCHEDULER]) );
+    fprintf( csv, "%s,%s\n",  "iparm_sched_queue",       pastix_sched_queue_getstr(iparm[IPARM_SCHED_QUEUE]) );
+    fprintf( csv, "%s,%s\n",  "iparm_sched_steal",       pastix_sched_steal_getstr(iparm[IPARM_SCHED_STEAL]) );
+    fprintf( csv, "%s,%s\n",  "iparm_sched_idle",        pastix_sched_idle_getstr(iparm[IPARM_SCHED_IDLE]) );
+    fprintf( csv, "%s,%s\n",  "iparm_sched_priority",    pastix_sched_prio_getstr(iparm[IPARM_SCHED_PRIORITY]) );
+    fprintf( csv, "%s,%s\n",  "iparm_sched_dispatch",    pastix_sched_dispatch_getstr(iparm[IPARM_SCHED_DISPATCH]) );
+    fprintf( csv, "%s,%ld\n", "iparm_sched_lookahead",  (long)iparm[IPARM_SCHED_LOOKAHEAD] );
+    fprintf( csv, "%s,%ld\n", "iparm_sched_team_width", (long)iparm[IPARM_SCHED_TEAM_WIDTH] );
+    fprintf( csv, "%s,%ld\n", "iparm_sched_prefetch",   (long)iparm[IPARM_SCHED_PREFETCH] );
+    fprintf( csv, "%s,%ld\n", "iparm_thread_nbr",       (long)iparm[IPARM_THREAD_NBR] );
+    fprintf( csv, "%s,%ld\n", "iparm_socket_nbr",       (long)iparm[IPARM_SOCKET_NBR] );
+    fprintf( csv, "%s,%ld\n", "iparm_autosplit_comm",   (long)iparm[IPARM_AUTOSPLIT_COMM] );
 
     fprintf( csv, "%s,%ld\n", "iparm_gpu_nbr",               (long)iparm[IPARM_GPU_NBR] );
     fprintf( csv, "%s,%ld\n", "iparm_gpu_memory_percentage", (long)iparm[IPARM_GPU_MEMORY_PERCENTAGE] );
     fprintf( csv, "%s,%ld\n", "iparm_gpu_memory_block_size", (long)iparm[IPARM_GPU_MEMORY_BLOCK_SIZE] );
     fprintf( csv, "%s,%ld\n", "iparm_global_allocation",     (long)iparm[IPARM_GLOBAL_ALLOCATION] );
 
-    fprintf( csv, "%s,%ld\n", "iparm_compress_min_width",  (long)iparm[IPARM_COMPRESS_MIN_WIDTH] );
-    fprintf( csv, "%s,%ld\n", "iparm_compress_min_height", (long)iparm[IPARM_COMPRESS_MIN_HEIGHT] );
-    fprintf( csv, "%s,%s\n",  "iparm_compress_when",        pastix_compress_when_getstr(iparm[IPARM_COMPRESS_WHEN]) );
-    fprintf( csv, "%s,%s\n",  "iparm_compress_method",      pastix_compress_method_getstr(iparm[IPARM_COMPRESS_METHOD]) );
-    fprintf( csv, "%s,%s\n",  "iparm_compress_ortho",       pastix_compress_ortho_getstr(iparm[IPARM_COMPRESS_ORTHO]) );
-    fprintf( csv, "%s,%ld\n", "iparm_compress_reltol",     (long)iparm[IPARM_COMPRESS_RELTOL] );
-    fprintf( csv, "%s,%ld\n", "iparm_compress_preselect",  (long)iparm[IPARM_COMPRESS_PRESELECT] );
-    fprintf( csv, "%s,%ld\n", "iparm_compress_iluk",       (long)iparm[IPARM_COMPRESS_ILUK] );
+    fprintf( csv, "%s,%ld\n", "iparm_compress_min_width",    (long)iparm[IPARM_COMPRESS_MIN_WIDTH] );
+    fprintf( csv, "%s,%ld\n", "iparm_compress_min_height",   (long)iparm[IPARM_COMPRESS_MIN_HEIGHT] );
+    fprintf( csv, "%s,%s\n",  "iparm_compress_when",          pastix_compress_when_getstr(iparm[IPARM_COMPRESS_WHEN]) );
+    fprintf( csv, "%s,%s\n",  "iparm_compress_method",        pastix_compress_method_getstr(iparm[IPARM_COMPRESS_METHOD]) );
+    fprintf( csv, "%s,%s\n",  "iparm_compress_ortho",         pastix_compress_ortho_getstr(iparm[IPARM_COMPRESS_ORTHO]) );
+    fprintf( csv, "%s,%ld\n", "iparm_compress_reltol",       (long)iparm[IPARM_COMPRESS_RELTOL] );
+    fprintf( csv, "%s,%ld\n", "iparm_compress_preselect",    (long)iparm[IPARM_COMPRESS_PRESELECT] );
+    fprintf( csv, "%s,%ld\n", "iparm_compress_iluk",         (long)iparm[IPARM_COMPRESS_ILUK] );
+    fprintf( csv, "%s,%ld\n", "iparm_compress_deferred",     (long)iparm[IPARM_COMPRESS_DEFERRED] );
+    fprintf( csv, "%s,%ld\n", "iparm_compress_team_bloknbr", (long)iparm[IPARM_COMPRESS_TEAM_BLOKNBR] );
+    fprintf( csv, "%s,%ld\n", "iparm_compress_rank_cache",   (long)iparm[IPARM_COMPRESS_RANK_CACHE] );
+    fprintf( csv, "%s,%ld\n", "iparm_compress_mem_pool",     (long)iparm[IPARM_COMPRESS_MEM_POOL] );
 
     fprintf( csv, "%s,%ld\n", "iparm_mixed", (long)iparm[IPARM_MIXED] );
     fprintf( csv, "%s,%ld\n", "iparm_ftz",   (long)iparm[IPARM_FTZ] );
@@ -888,6 +1004,7 @@ pastix_param2csv( const pastix_data_t *pastix_data,
     fprintf( csv, "%s,%e\n",  "dparm_epsilon_refinement", dparm[DPARM_EPSILON_REFINEMENT] );
     fprintf( csv, "%s,%e\n",  "dparm_relative_error",     dparm[DPARM_RELATIVE_ERROR] );
     fprintf( csv, "%s,%e\n",  "dparm_epsilon_magn_ctrl",  dparm[DPARM_EPSILON_MAGN_CTRL] );
+    fprintf( csv, "%s,%e\n",  "dparm_pivot_threshold",    dparm[DPARM_PIVOT_THRESHOLD] );
     fprintf( csv, "%s,%e\n",  "dparm_order_time",         dparm[DPARM_ORDER_TIME] );
     fprintf( csv, "%s,%e\n",  "dparm_symbfact_time",      dparm[DPARM_SYMBFACT_TIME] );
     fprintf( csv, "%s,%e\n",  "dparm_reorder_time",       dparm[DPARM_REORDER_TIME] );
@@ -899,8 +1016,11 @@ pastix_param2csv( const pastix_data_t *pastix_data,
     fprintf( csv, "%s,%e\n",  "dparm_fact_thflops",       dparm[DPARM_FACT_THFLOPS] );
     fprintf( csv, "%s,%e\n",  "dparm_fact_rlflops",       dparm[DPARM_FACT_RLFLOPS] );
     fprintf( csv, "%s,%e\n",  "dparm_fact_energy",        dparm[DPARM_FACT_ENERGY] );
+    fprintf( csv, "%s,%e\n",  "dparm_fact_lockwait",      dparm[DPARM_FACT_LOCKWAIT] );
+    fprintf( csv, "%s,%e\n",  "dparm_fact_rkcache_saved", dparm[DPARM_FACT_RKCACHE_SAVED] );
     fprintf( csv, "%s,%e\n",  "dparm_mem_fr",             dparm[DPARM_MEM_FR] );
     fprintf( csv, "%s,%e\n",  "dparm_mem_lr",             dparm[DPARM_MEM_LR] );
+    fprintf( csv, "%s,%e\n",  "dparm_mem_lr_peak",        dparm[DPARM_MEM_LR_PEAK] );
     fprintf( csv, "%s,%e\n",  "dparm_solv_time",          dparm[DPARM_SOLV_TIME] );
     fprintf( csv, "%s,%e\n",  "dparm_solv_flops",         dparm[DPARM_SOLV_FLOPS] );
     fprintf( csv, "%s,%e\n",  "dparm_solv_thflops",       dparm[DPARM_SOLV_THFLOPS] );
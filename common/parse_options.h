@@ -41,6 +41,11 @@ const char* pastix_coeftype_getstr( pastix_coeftype_t value );
 const char* pastix_factotype_getstr( pastix_factotype_t value );
 const char* pastix_factolookside_getstr( pastix_factolookside_t value );
 const char* pastix_scheduler_getstr( pastix_scheduler_t value );
+const char* pastix_sched_queue_getstr( pastix_sched_queue_t value );
+const char* pastix_sched_steal_getstr( pastix_sched_steal_t value );
+const char* pastix_sched_idle_getstr( pastix_sched_idle_t value );
+const char* pastix_sched_prio_getstr( pastix_sched_prio_t value );
+const char* pastix_sched_dispatch_getstr( pastix_sched_dispatch_t value );
 const char* pastix_ordering_getstr( pastix_ordering_t value );
 const char* pastix_mpithreadmode_getstr( pastix_mpithreadmode_t value );
 const char* pastix_error_getstr( pastix_error_t value );
@@ -27,6 +27,7 @@ static int _pastix_papi_N_EVTS      = 2;
 static int _pastix_papi_N_SOCK      = 0;
 static int _pastix_papi_initialized = 0;
 static int _pastix_papi_EventSet    = PAPI_NULL;
+static int _pastix_papi_threads     = 0;
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
@@ -111,6 +112,15 @@ papiEnergyInit( pastix_int_t nbr_socks )
         return PASTIX_ERR_INTERNAL;
     }
 
+    /* Enable the per-thread counters of the cache misses */
+    retval = PAPI_thread_init( (unsigned long (*)(void))pthread_self );
+    if ( retval != PAPI_OK ) {
+        pastix_print_warning( "Could not initialize the PAPI thread support\n");
+    }
+    else {
+        _pastix_papi_threads = 1;
+    }
+
     /* Creating the eventset */
     retval = PAPI_create_eventset( &_pastix_papi_EventSet );
     if ( retval != PAPI_OK ) {
@@ -216,3 +226,75 @@ papiEnergyFinalize( )
     }
     _pastix_papi_initialized = 0;
 }
+
+/**
+ *******************************************************************************
+ *
+ * @brief Starts counting the L2 and L3 cache misses of the calling thread.
+ *
+ *******************************************************************************
+ *
+ * @return The PAPI EventSet of the counters to give to papiCacheStop(),
+ *         PAPI_NULL if the counters are not available.
+ *
+ *******************************************************************************/
+int
+papiCacheStart()
+{
+    int EventSet = PAPI_NULL;
+
+    if ( !_pastix_papi_threads ) {
+        return PAPI_NULL;
+    }
+
+    if ( ( PAPI_register_thread() != PAPI_OK ) ||
+         ( PAPI_create_eventset( &EventSet ) != PAPI_OK ) )
+    {
+        return PAPI_NULL;
+    }
+
+    if ( ( PAPI_add_event( EventSet, PAPI_L2_TCM ) != PAPI_OK ) ||
+         ( PAPI_add_event( EventSet, PAPI_L3_TCM ) != PAPI_OK ) ||
+         ( PAPI_start( EventSet ) != PAPI_OK ) )
+    {
+        PAPI_cleanup_eventset( EventSet );
+        PAPI_destroy_eventset( &EventSet );
+        return PAPI_NULL;
+    }
+    return EventSet;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Stops counting the cache misses of the calling thread, and releases
+ * the counters.
+ *
+ *******************************************************************************
+ *
+ * @param[in] EventSet
+ *          The EventSet returned by papiCacheStart() in the same thread.
+ *
+ * @param[inout] misses
+ *          Array of size 2. On exit, the L2 and L3 cache misses since the call
+ *          to papiCacheStart() are added to misses[0] and misses[1].
+ *
+ *******************************************************************************/
+void
+papiCacheStop( int        EventSet,
+               long long *misses )
+{
+    long long values[2];
+
+    if ( EventSet == PAPI_NULL ) {
+        return;
+    }
+
+    if ( PAPI_stop( EventSet, values ) == PAPI_OK ) {
+        misses[0] += values[0];
+        misses[1] += values[1];
+    }
+    PAPI_cleanup_eventset( EventSet );
+    PAPI_destroy_eventset( &EventSet );
+    PAPI_unregister_thread();
+}
@@ -22,6 +22,8 @@ int    papiEnergyInit( pastix_int_t nbr_socks );
 void   papiEnergyStart();
 double papiEnergyStop();
 void   papiEnergyFinalize();
+int    papiCacheStart();
+void   papiCacheStop( int EventSet, long long *misses );
 
 #else
 
@@ -34,6 +36,12 @@ static inline int    papiEnergyInit( pastix_int_t nbr_socks )
 static inline void   papiEnergyStart() {}
 static inline double papiEnergyStop() { return 0.; }
 static inline void   papiEnergyFinalize() {}
+static inline int    papiCacheStart() { return -1; }
+static inline void   papiCacheStop( int EventSet, long long *misses )
+{
+    (void)EventSet;
+    (void)misses;
+}
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 #endif
@@ -83,6 +83,7 @@ struct pastix_data_s {
     int              inter_node_procnum; /**< Local MPI rank in inter node communicator                           */
 
     isched_t        *isched;             /**< Internal scheduler structure that is always available               */
+    pastix_pool_t   *pool;               /**< Shared pool the internal scheduler belongs to, NULL if owned        */
     void            *parsec;             /**< PaRSEC context if available                                         */
     void            *starpu;             /**< StarPU context if available                                         */
 
@@ -3,6 +3,9 @@
  *
  * @brief A reentrant example that runs two threads then run two instances of the solver in each thread.
  *
+ * The instances are first run with their own set of threads, and then attached
+ * to a single partition of a shared pool of threads.
+ *
  * @copyright 2015-2023 Bordeaux INP, CNRS (LaBRI UMR 5800), Inria,
  *                      Univ. Bordeaux. All rights reserved.
  *
@@ -37,6 +40,7 @@ typedef struct solve_param {
     int           scatter;
     int           id;
     int           rc;
+    pastix_pool_t *pool;
 } solve_param_t;
 
 /**
@@ -69,7 +73,12 @@ static void *solve_smp(void *arg)
     /**
      * Startup PaStiX
      */
-    {
+    if ( param.pool != NULL ) {
+        pastixInitWithPool( &pastix_data, MPI_COMM_WORLD,
+                            param.iparm, param.dparm,
+                            param.pool );
+    }
+    else {
         int *bindtab = malloc( param.iparm[IPARM_THREAD_NBR] * sizeof(int) );
         int i;
 
@@ -206,6 +215,8 @@ int main (int argc, char **argv)
     int            nbcallingthreads = 2;
     solve_param_t *solve_param;
     pthread_t     *threads;
+    pastix_pool_t *pool = NULL;
+    int            thrdnbr;
     int            scatter = 0;
     int            check   = 1;
     int            rc      = 0;
@@ -232,6 +243,7 @@ int main (int argc, char **argv)
     for (i = 0; i < nbcallingthreads; i++)
     {
         memcpy(solve_param[i].iparm, iparm, sizeof(solve_param[i].iparm));
+        solve_param[i].pool     = NULL;
         memcpy(solve_param[i].dparm, dparm, sizeof(solve_param[i].dparm));
         solve_param[i].check    = check;
         solve_param[i].scatter  = scatter;
@@ -254,6 +266,26 @@ int main (int argc, char **argv)
         rc += solve_param[i].rc;
     }
 
+    /**
+     *    Run again the instances on a single partition of a shared pool of
+     *    threads, such that they are serialized on the same set of cores
+     */
+    thrdnbr = (iparm[IPARM_THREAD_NBR] == -1) ? 2 : iparm[IPARM_THREAD_NBR];
+    rc += pastixPoolInit( &pool, thrdnbr, 1, NULL );
+
+    for (i = 0; i < nbcallingthreads; i++)
+    {
+        solve_param[i].pool = pool;
+        solve_param[i].rc   = 0;
+        pthread_create(&threads[i], NULL, solve_smp, (void *)&solve_param[i]);
+    }
+
+    for (i = 0; i < nbcallingthreads; i++) {
+        pthread_join(threads[i],(void**)NULL);
+        rc += solve_param[i].rc;
+    }
+    rc += pastixPoolFinalize( &pool );
+
     free( filename );
     free( threads );
     free( solve_param );
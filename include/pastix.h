@@ -80,8 +80,22 @@ void pastixInitWithAffinity( pastix_data_t **pastix_data,
                              pastix_int_t   *iparm,
                              double         *dparm,
                              const int      *bindtab );
+void pastixInitWithPool( pastix_data_t **pastix_data,
+                         PASTIX_Comm     pastix_comm,
+                         pastix_int_t   *iparm,
+                         double         *dparm,
+                         pastix_pool_t  *pool );
 void pastixFinalize ( pastix_data_t **pastix_data );
 
+/*
+ * Thread pool shared by several instances
+ */
+int pastixPoolInit    ( pastix_pool_t **pool,
+                        int             cores,
+                        int             partnbr,
+                        const int      *bindtab );
+int pastixPoolFinalize( pastix_pool_t **pool );
+
 /*
  * Main steps of the solver
  */
@@ -101,6 +101,7 @@ typedef enum pastix_iparm_e {
     IPARM_STATIC_PIVOTING,                /**< Static pivoting                                                Default: -                         OUT */
     IPARM_FREE_CSCUSER,                   /**< Free user CSC                                                  Default: 0                         IN  */
     IPARM_SCHUR_FACT_MODE,                /**< Specify if the Schur is factorized (@see pastix_fact_mode_t)   Default: PastixFactModeLocal       IN  */
+    IPARM_FACTO_LU_FUSED,                 /**< Fuse the L and U updates of the LU factorization               Default: 0                         IN  */
 
     /* Solve */
     IPARM_TRANSPOSE_SOLVE,                /**< Solve A^t x = b (to avoid CSR/CSC conversion for instance)     Default: PastixNoTrans             IN  */
@@ -115,6 +116,14 @@ typedef enum pastix_iparm_e {
 
     /* Context */
     IPARM_SCHEDULER,                      /**< Scheduler mode                                                 Default: PastixSchedDynamic        IN  */
+    IPARM_SCHED_QUEUE,                    /**< Ready task queue of the dynamic scheduler                      Default: PastixSchedQueueHeap      IN  */
+    IPARM_SCHED_STEAL,                    /**< Victim selection policy of the dynamic scheduler               Default: PastixSchedStealLocality  IN  */
+    IPARM_SCHED_IDLE,                     /**< Behavior of the threads of the dynamic scheduler without task  Default: PastixSchedIdlePark       IN  */
+    IPARM_SCHED_PRIORITY,                 /**< Priorities given to the tasks of the dynamic scheduler         Default: PastixSchedPrioSimulation IN  */
+    IPARM_SCHED_DISPATCH,                 /**< Dispatch mode of the parallel calls to the internal threads    Default: PastixSchedDispatchSleep  IN  */
+    IPARM_SCHED_LOOKAHEAD,                /**< Lookahead window of the static scheduler (0 for none)          Default: 0                         IN  */
+    IPARM_SCHED_TEAM_WIDTH,               /**< Minimal cblk width shared with idle static threads (0: off)    Default: 0                         IN  */
+    IPARM_SCHED_PREFETCH,                 /**< Prefetch the next task of the dynamic scheduler                Default: 0                         IN  */
     IPARM_THREAD_NBR,                     /**< Number of threads per process (-1 for auto detect)             Default: -1                        IN  */
     IPARM_SOCKET_NBR,                     /**< Number of sockets for papi energy measure (default: 0)         Default: 0                         IN  */
     IPARM_AUTOSPLIT_COMM,                 /**< Automaticaly split communicator to have one MPI task by node   Default: 0                         IN  */
@@ -134,6 +143,10 @@ typedef enum pastix_iparm_e {
     IPARM_COMPRESS_RELTOL,                /**< Enable/Disable relative tolerance                              Default: 0                         IN  */
     IPARM_COMPRESS_PRESELECT,             /**< Enable/Disable compression of preselected blocks               Default: 1                         IN  */
     IPARM_COMPRESS_ILUK,                  /**< Set the ILU(k) level of preselection (-2 for auto-level)       Default: -2                        IN  */
+    IPARM_COMPRESS_DEFERRED,              /**< Enable/Disable deferred accumulation of LR updates             Default: 0                         IN  */
+    IPARM_COMPRESS_TEAM_BLOKNBR,          /**< Minimal number of blocks compressed by a team (0: off)         Default: 0                         IN  */
+    IPARM_COMPRESS_RANK_CACHE,            /**< Reuse the ranks of the previous factorization                  Default: 0                         IN  */
+    IPARM_COMPRESS_MEM_POOL,              /**< Pool the buffers of the low-rank blocks                        Default: 0                         IN  */
 
     /* mixed-precision parameters */
     IPARM_MIXED,                          /**< Enables/Disables mixed-precision                               Default: 0                         IN  */
@@ -161,6 +174,7 @@ typedef enum pastix_dparm_e {
     DPARM_EPSILON_REFINEMENT, /**< Epsilon for refinement                            Default: -1.  IN  */
     DPARM_RELATIVE_ERROR,     /**< Relative backward error                           Default: -    OUT */
     DPARM_EPSILON_MAGN_CTRL,  /**< Epsilon for magnitude control                     Default: 0.   IN  */
+    DPARM_PIVOT_THRESHOLD,    /**< LU pivoting threshold in diag blocks (0: none)    Default: 0.   IN  */
     DPARM_ORDER_TIME,         /**< Time for subtask order (wallclock)                Default: -    OUT */
     DPARM_SYMBFACT_TIME,      /**< Time for subtask symbfact (wallclock)             Default: -    OUT */
     DPARM_REORDER_TIME,       /**< Time for subtask reordering (wallclock)           Default: -    OUT */
@@ -172,8 +186,11 @@ typedef enum pastix_dparm_e {
     DPARM_FACT_THFLOPS,       /**< Factorization theoretical Flops                   Default: -    OUT */
     DPARM_FACT_RLFLOPS,       /**< Factorization performed Flops                     Default: -    OUT */
     DPARM_FACT_ENERGY,        /**< Energy for task Factorization                     Default: -    OUT */
+    DPARM_FACT_LOCKWAIT,      /**< Time spent waiting on the update locks            Default: -    OUT */
+    DPARM_FACT_RKCACHE_SAVED, /**< Compression time saved by the rank cache          Default: -    OUT */
     DPARM_MEM_FR,             /**< Memory used by the matrix in full-rank format     Default: -    OUT */
     DPARM_MEM_LR,             /**< Memory used by the matrix in low-rank format      Default: -    OUT */
+    DPARM_MEM_LR_PEAK,        /**< Peak memory of the low-rank pool (-1 if off)      Default: -    OUT */
     DPARM_SOLV_TIME,          /**< Time for task Solve (wallclock)                   Default: -    OUT */
     DPARM_SOLV_FLOPS,         /**< Solve GFlops/s                                    Default: -    OUT */
     DPARM_SOLV_THFLOPS,       /**< Solve theoretical Flops                           Default: -    OUT */
@@ -340,6 +357,48 @@ typedef enum pastix_scheduler_e {
     PastixSchedDynamic    = 4  /**< Shared memory with dynamic scheduler */
 } pastix_scheduler_t;
 
+/**
+ * @brief Ready task queue used by the dynamic scheduler
+ */
+typedef enum pastix_sched_queue_e {
+    PastixSchedQueueHeap         = 0, /**< Binary heap protected by a lock                      */
+    PastixSchedQueueWorkStealing = 1  /**< Lock-free work-stealing deques with priority buckets */
+} pastix_sched_queue_t;
+
+/**
+ * @brief Victim selection policy of the dynamic scheduler
+ */
+typedef enum pastix_sched_steal_e {
+    PastixSchedStealRoundRobin     = 0, /**< Steal the first available task from the next threads in round-robin order               */
+    PastixSchedStealLocality       = 1, /**< Steal the highest priority task from the same socket first, then from the other sockets */
+    PastixSchedStealLocalityRandom = 2  /**< Same as locality, but victims are visited in a random order                             */
+} pastix_sched_steal_t;
+
+/**
+ * @brief Behavior of the threads of the dynamic scheduler without task
+ */
+typedef enum pastix_sched_idle_e {
+    PastixSchedIdleSpin    = 0, /**< Busy loop on the queues until new tasks are available                    */
+    PastixSchedIdleBackoff = 1, /**< Spin for a short time, then sleep with an exponential backoff            */
+    PastixSchedIdlePark    = 2  /**< Spin, back off, and finally park the thread until new tasks are released */
+} pastix_sched_idle_t;
+
+/**
+ * @brief Priorities given to the tasks of the dynamic scheduler
+ */
+typedef enum pastix_sched_prio_e {
+    PastixSchedPrioSimulation   = 0, /**< Use the order of the static simulation                                                  */
+    PastixSchedPrioCriticalPath = 1  /**< Use the longest path to the root of the elimination tree, weighted by the kernel models */
+} pastix_sched_prio_t;
+
+/**
+ * @brief Dispatch mode of the parallel calls to the internal threads
+ */
+typedef enum pastix_sched_dispatch_e {
+    PastixSchedDispatchSleep = 0, /**< Threads sleep on a condition variable between parallel calls    */
+    PastixSchedDispatchSpin  = 1  /**< Threads spin between parallel calls for a low-latency fork/join */
+} pastix_sched_dispatch_t;
+
 /**
  * @brief Ordering strategy
  */
@@ -399,6 +458,7 @@ typedef enum pastix_compress_method_e {
     PastixCompressMethodRQRCP, /**< Use randomized QR with column pivoting for low-rank compression */
     PastixCompressMethodTQRCP, /**< Use truncated QR with column pivotingfor low-rank compression   */
     PastixCompressMethodRQRRT, /**< Use randomized QR with rotation for low-rank compression        */
+    PastixCompressMethodARRF,  /**< Use adaptive randomized range finder for low-rank compression   */
     PastixCompressMethodNbr    /**< Total number of available compression methods                   */
 } pastix_compress_method_t;
 
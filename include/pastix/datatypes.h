@@ -143,6 +143,10 @@ typedef spmatrix_t pastix_spm_t;
 struct pastix_data_s;
 typedef struct pastix_data_s pastix_data_t;
 
+/* Pool of threads shared by several instances of the solver */
+struct pastix_pool_s;
+typedef struct pastix_pool_s pastix_pool_t;
+
 /* Graph structure (No values) */
 typedef struct spmatrix_s pastix_graph_t;
 
@@ -0,0 +1,1072 @@
+/**
+ *
+ * @file core_zarrf.c
+ *
+ * PaStiX low-rank kernel routines based on an adaptive randomized range finder.
+ *
+ * @copyright 2016-2023 Bordeaux INP, CNRS (LaBRI UMR 5800), Inria,
+ *                      Univ. Bordeaux. All rights reserved.
+ *
+ * @version 6.3.0
+ * @author Mathieu Faverge
+ * @date 2026-10-17
+ * @precisions normal z -> c d s
+ *
+ **/
+#include "common.h"
+#include <cblas.h>
+#include <lapacke.h>
+#include "flops.h"
+#include "blend/solver.h"
+#include "pastix_zcores.h"
+#include "pastix_zlrcores.h"
+#include "z_nan_check.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+static pastix_complex64_t mzone = -1.0;
+static pastix_complex64_t zone  =  1.0;
+static pastix_complex64_t zzero =  0.0;
+
+/*
+ * Variance of the entries generated by zlarnv with the normal distribution:
+ * both the real and the imaginary parts are N(0,1) in complex arithmetic.
+ */
+#if defined(PRECISION_z) || defined(PRECISION_c)
+#define ARRF_VARIANCE 2.
+#else
+#define ARRF_VARIANCE 1.
+#endif
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+/**
+ *******************************************************************************
+ *
+ * @brief Project the columns of Y on the orthogonal complement of Q.
+ *
+ * The classical Gram-Schmidt projection is applied twice to keep the basis
+ * orthogonal to the working precision.
+ *
+ *******************************************************************************/
+static inline void
+core_zarrf_project( pastix_int_t              m,
+                    pastix_int_t              k,
+                    pastix_int_t              ib,
+                    const pastix_complex64_t *Q,
+                    pastix_int_t              ldq,
+                    pastix_complex64_t       *Y,
+                    pastix_int_t              ldy,
+                    pastix_complex64_t       *W )
+{
+    int pass;
+
+    if ( k == 0 ) {
+        return;
+    }
+
+    for( pass=0; pass<2; pass++ ) {
+        cblas_zgemm( CblasColMajor, CblasConjTrans, CblasNoTrans,
+                     k, ib, m,
+                     CBLAS_SADDR(zone),  Q, ldq,
+                                         Y, ldy,
+                     CBLAS_SADDR(zzero), W, k );
+        cblas_zgemm( CblasColMajor, CblasNoTrans, CblasNoTrans,
+                     m, ib, k,
+                     CBLAS_SADDR(mzone), Q, ldq,
+                                         W, k,
+                     CBLAS_SADDR(zone),  Y, ldy );
+    }
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Append a batch of samples to the orthonormal basis of an adaptive
+ * randomized range finder.
+ *
+ * The batch stored in the columns k to k+nb-1 of Q is projected on the
+ * complement of the current basis. If the norm of the projected samples is
+ * below the tolerance, the process has converged. Otherwise, the batch is
+ * orthonormalized and appended to the basis.
+ *
+ *******************************************************************************
+ *
+ * @param[in] tol
+ *          The absolute tolerance criterion. If tol < 0, the residual is not
+ *          estimated.
+ *
+ * @param[in] maxrank
+ *          Maximum size of the basis.
+ *
+ * @param[in] nb
+ *          The number of samples of the batch.
+ *
+ * @param[in] m
+ *          Number of rows of the matrix Q.
+ *
+ * @param[inout] Q
+ *          The matrix of dimension ldq-by-(maxrank+nb). On entry, the first k
+ *          columns hold the current basis, and the next nb columns the
+ *          samples. On exit, the basis is extended if the process goes on.
+ *
+ * @param[in] ldq
+ *          The leading dimension of the matrix Q. ldq >= max(1, m).
+ *
+ * @param[inout] k
+ *          On entry, the size of the basis. On exit, the size of the extended
+ *          basis.
+ *
+ * @param[in] work
+ *          Workspace array of size nb * (maxrank + nb + 1).
+ *
+ * @param[out] normR
+ *          On exit, the estimated frobenius norm of the residual if the process
+ *          has converged.
+ *
+ *******************************************************************************
+ *
+ * @retval 0 if the batch has been appended to the basis,
+ * @retval 1 if the process has converged,
+ * @retval -1 if the tolerance has not been reached within maxrank vectors.
+ *
+ *******************************************************************************/
+static inline int
+core_zarrf_append( double              tol,
+                   pastix_int_t        maxrank,
+                   pastix_int_t        nb,
+                   pastix_int_t        m,
+                   pastix_complex64_t *Q,
+                   pastix_int_t        ldq,
+                   pastix_int_t       *k,
+                   pastix_complex64_t *work,
+                   double             *normR )
+{
+    pastix_complex64_t *Y     = Q + (*k) * ldq;
+    pastix_complex64_t *tau   = work;
+    pastix_complex64_t *W     = tau + nb;
+    pastix_complex64_t *subw  = W + maxrank * nb;
+    pastix_int_t        sublw = nb * nb;
+    pastix_int_t        ib;
+    double              est;
+    int                 ret;
+
+    core_zarrf_project( m, *k, nb, Q, ldq, Y, ldq, W );
+
+    /* Posterior estimate of the residual */
+    if ( tol >= 0. ) {
+        est = LAPACKE_zlange_work( LAPACK_COL_MAJOR, 'f', m, nb,
+                                   Y, ldq, NULL );
+        est = est / sqrt( (double)nb * ARRF_VARIANCE );
+        if ( est < tol ) {
+            *normR = est;
+            return 1;
+        }
+    }
+
+    if ( *k >= maxrank ) {
+        return -1;
+    }
+
+    /*
+     * Orthonormalize the batch. The projection is applied a second time
+     * after the QR factorization, as the basis generated by the
+     * householders for a rank deficient batch is not orthogonal to Q.
+     */
+    ib = pastix_imin( nb, maxrank - *k );
+    ret = LAPACKE_zgeqrf_work( LAPACK_COL_MAJOR, m, ib,
+                               Y, ldq, tau, subw, sublw );
+    assert( ret == 0 );
+    ret = LAPACKE_zungqr_work( LAPACK_COL_MAJOR, m, ib, ib,
+                               Y, ldq, tau, subw, sublw );
+    assert( ret == 0 );
+
+    if ( *k > 0 ) {
+        core_zarrf_project( m, *k, ib, Q, ldq, Y, ldq, W );
+
+        ret = LAPACKE_zgeqrf_work( LAPACK_COL_MAJOR, m, ib,
+                                   Y, ldq, tau, subw, sublw );
+        assert( ret == 0 );
+        ret = LAPACKE_zungqr_work( LAPACK_COL_MAJOR, m, ib, ib,
+                                   Y, ldq, tau, subw, sublw );
+        assert( ret == 0 );
+    }
+    *k += ib;
+
+    (void)ret;
+    return 0;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Compute an orthonormal basis of the range of A with an adaptive
+ * randomized range finder.
+ *
+ * The samples are drawn by batches of nb columns: Y = A * omega(:, s:s+nb) is
+ * projected on the complement of the current basis Q, and the norm of the
+ * projected samples gives a posterior estimate of the residual
+ * || A - Q Q^h A ||_F, as E( ||(I - Q Q^h) A w||^2 ) = ||(I - Q Q^h) A||_F^2
+ * for a Gaussian vector w. The process stops as soon as this estimate is below
+ * the tolerance, otherwise the orthonormalized batch is appended to Q.
+ *
+ * See: Finding structure with randomness: Probabilistic algorithms for
+ * constructing approximate matrix decompositions. N. Halko, P. G. Martinsson,
+ * J. A. Tropp.
+ *
+ *******************************************************************************
+ *
+ * @param[in] tol
+ *          The absolute tolerance criterion. Computations are stopped when the
+ *          estimated frobenius norm of the residual matrix is lower than tol.
+ *          If tol < 0, then maxrank vectors are computed.
+ *
+ * @param[in] maxrank
+ *          Maximum size of the basis. If maxrank < 0, it is set to min(m, n).
+ *
+ * @param[in] nb
+ *          The number of samples drawn at each step. If nb < 0, nb is set to
+ *          PASTIX_LR_ARRF_NB.
+ *
+ * @param[in] m
+ *          Number of rows of the matrix A.
+ *
+ * @param[in] n
+ *          Number of columns of the matrix A.
+ *
+ * @param[in] A
+ *          The matrix of dimension lda-by-n for which the range is computed.
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrix A. lda >= max(1, m).
+ *
+ * @param[in] omega
+ *          The Gaussian matrix of dimension ldo-by-(maxrank+2*nb) used to
+ *          sample A. It is not modified, such that it can be shared by all
+ *          the blocks with the same number of columns.
+ *
+ * @param[in] ldo
+ *          The leading dimension of the matrix omega. ldo >= max(1, n).
+ *
+ * @param[out] Q
+ *          The matrix of dimension ldq-by-(maxrank+nb). On exit, the first k
+ *          columns hold the orthonormal basis, where k is the returned value.
+ *
+ * @param[in] ldq
+ *          The leading dimension of the matrix Q. ldq >= max(1, m).
+ *
+ * @param[in] work
+ *          Workspace array of size lwork.
+ *
+ * @param[in] lwork
+ *          The dimension of the work area. lwork >= nb * (maxrank + nb + 1).
+ *          If lwork == -1, the function returns immediately and work[0]
+ *          contains the optimal size of work.
+ *
+ * @param[out] normR
+ *          On exit, the estimated frobenius norm of the residual, or -1. if it
+ *          has not been estimated.
+ *
+ *******************************************************************************
+ *
+ * @return This routine will return the size of the basis (>=0) or -1 if it
+ *         didn't manage to reach the tolerance within maxrank vectors.
+ *
+ *******************************************************************************/
+int
+core_zarrf( double                    tol,
+            pastix_int_t              maxrank,
+            pastix_int_t              nb,
+            pastix_int_t              m,
+            pastix_int_t              n,
+            const pastix_complex64_t *A,
+            pastix_int_t              lda,
+            const pastix_complex64_t *omega,
+            pastix_int_t              ldo,
+            pastix_complex64_t       *Q,
+            pastix_int_t              ldq,
+            pastix_complex64_t       *work,
+            pastix_int_t              lwork,
+            double                   *normR )
+{
+    pastix_int_t        bp = ( nb < 0 ) ? PASTIX_LR_ARRF_NB : nb;
+    pastix_int_t        k, s, minMN, lwkopt;
+    int                 ret;
+
+    minMN = pastix_imin( m, n );
+    if ( (maxrank < 0) || (maxrank > minMN) ) {
+        maxrank = minMN;
+    }
+
+    lwkopt = bp + maxrank * bp + bp * bp;
+    if ( lwork == -1 ) {
+        work[0] = (pastix_complex64_t)lwkopt;
+        return 0;
+    }
+#if !defined(NDEBUG)
+    if (m < 0) {
+        return -1;
+    }
+    if (n < 0) {
+        return -2;
+    }
+    if (lda < pastix_imax(1, m)) {
+        return -4;
+    }
+    if (ldo < pastix_imax(1, n)) {
+        return -6;
+    }
+    if (ldq < pastix_imax(1, m)) {
+        return -8;
+    }
+    if( lwork < lwkopt ) {
+        return -10;
+    }
+#endif
+
+    *normR = -1.;
+    k = 0;
+    s = 0;
+    while ( 1 )
+    {
+        if ( (tol < 0.) && (k >= maxrank) ) {
+            return k;
+        }
+
+        /* Draw a new batch of samples at the end of the basis */
+        cblas_zgemm( CblasColMajor, CblasNoTrans, CblasNoTrans,
+                     m, bp, n,
+                     CBLAS_SADDR(zone),  A,             lda,
+                                         omega + s*ldo, ldo,
+                     CBLAS_SADDR(zzero), Q + k*ldq,     ldq );
+        s += bp;
+
+        ret = core_zarrf_append( tol, maxrank, bp, m, Q, ldq, &k, work, normR );
+        if ( ret > 0 ) {
+            return k;
+        }
+        if ( ret < 0 ) {
+            return -1;
+        }
+    }
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Initialize the compression of a block with the adaptive randomized
+ * range finder.
+ *
+ * The tolerance is converted to an absolute one, and the maximal size of the
+ * basis is computed. If the block does not need to be sampled, Alr is directly
+ * initialized with the null or the full-rank representation of A.
+ *
+ *******************************************************************************
+ *
+ * @param[in] use_reltol
+ *          Defines if the kernel should use relative tolerance (tol *||A||), or
+ *          absolute tolerance (tol).
+ *
+ * @param[inout] tol
+ *          On entry, the tolerance of the compression. On exit, the absolute
+ *          tolerance, or -1 to compress up to the rank limit.
+ *
+ * @param[inout] rklimit
+ *          On entry, the maximum rank to store the matrix in low-rank format,
+ *          or -1 for core_get_rklimit(m, n). On exit, the maximum rank.
+ *
+ * @param[in] m
+ *          Number of rows of the matrix A.
+ *
+ * @param[in] n
+ *          Number of columns of the matrix A.
+ *
+ * @param[in] A
+ *          The matrix of dimension lda-by-n that needs to be compressed.
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrix A. lda >= max(1, m).
+ *
+ * @param[out] Alr
+ *          The low rank matrix structure that is initialized if the block does
+ *          not need to be sampled.
+ *
+ *******************************************************************************
+ *
+ * @return The maximal size of the basis, or -1 if Alr has been initialized.
+ *
+ *******************************************************************************/
+static inline pastix_int_t
+core_zarrf_setup( int                       use_reltol,
+                  pastix_fixdbl_t          *tol,
+                  pastix_int_t             *rklimit,
+                  pastix_int_t              m,
+                  pastix_int_t              n,
+                  const pastix_complex64_t *A,
+                  pastix_int_t              lda,
+                  pastix_lrblock_t         *Alr )
+{
+    pastix_int_t maxrank;
+    double       norm;
+    int          ret;
+
+    norm = LAPACKE_zlange_work( LAPACK_COL_MAJOR, 'f', m, n,
+                                A, lda, NULL );
+
+    /* Quick return on norm */
+    if ( (norm == 0.) && (*tol >= 0.) ) {
+        core_zlralloc( m, n, 0, Alr );
+        return -1;
+    }
+
+    *rklimit = ( *rklimit < 0 ) ? core_get_rklimit( m, n ) : *rklimit;
+    if ( *tol < 0. ) {
+        *tol = -1.;
+    }
+    else if ( use_reltol ) {
+        *tol = (*tol) * norm;
+    }
+
+    maxrank = pastix_imin( pastix_imin( m, n ), *rklimit );
+
+    /**
+     * If maximum rank is 0, then either the matrix norm is below the tolerance,
+     * and we can return a null rank matrix, or it is not and we need to return
+     * a full rank matrix.
+     */
+    if ( maxrank == 0 ) {
+        if ( (*tol < 0.) || (norm < *tol) ) {
+            core_zlralloc( m, n, 0, Alr );
+            return -1;
+        }
+
+        /* Return full rank */
+        core_zlralloc( m, n, -1, Alr );
+        ret = LAPACKE_zlacpy_work( LAPACK_COL_MAJOR, 'A', m, n,
+                                   A, lda, Alr->u, Alr->rkmax );
+        assert(ret == 0);
+        (void)ret;
+        return -1;
+    }
+
+    return maxrank;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Query the workspace of the adaptive randomized range finder, and of
+ * the final SVD, for a basis of at most maxrank vectors.
+ *
+ *******************************************************************************/
+static inline pastix_int_t
+core_zarrf_getws( pastix_int_t maxrank,
+                  pastix_int_t n )
+{
+    pastix_complex64_t ws;
+    pastix_int_t       lwarrf, lwsvd;
+    double             normR;
+
+    core_zarrf( -1., maxrank, PASTIX_LR_ARRF_NB, maxrank, n, NULL, maxrank,
+                NULL, n, NULL, maxrank, &ws, -1, &normR );
+    lwarrf = (pastix_int_t)ws;
+
+#if defined(PASTIX_DEBUG_LR_NANCHECK)
+    ws = maxrank;
+#else
+    {
+        double rwkopt;
+        MYLAPACKE_zgesvd_work( LAPACK_COL_MAJOR, 'S', 'O',
+                               maxrank, n, NULL, maxrank,
+                               NULL, NULL, maxrank, NULL, maxrank,
+                               &ws, -1, &rwkopt );
+        (void)rwkopt;
+    }
+#endif
+    lwsvd = (pastix_int_t)ws;
+
+    return pastix_imax( lwarrf, lwsvd );
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Build the low-rank representation of A from the basis computed by
+ * the adaptive randomized range finder.
+ *
+ * The basis Q is refined with the SVD of the small matrix Q^h A to remove the
+ * oversampling of the last batch, and the rank is chosen such that the
+ * estimated residual of the final representation is below the tolerance.
+ *
+ *******************************************************************************
+ *
+ * @param[in] tol
+ *          The absolute tolerance, or -1 to keep the full basis.
+ *
+ * @param[in] rklimit
+ *          The maximum rank to store the matrix in low-rank format.
+ *
+ * @param[in] maxrank
+ *          The maximal size of the basis.
+ *
+ * @param[in] m
+ *          Number of rows of the matrix A.
+ *
+ * @param[in] n
+ *          Number of columns of the matrix A.
+ *
+ * @param[in] A
+ *          The matrix of dimension lda-by-n that is compressed.
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrix A. lda >= max(1, m).
+ *
+ * @param[in] Q
+ *          The orthonormal basis of dimension ldq-by-k.
+ *
+ * @param[in] ldq
+ *          The leading dimension of the matrix Q. ldq >= max(1, m).
+ *
+ * @param[in] k
+ *          The size of the basis returned by core_zarrf(), or -1 if the
+ *          tolerance has not been reached.
+ *
+ * @param[in] normR
+ *          The estimated frobenius norm of the residual of the basis.
+ *
+ * @param[in] zwork
+ *          Workspace array of size maxrank * (n + maxrank) + lwork.
+ *
+ * @param[in] lwork
+ *          The size of the workspace of the SVD, see core_zarrf_getws().
+ *
+ * @param[in] rwork
+ *          Real workspace array of size maxrank, and 6 * maxrank in complex
+ *          arithmetic.
+ *
+ * @param[out] Alr
+ *          The low rank matrix structure that will store the low rank
+ *          representation of A.
+ *
+ *******************************************************************************
+ *
+ * @return The number of flops used to compute the basis and the low-rank
+ *         representation.
+ *
+ *******************************************************************************/
+static inline pastix_fixdbl_t
+core_zarrf_lrfinal( pastix_fixdbl_t           tol,
+                    pastix_int_t              rklimit,
+                    pastix_int_t              maxrank,
+                    pastix_int_t              m,
+                    pastix_int_t              n,
+                    const pastix_complex64_t *A,
+                    pastix_int_t              lda,
+                    const pastix_complex64_t *Q,
+                    pastix_int_t              ldq,
+                    pastix_int_t              k,
+                    double                    normR,
+                    pastix_complex64_t       *zwork,
+                    pastix_int_t              lwork,
+                    double                   *rwork,
+                    pastix_lrblock_t         *Alr )
+{
+    pastix_int_t        bp = PASTIX_LR_ARRF_NB;
+    pastix_complex64_t *B, *Ub, *work;
+    double             *s;
+    pastix_fixdbl_t     flops;
+    pastix_int_t        i, r;
+    double              tail;
+    int                 ret;
+
+    if ( k == -1 ) {
+        flops = FLOPS_ZGEMM( m, maxrank + bp, n ) + FLOPS_ZGEQRF( m, maxrank );
+
+        core_zlralloc( m, n, -1, Alr );
+        ret = LAPACKE_zlacpy_work( LAPACK_COL_MAJOR, 'A', m, n,
+                                   A, lda, Alr->u, Alr->rkmax );
+        assert(ret == 0);
+        (void)ret;
+        return flops;
+    }
+
+    flops = FLOPS_ZGEMM( m, k + bp, n ) + FLOPS_ZGEQRF( m, k );
+    if ( k == 0 ) {
+        core_zlralloc( m, n, 0, Alr );
+        return flops;
+    }
+
+    B    = zwork;
+    Ub   = B  + maxrank * n;
+    work = Ub + maxrank * maxrank;
+    s    = rwork;
+
+    /* B = Q^h A, and its SVD B = Ub S Vb^h stored in place of B */
+    cblas_zgemm( CblasColMajor, CblasConjTrans, CblasNoTrans,
+                 k, n, m,
+                 CBLAS_SADDR(zone),  Q, ldq,
+                                     A, lda,
+                 CBLAS_SADDR(zzero), B, k );
+    flops += FLOPS_ZGEMM( k, n, m );
+
+    ret = MYLAPACKE_zgesvd_work( LAPACK_COL_MAJOR, 'S', 'O',
+                                 k, n, B, k,
+                                 s, Ub, k, NULL, k,
+                                 work, lwork, rwork + maxrank );
+    if ( ret != 0 ) {
+        pastix_print_error( "SVD Failed\n" );
+    }
+    flops += FLOPS_ZGEBRD( k, n );
+
+    /*
+     * Select the smallest rank r such that the residual of the projection and
+     * the trailing singular values are below the tolerance.
+     */
+    if ( tol < 0. ) {
+        r = k;
+    }
+    else {
+        normR = ( normR < 0. ) ? 0. : normR;
+        tail  = normR * normR;
+        r = k;
+        for( i=k-1; i>=0; i-- ) {
+            tail += s[i] * s[i];
+            if ( sqrt( tail ) >= tol ) {
+                break;
+            }
+            r = i;
+        }
+    }
+
+    /* The truncation may only reduce the rank under rklimit */
+    if ( r > rklimit ) {
+        core_zlralloc( m, n, -1, Alr );
+        ret = LAPACKE_zlacpy_work( LAPACK_COL_MAJOR, 'A', m, n,
+                                   A, lda, Alr->u, Alr->rkmax );
+        assert(ret == 0);
+        return flops;
+    }
+
+    core_zlralloc( m, n, r, Alr );
+    Alr->rk = r;
+    if ( r > 0 ) {
+        pastix_complex64_t *V = Alr->v;
+
+        /* U = Q * Ub(:, 1:r) */
+        cblas_zgemm( CblasColMajor, CblasNoTrans, CblasNoTrans,
+                     m, r, k,
+                     CBLAS_SADDR(zone),  Q,  ldq,
+                                         Ub, k,
+                     CBLAS_SADDR(zzero), Alr->u, m );
+        flops += FLOPS_ZGEMM( m, r, k );
+
+        /* V = S(1:r) * Vb(:, 1:r)^h */
+        ret = LAPACKE_zlacpy_work( LAPACK_COL_MAJOR, 'A', r, n,
+                                   B, k, V, Alr->rkmax );
+        assert(ret == 0);
+        for( i=0; i<r; i++ ) {
+            cblas_zdscal( n, s[i], V + i, Alr->rkmax );
+        }
+    }
+
+    (void)ret;
+    return flops;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Convert a full rank matrix in a low rank matrix, using the adaptive
+ * randomized range finder with a Gaussian matrix provided by the caller.
+ *
+ *******************************************************************************
+ *
+ * @param[in] use_reltol
+ *          Defines if the kernel should use relative tolerance (tol *||A||), or
+ *          absolute tolerance (tol).
+ *
+ * @param[in] tol
+ *          The tolerance used as a criterion to eliminate information from the
+ *          full rank matrix.
+ *          If tol < 0, then we compress up to rklimit.
+ *
+ * @param[in] rklimit
+ *          The maximum rank to store the matrix in low-rank format. If
+ *          -1, set to core_get_rklimit(m, n).
+ *
+ * @param[in] m
+ *          Number of rows of the matrix A, and of the low rank matrix Alr.
+ *
+ * @param[in] n
+ *          Number of columns of the matrix A, and of the low rank matrix Alr.
+ *
+ * @param[in] Avoid
+ *          The matrix of dimension lda-by-n that needs to be compressed
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrix A. lda >= max(1, m)
+ *
+ * @param[in] omega
+ *          The Gaussian matrix of dimension ldo-by-(min(rklimit, m, n) + 2 *
+ *          PASTIX_LR_ARRF_NB) used to sample A. It can be shared by all the
+ *          blocks with n columns.
+ *
+ * @param[in] ldo
+ *          The leading dimension of the matrix omega. ldo >= max(1, n)
+ *
+ * @param[out] Alr
+ *          The low rank matrix structure that will store the low rank
+ *          representation of A
+ *
+ *******************************************************************************
+ *
+ * @return The number of flops used to compress the matrix.
+ *
+ *******************************************************************************/
+pastix_fixdbl_t
+core_zge2lr_arrf_sketch( int                       use_reltol,
+                         pastix_fixdbl_t           tol,
+                         pastix_int_t              rklimit,
+                         pastix_int_t              m,
+                         pastix_int_t              n,
+                         const void               *Avoid,
+                         pastix_int_t              lda,
+                         const pastix_complex64_t *omega,
+                         pastix_int_t              ldo,
+                         pastix_lrblock_t         *Alr )
+{
+    const pastix_complex64_t *A = (const pastix_complex64_t*)Avoid;
+    pastix_fixdbl_t     flops;
+    pastix_complex64_t *zwork, *Q;
+    double             *rwork;
+    pastix_int_t        bp = PASTIX_LR_ARRF_NB;
+    pastix_int_t        k, maxrank, ldq;
+    pastix_int_t        lwork, zsize, rsize;
+    double              normR;
+
+    maxrank = core_zarrf_setup( use_reltol, &tol, &rklimit, m, n, A, lda, Alr );
+    if ( maxrank == -1 ) {
+        return 0.;
+    }
+
+    lwork = core_zarrf_getws( maxrank, n );
+
+    ldq   = m;
+    zsize = ldq * (maxrank + bp);             /* Q      */
+    zsize += maxrank * (n + maxrank) + lwork; /* B, Ub  */
+
+    rsize = maxrank;
+#if defined(PRECISION_z) || defined(PRECISION_c)
+    rsize += 5 * maxrank;
+#endif
+
+    zwork = malloc( zsize * sizeof(pastix_complex64_t) + rsize * sizeof(double) );
+    Q     = zwork;
+    rwork = (double*)(zwork + zsize);
+
+    k = core_zarrf( tol, maxrank, bp, m, n, A, lda, omega, ldo,
+                    Q, ldq, Q + ldq * (maxrank + bp), lwork, &normR );
+
+    flops = core_zarrf_lrfinal( tol, rklimit, maxrank, m, n, A, lda,
+                                Q, ldq, k, normR,
+                                Q + ldq * (maxrank + bp), lwork, rwork, Alr );
+
+    memFree_null( zwork );
+    return flops;
+}
+
+/**
+ * @brief The state of a block compressed by core_zge2lr_arrf_stack().
+ */
+typedef struct core_zarrf_blok_s {
+    pastix_fixdbl_t     tol;     /**< The absolute tolerance of the block             */
+    double              normR;   /**< The estimated norm of the residual              */
+    pastix_int_t        rklimit; /**< The maximum rank of the low-rank representation */
+    pastix_int_t        maxrank; /**< The maximum size of the basis, -1 if done       */
+    pastix_int_t        k;       /**< The size of the basis, -1 if not reached        */
+    int                 active;  /**< True while the block is sampled                 */
+    pastix_complex64_t *Q;       /**< The basis of the block                          */
+} core_zarrf_blok_t;
+
+/**
+ *******************************************************************************
+ *
+ * @brief Convert a set of full rank matrices with the same number of columns
+ * in low rank matrices, using the adaptive randomized range finder with a
+ * single Gaussian matrix.
+ *
+ * The matrices are stacked in a single matrix A = [A_1; ...; A_nblk], such that
+ * each batch of samples is drawn with a single product A * omega(:, s:s+nb) for
+ * all the blocks. Once a block has converged, its rows are skipped, and the
+ * product is applied on the ranges of consecutive blocks that are still
+ * sampled. Each block then reads its own rows of the stacked samples to extend
+ * its basis and to estimate its residual, such that it gets its own rank and
+ * stops independently of the others.
+ *
+ *******************************************************************************
+ *
+ * @param[in] use_reltol
+ *          Defines if the kernel should use relative tolerance (tol *||A_i||),
+ *          or absolute tolerance (tol).
+ *
+ * @param[in] tol
+ *          The tolerance used as a criterion to eliminate information from the
+ *          full rank matrices.
+ *          If tol < 0, then we compress up to rklimit.
+ *
+ * @param[in] nblk
+ *          The number of stacked matrices.
+ *
+ * @param[in] rklimit
+ *          Array of size nblk with the maximum rank to store each matrix in
+ *          low-rank format. If -1, set to core_get_rklimit(m_i, n).
+ *
+ * @param[in] offset
+ *          Array of size nblk+1. The matrix A_i is stored in the rows
+ *          offset[i] to offset[i+1]-1 of A.
+ *
+ * @param[in] n
+ *          Number of columns of the matrices.
+ *
+ * @param[in] A
+ *          The stacked matrix of dimension lda-by-n.
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrix A. lda >= max(1, offset[nblk]).
+ *
+ * @param[in] omega
+ *          The Gaussian matrix of dimension ldo-by-(max(min(rklimit_i, m_i, n))
+ *          + 2 * PASTIX_LR_ARRF_NB) used to sample the matrices.
+ *
+ * @param[in] ldo
+ *          The leading dimension of the matrix omega. ldo >= max(1, n)
+ *
+ * @param[out] Alr
+ *          Array of size nblk of the low rank matrix structures that will store
+ *          the low rank representation of each A_i.
+ *
+ *******************************************************************************
+ *
+ * @return The number of flops used to compress the matrices.
+ *
+ *******************************************************************************/
+pastix_fixdbl_t
+core_zge2lr_arrf_stack( int                       use_reltol,
+                        pastix_fixdbl_t           tol,
+                        pastix_int_t              nblk,
+                        const pastix_int_t       *rklimit,
+                        const pastix_int_t       *offset,
+                        pastix_int_t              n,
+                        const pastix_complex64_t *A,
+                        pastix_int_t              lda,
+                        const pastix_complex64_t *omega,
+                        pastix_int_t              ldo,
+                        pastix_lrblock_t        **Alr )
+{
+    core_zarrf_blok_t  *bloks, *st;
+    pastix_fixdbl_t     flops = 0.;
+    pastix_complex64_t *zwork, *Q, *Y, *work;
+    double             *rwork;
+    pastix_int_t        bp = PASTIX_LR_ARRF_NB;
+    pastix_int_t        i, j, m, s, nactive, maxrank;
+    pastix_int_t        lwork, zsize, rsize;
+    int                 ret;
+
+    MALLOC_INTERN( bloks, nblk, core_zarrf_blok_t );
+
+    /* Initialize the blocks, and compute the size of their bases */
+    zsize   = 0;
+    maxrank = 0;
+    nactive = 0;
+    for( i=0, st=bloks; i<nblk; i++, st++ ) {
+        m = offset[i+1] - offset[i];
+
+        st->tol     = tol;
+        st->normR   = -1.;
+        st->rklimit = rklimit[i];
+        st->maxrank = core_zarrf_setup( use_reltol, &(st->tol), &(st->rklimit),
+                                        m, n, A + offset[i], lda, Alr[i] );
+        st->k       = 0;
+        st->active  = ( st->maxrank != -1 );
+        st->Q       = NULL;
+
+        if ( st->active ) {
+            zsize  += m * (st->maxrank + bp);
+            maxrank = pastix_imax( maxrank, st->maxrank );
+            nactive++;
+        }
+    }
+
+    if ( nactive == 0 ) {
+        memFree_null( bloks );
+        return 0.;
+    }
+
+    lwork  = core_zarrf_getws( maxrank, n );
+    zsize += offset[nblk] * bp;                /* Y     */
+    zsize += maxrank * (n + maxrank) + lwork;  /* B, Ub */
+
+    rsize = maxrank;
+#if defined(PRECISION_z) || defined(PRECISION_c)
+    rsize += 5 * maxrank;
+#endif
+
+    zwork = malloc( zsize * sizeof(pastix_complex64_t) + rsize * sizeof(double) );
+    rwork = (double*)(zwork + zsize);
+
+    Q = zwork;
+    for( i=0, st=bloks; i<nblk; i++, st++ ) {
+        if ( st->active ) {
+            st->Q = Q;
+            Q += (offset[i+1] - offset[i]) * (st->maxrank + bp);
+        }
+    }
+    Y    = Q;
+    work = Y + offset[nblk] * bp;
+
+    s = 0;
+    while ( nactive > 0 )
+    {
+        /* Stop the blocks that reached their maximal rank without tolerance */
+        for( i=0, st=bloks; i<nblk; i++, st++ ) {
+            if ( st->active && (st->tol < 0.) && (st->k >= st->maxrank) ) {
+                st->active = 0;
+                nactive--;
+            }
+        }
+        if ( nactive == 0 ) {
+            break;
+        }
+
+        /* Draw a new batch of samples for each range of active blocks */
+        for( i=0; i<nblk; i=j ) {
+            if ( !bloks[i].active ) {
+                j = i + 1;
+                continue;
+            }
+            for( j=i+1; (j<nblk) && bloks[j].active; j++ );
+
+            cblas_zgemm( CblasColMajor, CblasNoTrans, CblasNoTrans,
+                         offset[j] - offset[i], bp, n,
+                         CBLAS_SADDR(zone),  A + offset[i], lda,
+                                             omega + s*ldo, ldo,
+                         CBLAS_SADDR(zzero), Y + offset[i], offset[nblk] );
+        }
+        s += bp;
+
+        /* Extend the basis of each block with its own samples */
+        for( i=0, st=bloks; i<nblk; i++, st++ ) {
+            if ( !st->active ) {
+                continue;
+            }
+            m = offset[i+1] - offset[i];
+
+            ret = LAPACKE_zlacpy_work( LAPACK_COL_MAJOR, 'A', m, bp,
+                                       Y + offset[i], offset[nblk],
+                                       st->Q + st->k * m, m );
+            assert( ret == 0 );
+
+            ret = core_zarrf_append( st->tol, st->maxrank, bp, m,
+                                     st->Q, m, &(st->k), work, &(st->normR) );
+            if ( ret != 0 ) {
+                st->active = 0;
+                nactive--;
+                if ( ret < 0 ) {
+                    st->k = -1;
+                }
+            }
+        }
+    }
+
+    /* Build the low-rank representation of each block */
+    for( i=0, st=bloks; i<nblk; i++, st++ ) {
+        if ( st->maxrank == -1 ) {
+            continue;
+        }
+        m = offset[i+1] - offset[i];
+
+        flops += core_zarrf_lrfinal( st->tol, st->rklimit, st->maxrank, m, n,
+                                     A + offset[i], lda, st->Q, m, st->k, st->normR,
+                                     work, lwork, rwork, Alr[i] );
+    }
+
+    (void)ret;
+    memFree_null( zwork );
+    memFree_null( bloks );
+    return flops;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Convert a full rank matrix in a low rank matrix, using the adaptive
+ * randomized range finder.
+ *
+ * The Gaussian matrix is generated for this single block. See
+ * core_zge2lr_arrf_sketch() to share it among multiple blocks.
+ *
+ *******************************************************************************
+ *
+ * @param[in] use_reltol
+ *          Defines if the kernel should use relative tolerance (tol *||A||), or
+ *          absolute tolerance (tol).
+ *
+ * @param[in] tol
+ *          The tolerance used as a criterion to eliminate information from the
+ *          full rank matrix.
+ *          If tol < 0, then we compress up to rklimit.
+ *
+ * @param[in] rklimit
+ *          The maximum rank to store the matrix in low-rank format. If
+ *          -1, set to core_get_rklimit(m, n).
+ *
+ * @param[in] m
+ *          Number of rows of the matrix A, and of the low rank matrix Alr.
+ *
+ * @param[in] n
+ *          Number of columns of the matrix A, and of the low rank matrix Alr.
+ *
+ * @param[in] A
+ *          The matrix of dimension lda-by-n that needs to be compressed
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrix A. lda >= max(1, m)
+ *
+ * @param[out] Alr
+ *          The low rank matrix structure that will store the low rank
+ *          representation of A
+ *
+ *******************************************************************************
+ *
+ * @return The number of flops used to compress the matrix.
+ *
+ *******************************************************************************/
+pastix_fixdbl_t
+core_zge2lr_arrf( int               use_reltol,
+                  pastix_fixdbl_t   tol,
+                  pastix_int_t      rklimit,
+                  pastix_int_t      m,
+                  pastix_int_t      n,
+                  const void       *A,
+                  pastix_int_t      lda,
+                  pastix_lrblock_t *Alr )
+{
+    int                 SEED[4] = {26, 67, 52, 197};
+    pastix_complex64_t *omega;
+    pastix_fixdbl_t     flops;
+    pastix_int_t        maxrank, size_O;
+    int                 ret;
+
+    maxrank = ( rklimit < 0 ) ? core_get_rklimit( m, n ) : rklimit;
+    maxrank = pastix_imin( pastix_imin( m, n ), maxrank );
+    size_O  = n * ( maxrank + 2 * PASTIX_LR_ARRF_NB );
+
+    MALLOC_INTERN( omega, size_O, pastix_complex64_t );
+    ret = LAPACKE_zlarnv_work( 3, SEED, size_O, omega );
+    assert( ret == 0 );
+
+    flops = core_zge2lr_arrf_sketch( use_reltol, tol, rklimit, m, n,
+                                     A, lda, omega, n, Alr );
+
+    (void)ret;
+    memFree_null( omega );
+    return flops;
+}
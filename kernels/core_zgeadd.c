@@ -110,6 +110,10 @@ core_zgeadd( pastix_trans_t            trans,
     }
 #endif
 
+    if ( core_zgeadd_small( trans, M, N, alpha, A, LDA, beta, B, LDB ) == PASTIX_SUCCESS ) {
+        return PASTIX_SUCCESS;
+    }
+
     switch( trans ) {
 #if defined(PRECISION_z) || defined(PRECISION_c)
     case PastixConjTrans:
@@ -61,7 +61,7 @@ core_zlralloc( pastix_int_t      M,
     pastix_complex64_t *u, *v;
 
     if ( rkmax == -1 ) {
-        u = malloc( M * N * sizeof(pastix_complex64_t) );
+        u = pastix_lrmem_malloc( M * N * sizeof(pastix_complex64_t) );
         memset( u, 0, M * N * sizeof(pastix_complex64_t) );
         A->rk = -1;
         A->rkmax = M;
@@ -79,14 +79,14 @@ core_zlralloc( pastix_int_t      M,
         rkmax = pastix_imin( rkmax, rk );
 
 #if defined(PASTIX_DEBUG_LR)
-        u = malloc( M * rkmax * sizeof(pastix_complex64_t) );
-        v = malloc( N * rkmax * sizeof(pastix_complex64_t) );
+        u = pastix_lrmem_malloc( M * rkmax * sizeof(pastix_complex64_t) );
+        v = pastix_lrmem_malloc( N * rkmax * sizeof(pastix_complex64_t) );
 
         /* To avoid uninitialised values in valgrind. Lapacke doc (xgesvd) is not correct */
         memset(u, 0, M * rkmax * sizeof(pastix_complex64_t));
         memset(v, 0, N * rkmax * sizeof(pastix_complex64_t));
 #else
-        u = malloc( (M+N) * rkmax * sizeof(pastix_complex64_t));
+        u = pastix_lrmem_malloc( (M+N) * rkmax * sizeof(pastix_complex64_t));
 
         /* To avoid uninitialised values in valgrind. Lapacke doc (xgesvd) is not correct */
         memset(u, 0, (M+N) * rkmax * sizeof(pastix_complex64_t));
@@ -116,13 +116,13 @@ void
 core_zlrfree( pastix_lrblock_t *A )
 {
     if ( A->rk == -1 ) {
-        free(A->u);
+        pastix_lrmem_free(A->u);
         A->u = NULL;
     }
     else {
-        free(A->u);
+        pastix_lrmem_free(A->u);
 #if defined(PASTIX_DEBUG_LR)
-        free(A->v);
+        pastix_lrmem_free(A->v);
 #endif
         A->u = NULL;
         A->v = NULL;
@@ -190,9 +190,9 @@ core_zlrsze( int               copy,
      */
     if ( (newrk > rklimit) || (newrk == -1) )
     {
-        A->u = realloc( A->u, M * N * sizeof(pastix_complex64_t) );
+        A->u = pastix_lrmem_realloc( A->u, M * N * sizeof(pastix_complex64_t) );
 #if defined(PASTIX_DEBUG_LR)
-        free(A->v);
+        pastix_lrmem_free(A->v);
 #endif
         A->v = NULL;
         A->rk = -1;
@@ -207,9 +207,9 @@ core_zlrsze( int               copy,
         /*
          * The rank is null, we free everything
          */
-        free(A->u);
+        pastix_lrmem_free(A->u);
 #if defined(PASTIX_DEBUG_LR)
-        free(A->v);
+        pastix_lrmem_free(A->v);
 #endif
         A->u = NULL;
         A->v = NULL;
@@ -228,10 +228,10 @@ core_zlrsze( int               copy,
              (( A->rk != -1 ) && (newrkmax != A->rkmax)) )
         {
 #if defined(PASTIX_DEBUG_LR)
-            u = malloc( M * newrkmax * sizeof(pastix_complex64_t) );
-            v = malloc( N * newrkmax * sizeof(pastix_complex64_t) );
+            u = pastix_lrmem_malloc( M * newrkmax * sizeof(pastix_complex64_t) );
+            v = pastix_lrmem_malloc( N * newrkmax * sizeof(pastix_complex64_t) );
 #else
-            u = malloc( (M+N) * newrkmax * sizeof(pastix_complex64_t) );
+            u = pastix_lrmem_malloc( (M+N) * newrkmax * sizeof(pastix_complex64_t) );
             v = u + M * newrkmax;
 #endif
             if ( copy ) {
@@ -243,9 +243,9 @@ core_zlrsze( int               copy,
                                            A->v, A->rkmax, v, newrkmax );
                 assert(ret == 0);
             }
-            free(A->u);
+            pastix_lrmem_free(A->u);
 #if defined(PASTIX_DEBUG_LR)
-            free(A->v);
+            pastix_lrmem_free(A->v);
 #endif
             A->u = u;
             A->v = v;
@@ -19,6 +19,8 @@
  *
  **/
 #include "common.h"
+#include "blend/solver.h"
+#include "pastix_zcores.h"
 #include "cblas.h"
 #include "lapacke.h"
 
@@ -208,6 +210,12 @@ core_zgemdm( pastix_trans_t            transA,
         return PASTIX_SUCCESS;
     }
 
+    if ( core_zgemdm_small( transA, transB, M, N, K, alpha, A, LDA, B, LDB,
+                            beta, C, LDC, D, incD ) == PASTIX_SUCCESS )
+    {
+        return PASTIX_SUCCESS;
+    }
+
     if ( incD == 1 ) {
         wD = D;
     } else {
@@ -30,6 +30,105 @@ static pastix_complex64_t zone  =  1.0;
 static pastix_complex64_t zzero =  0.0;
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
+/**
+ *******************************************************************************
+ *
+ * @ingroup kernel_fact_null
+ *
+ * @brief Add the 1D update stored in a temporary buffer to the facing cblk.
+ *
+ * Performs C = C - W, where the rows of W are the rows of the blocks from
+ * fblok to lblok excluded, and where C is the column of the facing cblk
+ * receiving the update. The block receiving the contribution of each block is
+ * given by the map computed during the analysis, so the facing blocks do not
+ * have to be searched for. Each facing block is locked once for all the
+ * consecutive blocks it receives.
+ *
+ * The function is compiled for AVX-512, AVX2, and the generic architecture
+ * when the compiler supports it, the best version being selected at runtime.
+ *
+ *******************************************************************************
+ *
+ * @param[in] fblok
+ *          The first block of the cblk that contributes to the update.
+ *
+ * @param[in] lblok
+ *          The block following the last one that contributes to the update.
+ *
+ * @param[inout] fcblk
+ *          The facing cblk that receives the update.
+ *
+ * @param[in] scatmap
+ *          Array of size (lblok - fblok). scatmap[i] is the index of the
+ *          block of fcblk receiving the contribution of fblok[i], relatively
+ *          to fcblk->fblokptr.
+ *
+ * @param[in] M
+ *          The number of rows of W, equal to the sum of the rows of the blocks
+ *          from fblok to lblok excluded.
+ *
+ * @param[in] N
+ *          The number of columns of W and C.
+ *
+ * @param[in] W
+ *          The M-by-N matrix W of leading dimension M.
+ *
+ * @param[inout] C
+ *          The pointer to the first column of the facing cblk coeftab
+ *          receiving the update.
+ *
+ * @param[in] ldc
+ *          The leading dimension of C.
+ *
+ *******************************************************************************/
+pastix_target_clones void
+cpublok_zscatter( const SolverBlok                   *fblok,
+                  const SolverBlok                   *lblok,
+                  SolverCblk                         *fcblk,
+                  const pastix_int_t                 *scatmap,
+                  pastix_int_t                        M,
+                  pastix_int_t                        N,
+                  const pastix_complex64_t * restrict W,
+                  pastix_complex64_t       * restrict C,
+                  pastix_int_t                        ldc )
+{
+    const SolverBlok         *iterblok;
+    SolverBlok               *cblok;
+    SolverBlok               *locked = NULL;
+    const pastix_complex64_t *Wb;
+    pastix_complex64_t       *Cb;
+    pastix_int_t i, j, m;
+
+    for( iterblok = fblok; iterblok < lblok; iterblok++, scatmap++ ) {
+        cblok = fcblk->fblokptr + (*scatmap);
+        assert( is_block_inside_fblock( iterblok, cblok ) );
+
+        if ( cblok != locked ) {
+            if ( locked != NULL ) {
+                pastix_blok_unlock( locked );
+            }
+            pastix_blok_lock( cblok );
+            locked = cblok;
+        }
+
+        m  = blok_rownbr( iterblok );
+        Wb = W;
+        Cb = C + cblok->coefind + iterblok->frownum - cblok->frownum;
+        for( j=0; j<N; j++, Wb+=M, Cb+=ldc ) {
+            for( i=0; i<m; i++ ) {
+                Cb[i] -= Wb[i];
+            }
+        }
+
+        /* Displacement to next block */
+        W += m;
+    }
+
+    if ( locked != NULL ) {
+        pastix_blok_unlock( locked );
+    }
+}
+
 /**
  *******************************************************************************
  *
@@ -112,7 +211,7 @@ core_zgemmsp_1d1d( pastix_coefside_t         sideA,
                    pastix_complex64_t       *work )
 {
     const SolverBlok *iterblok;
-    const SolverBlok *fblok;
+    SolverBlok       *fblok;
     const SolverBlok *lblok;
 
     pastix_complex64_t *tmpC;
@@ -159,14 +258,21 @@ core_zgemmsp_1d1d( pastix_coefside_t         sideA,
      * Add contribution to C in fcblk
      */
 
-    /* Get the first block of the distant panel */
-    fblok = fcblk->fblokptr;
-
     /* Move the pointer to the top of the right column */
     C = C + (blok->frownum - fcblk->fcolnum) * stridef;
 
     lblok = cblk[1].fblokptr;
 
+    /* Use the facing blocks computed during the analysis */
+    if ( blok->scatmap != NULL ) {
+        cpublok_zscatter( blok + shift, lblok, fcblk, blok->scatmap + shift,
+                          M, N, wtmp, C, stridef );
+        return;
+    }
+
+    /* Get the first block of the distant panel */
+    fblok = fcblk->fblokptr;
+
     /* for all following blocks in block column */
     for (iterblok=blok+shift; iterblok<lblok; iterblok++) {
 
@@ -180,11 +286,11 @@ core_zgemmsp_1d1d( pastix_coefside_t         sideA,
         tmpC = C + fblok->coefind + iterblok->frownum - fblok->frownum;
         m = blok_rownbr( iterblok );
 
-        pastix_cblk_lock( fcblk );
+        pastix_blok_lock( fblok );
         core_zgeadd( PastixNoTrans, m, N,
                      -1.0, wtmp, M,
                       1.0, tmpC, stridef );
-        pastix_cblk_unlock( fcblk );
+        pastix_blok_unlock( fblok );
 
         /* Displacement to next block */
         wtmp += m;
@@ -269,7 +375,7 @@ core_zgemmsp_1d2d( pastix_coefside_t         sideA,
                    pastix_complex64_t       *C )
 {
     const SolverBlok *iterblok;
-    const SolverBlok *fblok;
+    SolverBlok       *fblok;
     const SolverBlok *lblok;
     const pastix_complex64_t *blokA;
     const pastix_complex64_t *blokB;
@@ -320,7 +426,7 @@ core_zgemmsp_1d2d( pastix_coefside_t         sideA,
             + iterblok->frownum - fblok->frownum
             + (blok->frownum - fcblk->fcolnum) * stridef;
 
-        pastix_cblk_lock( fcblk );
+        pastix_blok_lock( fblok );
         kernel_trace_start_lvl2( PastixKernelLvl2_FR_GEMM );
         cblas_zgemm( CblasColMajor, CblasNoTrans, (CBLAS_TRANSPOSE)trans,
                      M, N, K,
@@ -328,7 +434,7 @@ core_zgemmsp_1d2d( pastix_coefside_t         sideA,
                                          blokB, stride,
                      CBLAS_SADDR(zone),  blokC, stridef );
         kernel_trace_stop_lvl2( FLOPS_ZGEMM( M, N, K ) );
-        pastix_cblk_unlock( fcblk );
+        pastix_blok_unlock( fblok );
     }
 }
 
@@ -409,7 +515,7 @@ core_zgemmsp_2d2d( pastix_coefside_t         sideA,
                    pastix_complex64_t       *C )
 {
     const SolverBlok *iterblok;
-    const SolverBlok *fblok;
+    SolverBlok       *fblok;
     const SolverBlok *lblok;
     const pastix_complex64_t *blokA;
     const pastix_complex64_t *blokB;
@@ -459,7 +565,7 @@ core_zgemmsp_2d2d( pastix_coefside_t         sideA,
             + iterblok->frownum - fblok->frownum
             + (blok->frownum - fcblk->fcolnum) * ldc;
 
-        pastix_cblk_lock( fcblk );
+        pastix_blok_lock( fblok );
         kernel_trace_start_lvl2( PastixKernelLvl2_FR_GEMM );
         cblas_zgemm( CblasColMajor, CblasNoTrans, (CBLAS_TRANSPOSE)trans,
                      M, N, K,
@@ -467,7 +573,7 @@ core_zgemmsp_2d2d( pastix_coefside_t         sideA,
                                          blokB, ldb,
                      CBLAS_SADDR(zone),  blokC, ldc );
         kernel_trace_stop_lvl2( FLOPS_ZGEMM( M, N, K ) );
-        pastix_cblk_unlock( fcblk );
+        pastix_blok_unlock( fblok );
     }
 }
 
@@ -780,6 +886,7 @@ core_zgemmsp_block_frlr( pastix_trans_t            transB,
     params.work    = NULL;
     params.lwork   = -1;
     params.lock    = &(lock);
+    params.Cacc    = NULL;
 
     bC = blokC;
     for (bA = blokA; (bA < lblokK) && (bA->fcblknm == cblk_m); bA++) {
@@ -963,6 +1070,7 @@ core_zgemmsp_block_lrlr( pastix_trans_t          transB,
     params.work    = NULL;
     params.lwork   = -1;
     params.lock    = &(lock);
+    params.Cacc    = NULL;
 
     bC = blokC;
     for (bA = blokA; (bA < lblokK) && (bA->fcblknm == cblk_m); bA++, lrA++) {
@@ -1079,13 +1187,14 @@ core_zgemmsp_fulllr( pastix_coefside_t         sideA,
                      const pastix_lr_t        *lowrank )
 {
     const SolverBlok *iterblok;
-    const SolverBlok *fblok;
+    SolverBlok       *fblok;
     const SolverBlok *lblok;
     pastix_lrblock_t  lrA, lrB;
     core_zlrmm_t params;
 
     pastix_int_t stride, shift;
     pastix_int_t M, N;
+    int          sideC;
 
     pastix_fixdbl_t flops = 0.0;
 
@@ -1125,8 +1234,11 @@ core_zgemmsp_fulllr( pastix_coefside_t         sideA,
     params.beta    = 1.0;
     params.work    = work;
     params.lwork   = lwork;
-    params.lock    = &(fcblk->lock);
     params.B       = &lrB;
+    params.Cacc    = NULL;
+
+    /* Side of C in fcblk to find the accumulators of the deferred updates */
+    sideC = ( lrC == fblok->LRblock[1] ) ? 1 : 0;
 
     for (iterblok=blok+shift; iterblok<lblok; iterblok++) {
 
@@ -1149,6 +1261,10 @@ core_zgemmsp_fulllr( pastix_coefside_t         sideA,
         params.A  = &lrA;
         params.C  = lrC;
         params.Cm = blok_rownbr( fblok );
+        params.lock = &(fblok->lock);
+        if ( lowrank->compress_deferred ) {
+            params.Cacc = &(fblok->LRacc[sideC]);
+        }
 
         params.offx = iterblok->frownum - fblok->frownum;
         params.offy = blok->frownum - fcblk->fcolnum;
@@ -1233,10 +1349,11 @@ core_zgemmsp_lr( pastix_coefside_t       sideA,
                  const pastix_lr_t      *lowrank )
 {
     const SolverBlok *iterblok;
-    const SolverBlok *fblok;
+    SolverBlok       *fblok;
     const SolverBlok *lblok;
 
     pastix_int_t N, K, shift;
+    int          sideC;
     core_zlrmm_t params;
 
     pastix_fixdbl_t flops = 0.0;
@@ -1274,8 +1391,11 @@ core_zgemmsp_lr( pastix_coefside_t       sideA,
     params.work    = work;
     params.lwork   = lwork;
     params.lwused  = 0;
-    params.lock    = &(fcblk->lock);
     params.B       = lrB + (blok - cblk->fblokptr);
+    params.Cacc    = NULL;
+
+    /* Side of C in fcblk to find the accumulators of the deferred updates */
+    sideC = ( lrC == fblok->LRblock[1] ) ? 1 : 0;
 
     /* for all following blocks in block column */
     lrA = lrA + (blok - cblk->fblokptr) + shift;
@@ -1293,6 +1413,10 @@ core_zgemmsp_lr( pastix_coefside_t       sideA,
         params.A  = lrA;
         params.C  = lrC;
         params.Cm = blok_rownbr( fblok );
+        params.lock = &(fblok->lock);
+        if ( lowrank->compress_deferred ) {
+            params.Cacc = &(fblok->LRacc[sideC]);
+        }
 
         params.offx = iterblok->frownum - fblok->frownum;
         params.offy = blok->frownum - fcblk->fcolnum;
@@ -1380,7 +1504,7 @@ core_zgemmsp_lrfr( pastix_coefside_t       sideA,
                    const pastix_lr_t      *lowrank )
 {
     const SolverBlok *iterblok;
-    const SolverBlok *fblok;
+    SolverBlok       *fblok;
     const SolverBlok *lblok;
 
     pastix_int_t N, K, shift;
@@ -1422,9 +1546,9 @@ core_zgemmsp_lrfr( pastix_coefside_t       sideA,
     params.work    = work;
     params.lwork   = lwork;
     params.lwused  = 0;
-    params.lock    = &(fcblk->lock);
     params.B       = lrB + (blok - cblk->fblokptr);
     params.C       = &lrC;
+    params.Cacc    = NULL;
 
     lrC.rk = -1;
     lrC.v  = NULL;
@@ -1443,6 +1567,7 @@ core_zgemmsp_lrfr( pastix_coefside_t       sideA,
         params.M  = blok_rownbr( iterblok );
         params.A  = lrA;
         params.Cm = blok_rownbr( fblok );
+        params.lock = &(fblok->lock);
         params.offx = iterblok->frownum - fblok->frownum;
         params.offy = blok->frownum - fcblk->fcolnum;
 
@@ -1606,6 +1731,554 @@ cpucblk_zgemmsp( pastix_coefside_t   sideA,
     return flops;
 }
 
+/**
+ *******************************************************************************
+ *
+ * @ingroup kernel_fact_null
+ *
+ * @brief Scatter the lower and upper updates generated by one off-diagonal
+ * block in a single pass.
+ *
+ * Performs CL = CL - WL and CU = CU - WU, where the rows of WL are the rows of
+ * the blocks from blok to lblok excluded, and the rows of WU the rows of the
+ * blocks from blok+1 to lblok excluded. Each facing block is searched for, and
+ * locked, once for both parts.
+ *
+ *******************************************************************************
+ *
+ * @param[in] blok
+ *          The block that generates the updates.
+ *
+ * @param[in] lblok
+ *          The block following the last one of the cblk of blok.
+ *
+ * @param[inout] fcblk
+ *          The facing cblk that receives the updates.
+ *
+ * @param[in] scatmap
+ *          The facing blocks computed during the analysis for the blocks from
+ *          blok to lblok excluded, NULL if they have to be searched for.
+ *
+ * @param[in] M
+ *          The number of rows of WL. WU has M - blok_rownbr( blok ) rows.
+ *
+ * @param[in] N
+ *          The number of columns of WL, WU, CL and CU.
+ *
+ * @param[in] WL
+ *          The M-by-N matrix WL of leading dimension M.
+ *
+ * @param[in] WU
+ *          The (M - blok_rownbr( blok ))-by-N matrix WU of leading dimension
+ *          M - blok_rownbr( blok ).
+ *
+ * @param[inout] CL
+ *          The pointer to the first column of fcblk.lcoeftab receiving the
+ *          update.
+ *
+ * @param[inout] CU
+ *          The pointer to the first column of fcblk.ucoeftab receiving the
+ *          update.
+ *
+ * @param[in] ldc
+ *          The leading dimension of CL and CU.
+ *
+ *******************************************************************************/
+static pastix_target_clones void
+core_zgemmsp_lu_scatter( const SolverBlok                   *blok,
+                         const SolverBlok                   *lblok,
+                         SolverCblk                         *fcblk,
+                         const pastix_int_t                 *scatmap,
+                         pastix_int_t                        M,
+                         pastix_int_t                        N,
+                         const pastix_complex64_t * restrict WL,
+                         const pastix_complex64_t * restrict WU,
+                         pastix_complex64_t       * restrict CL,
+                         pastix_complex64_t       * restrict CU,
+                         pastix_int_t                        ldc )
+{
+    const SolverBlok         *iterblok;
+    SolverBlok               *cblok  = fcblk->fblokptr;
+    SolverBlok               *locked = NULL;
+    const pastix_complex64_t *Wb;
+    pastix_complex64_t       *Cb;
+    pastix_int_t i, j, m, offset;
+    pastix_int_t MU = M - blok_rownbr( blok );
+
+    for( iterblok = blok; iterblok < lblok; iterblok++ ) {
+
+        /* Find facing blok */
+        if ( scatmap != NULL ) {
+            cblok = fcblk->fblokptr + scatmap[ iterblok - blok ];
+        }
+        else {
+            while (!is_block_inside_fblock( iterblok, cblok ))
+            {
+                cblok++;
+                assert( cblok < fcblk[1].fblokptr );
+            }
+        }
+        assert( is_block_inside_fblock( iterblok, cblok ) );
+
+        if ( cblok != locked ) {
+            if ( locked != NULL ) {
+                pastix_blok_unlock( locked );
+            }
+            pastix_blok_lock( cblok );
+            locked = cblok;
+        }
+
+        m      = blok_rownbr( iterblok );
+        offset = cblok->coefind + iterblok->frownum - cblok->frownum;
+
+        /* Lower part */
+        Wb = WL;
+        Cb = CL + offset;
+        for( j=0; j<N; j++, Wb+=M, Cb+=ldc ) {
+            for( i=0; i<m; i++ ) {
+                Cb[i] -= Wb[i];
+            }
+        }
+        WL += m;
+
+        /* The block facing the diagonal block only receives the lower part */
+        if ( iterblok == blok ) {
+            continue;
+        }
+
+        /* Upper part */
+        Wb = WU;
+        Cb = CU + offset;
+        for( j=0; j<N; j++, Wb+=MU, Cb+=ldc ) {
+            for( i=0; i<m; i++ ) {
+                Cb[i] -= Wb[i];
+            }
+        }
+        WU += m;
+    }
+
+    if ( locked != NULL ) {
+        pastix_blok_unlock( locked );
+    }
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Compute the lower and upper updates of the LU factorization that are
+ * generated by one off-diagonal block.
+ *
+ * This is equivalent to calling cpucblk_zgemmsp() on the lower part, and then
+ * on the upper part if blok is not the last block of the cblk. When both cblk
+ * and fcblk are stored in 1D and in full rank, the two products are computed
+ * one after another in the work buffer, and are then added to both parts of
+ * fcblk in a single pass over its blocks (see core_zgemmsp_lu_scatter()). As
+ * the upper part of each cblk is stored right after its lower part, this
+ * streams through one contiguous allocation instead of two.
+ *
+ * The fused version requires a work buffer of at least (2 * M - N) * N
+ * elements, where M is the number of rows from blok to the end of the cblk,
+ * and N the number of rows of blok. Otherwise, or for the other layouts, the
+ * two updates are computed independently with cpucblk_zgemmsp().
+ *
+ *******************************************************************************
+ *
+ * @param[in] cblk
+ *          The cblk structure to which block belongs to. The L and U pointers
+ *          must be the coeftab of this column block.
+ *          Next column blok must be accessible through cblk[1].
+ *
+ * @param[in] blok
+ *          The block from which we compute the contributions.
+ *
+ * @param[inout] fcblk
+ *          The pointer to the data structure that describes the panel on which
+ *          we compute the contributions. Next column blok must be accessible
+ *          through fcblk[1].
+ *
+ * @param[in] L
+ *          The pointer to the correct representation of the lower part of
+ *          cblk.
+ *
+ * @param[in] U
+ *          The pointer to the correct representation of the upper part of
+ *          cblk.
+ *
+ * @param[in] work
+ *          Temporary memory buffer.
+ *
+ * @param[in] lwork
+ *          The size of the work buffer.
+ *
+ * @param[in] lowrank
+ *          The structure with low-rank parameters.
+ *
+ *******************************************************************************
+ *
+ * @return The number of flops of both updates.
+ *
+ *******************************************************************************/
+pastix_fixdbl_t
+cpucblk_zgemmsp_lu( const SolverCblk   *cblk,
+                    const SolverBlok   *blok,
+                    SolverCblk         *fcblk,
+                    const void         *L,
+                    const void         *U,
+                    pastix_complex64_t *work,
+                    pastix_int_t        lwork,
+                    const pastix_lr_t  *lowrank )
+{
+    const SolverBlok         *lblok = cblk[1].fblokptr;
+    const pastix_complex64_t *lA, *uA;
+    pastix_complex64_t       *WL, *WU, *CL, *CU;
+    pastix_fixdbl_t time, flops;
+    pastix_int_t    stride, stridef, M, MU, N, K;
+
+    stride = cblk->stride;
+    N      = blok_rownbr( blok );
+    M      = stride - blok->coefind;
+    MU     = M - N;
+
+    if ( ((cblk->cblktype | fcblk->cblktype) & (CBLK_LAYOUT_2D | CBLK_COMPRESSED)) ||
+         (lwork < (M + MU) * N) )
+    {
+        flops = cpucblk_zgemmsp( PastixLCoef, PastixTrans,
+                                 cblk, blok, fcblk,
+                                 L, U, cblk_getdataL( fcblk ),
+                                 work, lwork, lowrank );
+        if ( blok+1 < lblok ) {
+            flops += cpucblk_zgemmsp( PastixUCoef, PastixTrans,
+                                      cblk, blok, fcblk,
+                                      U, L, cblk_getdataU( fcblk ),
+                                      work, lwork, lowrank );
+        }
+        return flops;
+    }
+
+    time    = kernel_trace_start( PastixKernelGEMMCblk1d1d );
+    stridef = fcblk->stride;
+    K       = cblk_colnbr( cblk );
+    lA      = (const pastix_complex64_t *)L + blok->coefind;
+    uA      = (const pastix_complex64_t *)U + blok->coefind;
+
+    /*
+     * Compute both updates L * U' and U * L' in the work buffer
+     */
+    WL = work;
+    WU = work + M * N;
+    kernel_trace_start_lvl2( PastixKernelLvl2_FR_GEMM );
+    cblas_zgemm( CblasColMajor, CblasNoTrans, CblasTrans,
+                 M, N, K,
+                 CBLAS_SADDR(zone),  lA, stride,
+                                     uA, stride,
+                 CBLAS_SADDR(zzero), WL, M );
+    if ( MU > 0 ) {
+        cblas_zgemm( CblasColMajor, CblasNoTrans, CblasTrans,
+                     MU, N, K,
+                     CBLAS_SADDR(zone),  uA + N, stride,
+                                         lA,     stride,
+                     CBLAS_SADDR(zzero), WU,     MU );
+    }
+    flops = FLOPS_ZGEMM( M, N, K ) + FLOPS_ZGEMM( MU, N, K );
+    kernel_trace_stop_lvl2( flops );
+
+    /*
+     * Add both contributions to fcblk, moving the pointers to the top of the
+     * right column
+     */
+    CL = (pastix_complex64_t *)(fcblk->lcoeftab) + (blok->frownum - fcblk->fcolnum) * stridef;
+    CU = (pastix_complex64_t *)(fcblk->ucoeftab) + (blok->frownum - fcblk->fcolnum) * stridef;
+
+    core_zgemmsp_lu_scatter( blok, lblok, fcblk, blok->scatmap,
+                             M, N, WL, WU, CL, CU, stridef );
+
+    kernel_trace_stop( blok->inlast, PastixKernelGEMMCblk1d1d, M, N, K, flops, time );
+
+    return flops;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @ingroup kernel_fact_null
+ *
+ * @brief Compute C = C - A * op(B) for a small number of columns K.
+ *
+ * The kernel is always inlined with a constant K such that the compiler can
+ * fully unroll the loop over K and vectorize the update of each column of C.
+ *
+ *******************************************************************************
+ *
+ * @param[in] conjB
+ *          If true, op(B) = B^h, otherwise op(B) = B^t.
+ *
+ * @param[in] M
+ *          The number of rows of A and C.
+ *
+ * @param[in] N
+ *          The number of rows of B, and the number of columns of C.
+ *
+ * @param[in] K
+ *          The number of columns of A and B. K <= PASTIX_GEMMSP_BATCH_WIDTH.
+ *
+ * @param[in] A
+ *          The M-by-K matrix A.
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrix A.
+ *
+ * @param[in] B
+ *          The N-by-K matrix B.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the matrix B.
+ *
+ * @param[inout] C
+ *          The M-by-N matrix C.
+ *
+ * @param[in] ldc
+ *          The leading dimension of the matrix C.
+ *
+ *******************************************************************************/
+static inline void
+core_zgemmsp_small( int                       conjB,
+                    pastix_int_t              M,
+                    pastix_int_t              N,
+                    const pastix_int_t        K,
+                    const pastix_complex64_t *A,
+                    pastix_int_t              lda,
+                    const pastix_complex64_t *B,
+                    pastix_int_t              ldb,
+                    pastix_complex64_t       *C,
+                    pastix_int_t              ldc )
+{
+    pastix_complex64_t        b[PASTIX_GEMMSP_BATCH_WIDTH];
+    const pastix_complex64_t *Ak;
+    pastix_int_t i, j, k;
+
+    for( j=0; j<N; j++, C+=ldc ) {
+        for( k=0; k<K; k++ ) {
+#if defined(PRECISION_z) || defined(PRECISION_c)
+            b[k] = conjB ? conj( B[j + k * ldb] ) : B[j + k * ldb];
+#else
+            b[k] = B[j + k * ldb];
+#endif
+        }
+        for( k=0, Ak=A; k<K; k++, Ak+=lda ) {
+            for( i=0; i<M; i++ ) {
+                C[i] -= Ak[i] * b[k];
+            }
+        }
+    }
+#if !defined(PRECISION_z) && !defined(PRECISION_c)
+    (void)conjB;
+#endif
+}
+
+/**
+ * @brief Dispatch the small kernel on a compile-time constant K.
+ */
+#define core_zgemmsp_small_case( _k_ )                                  \
+    case _k_:                                                           \
+        core_zgemmsp_small( conjB, M, N, _k_, A, lda, B, ldb, C, ldc ); \
+        break
+
+/**
+ *******************************************************************************
+ *
+ * @ingroup kernel_fact_null
+ *
+ * @brief Select the unrolled version of core_zgemmsp_small() matching K.
+ *
+ * See core_zgemmsp_small() for the description of the parameters.
+ *
+ *******************************************************************************/
+static inline void
+core_zgemmsp_small_dispatch( int                       conjB,
+                             pastix_int_t              M,
+                             pastix_int_t              N,
+                             pastix_int_t              K,
+                             const pastix_complex64_t *A,
+                             pastix_int_t              lda,
+                             const pastix_complex64_t *B,
+                             pastix_int_t              ldb,
+                             pastix_complex64_t       *C,
+                             pastix_int_t              ldc )
+{
+    switch( K ) {
+        core_zgemmsp_small_case( 1 );
+        core_zgemmsp_small_case( 2 );
+        core_zgemmsp_small_case( 3 );
+        core_zgemmsp_small_case( 4 );
+        core_zgemmsp_small_case( 5 );
+        core_zgemmsp_small_case( 6 );
+        core_zgemmsp_small_case( 7 );
+        core_zgemmsp_small_case( 8 );
+    default:
+        assert( 0 );
+    }
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Compute all the updates emitted by a small column block.
+ *
+ * When the panel is in full rank and has at most PASTIX_GEMMSP_BATCH_WIDTH
+ * columns, the updates of all its off-diagonal blocks are computed in a single
+ * pass: each block to block product is applied directly to the facing block
+ * with an unrolled kernel, without going through BLAS nor through the work
+ * buffer. The lock of a facing block is taken once for all the consecutive
+ * blocks it receives, and the flops are accounted once per panel.
+ *
+ * Wider or compressed panels, and panels contributing to a compressed cblk are
+ * not handled: the caller has to fall back on cpucblk_zgemmsp() on each
+ * off-diagonal block.
+ *
+ * The FANIN targets are allocated by the function, but the dependencies are
+ * not released.
+ *
+ *******************************************************************************
+ *
+ * @param[in] sideA
+ *          Specify if A and C belong to the lower part, or to the upper part.
+ *          See cpucblk_zgemmsp().
+ *
+ * @param[in] trans
+ *          Specify the transposition used for the B matrix. It has to be either
+ *          PastixTrans or PastixConjTrans.
+ *
+ * @param[in] solvmtx
+ *          The solver matrix structure.
+ *
+ * @param[in] cblk
+ *          The column block that emits the updates. The A and B pointers must
+ *          be the coeftab of this column block.
+ *
+ * @param[in] A
+ *          The pointer to the coeftab of the cblk.lcoeftab matrix storing the
+ *          coefficients of the panel when the Lower part is computed,
+ *          cblk.ucoeftab otherwise.
+ *
+ * @param[in] B
+ *          The pointer to the coeftab of the cblk storing the coefficients of
+ *          the B matrix.
+ *
+ *******************************************************************************
+ *
+ * @retval PASTIX_SUCCESS if all the updates have been computed.
+ * @retval PASTIX_ERR_NOTIMPLEMENTED if the cblk is not eligible and nothing
+ *         has been done.
+ *
+ *******************************************************************************/
+int
+cpucblk_zgemmsp_batch( pastix_coefside_t         sideA,
+                       pastix_trans_t            trans,
+                       SolverMatrix             *solvmtx,
+                       const SolverCblk         *cblk,
+                       const pastix_complex64_t *A,
+                       const pastix_complex64_t *B )
+{
+    const SolverBlok   *blok, *iterblok, *lblok;
+    SolverBlok         *fblok, *locked;
+    SolverCblk         *fcblk;
+    pastix_complex64_t *C;
+    pastix_fixdbl_t     time, flops[3] = { 0., 0., 0. };
+    pastix_int_t        K, M, N, lda, ldb, ldc;
+    int8_t i;
+    int shift  = (sideA == PastixUCoef) ? 1 : 0;
+    int conjB  = (trans == PastixConjTrans);
+    int layout = cblk->cblktype & CBLK_LAYOUT_2D;
+
+#if defined(PASTIX_GENERATE_MODEL)
+    /* Keep one entry per update in the model */
+    return PASTIX_ERR_NOTIMPLEMENTED;
+#endif
+
+    K = cblk_colnbr( cblk );
+    if ( (cblk->cblktype & CBLK_COMPRESSED) ||
+         (K > PASTIX_GEMMSP_BATCH_WIDTH) )
+    {
+        return PASTIX_ERR_NOTIMPLEMENTED;
+    }
+
+    /* The low-rank targets go through the regular kernels */
+    lblok = cblk[1].fblokptr;
+    for( blok = cblk->fblokptr + 1; blok < lblok; blok++ ) {
+        fcblk = solvmtx->cblktab + blok->fcblknm;
+        if ( fcblk->cblktype & CBLK_COMPRESSED ) {
+            return PASTIX_ERR_NOTIMPLEMENTED;
+        }
+    }
+
+    time = kernel_trace_start( PastixKernelGEMMCblk1d1d );
+
+    for( blok = cblk->fblokptr + 1; blok < lblok; blok++ )
+    {
+        fcblk = solvmtx->cblktab + blok->fcblknm;
+
+        if ( fcblk->cblktype & CBLK_FANIN ) {
+            cpucblk_zalloc( sideA, fcblk );
+        }
+
+        C = (sideA == PastixUCoef) ? fcblk->ucoeftab : fcblk->lcoeftab;
+
+        N   = blok_rownbr( blok );
+        ldb = layout ? N : cblk->stride;
+        fblok  = fcblk->fblokptr;
+        locked = NULL;
+
+        for( iterblok=blok+shift; iterblok<lblok; iterblok++ ) {
+
+            /* Find facing blok */
+            while (!is_block_inside_fblock( iterblok, fblok ))
+            {
+                fblok++;
+                assert( fblok < fcblk[1].fblokptr );
+            }
+
+            if ( fblok != locked ) {
+                if ( locked != NULL ) {
+                    pastix_blok_unlock( locked );
+                }
+                pastix_blok_lock( fblok );
+                locked = fblok;
+            }
+
+            M   = blok_rownbr( iterblok );
+            lda = layout ? M : cblk->stride;
+            ldc = (fcblk->cblktype & CBLK_LAYOUT_2D) ? blok_rownbr( fblok ) : fcblk->stride;
+
+            core_zgemmsp_small_dispatch(
+                conjB, M, N, K,
+                A + iterblok->coefind, lda,
+                B + blok->coefind,     ldb,
+                C + fblok->coefind + iterblok->frownum - fblok->frownum
+                  + (blok->frownum - fcblk->fcolnum) * ldc, ldc );
+
+            flops[ (int)(blok->inlast) ] += FLOPS_ZGEMM( M, N, K );
+        }
+
+        if ( locked != NULL ) {
+            pastix_blok_unlock( locked );
+        }
+    }
+
+    /* Account the flops once per category of blocks */
+    for( i=0; i<3; i++ ) {
+        if ( i > 0 ) {
+            if ( flops[i] == 0. ) {
+                continue;
+            }
+            time = kernel_trace_start( PastixKernelGEMMCblk1d1d );
+        }
+        kernel_trace_stop( i, PastixKernelGEMMCblk1d1d,
+                           cblk->stride, cblk->stride, K, flops[i], time );
+    }
+
+    return PASTIX_SUCCESS;
+}
+
 /**
  *******************************************************************************
  *
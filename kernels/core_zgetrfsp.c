@@ -70,7 +70,7 @@ core_zgetf2sp( pastix_int_t        m,
                double              criterion )
 {
     pastix_int_t k, minMN;
-    pastix_complex64_t *Akk, *Aik, alpha;
+    pastix_complex64_t *Akk, *Aik;
 
     minMN = pastix_imin( m, n );
 
@@ -78,19 +78,8 @@ core_zgetf2sp( pastix_int_t        m,
     for (k=0; k<minMN; k++) {
         Aik = Akk + 1;
 
-        if ( cabs(*Akk) < criterion ) {
-            if ( creal(*Akk) < 0. ) {
-                *Akk = (pastix_complex64_t)(-criterion);
-            }
-            else {
-                *Akk = (pastix_complex64_t)criterion;
-            }
-            (*nbpivots)++;
-        }
-
         /* A_ik = A_ik / A_kk, i = k+1 .. n */
-        alpha = 1.0 / (*Akk);
-        cblas_zscal(m-k-1, CBLAS_SADDR( alpha ), Aik, 1 );
+        (*nbpivots) += core_zscalpiv( m-k-1, Akk, Aik, criterion, 0 );
 
         if ( k+1 < minMN ) {
 
@@ -112,6 +101,11 @@ core_zgetf2sp( pastix_int_t        m,
  * @brief Compute the block static pivoting LU factorization of the matrix
  * m-by-n A = L * U.
  *
+ * The matrix is recursively split in two halves, such that most of the
+ * computations are performed by level-3 kernels whatever the size of the
+ * diagonal block. Blocks of at most MAXSIZEOFBLOCKS columns are factorized by
+ * the level-2 kernel, which applies the static pivoting.
+ *
  *******************************************************************************
  *
  * @param[in] n
@@ -141,45 +135,323 @@ core_zgetrfsp( pastix_int_t        n,
                pastix_int_t       *nbpivots,
                double              criterion )
 {
-    pastix_int_t k, blocknbr, blocksize, matrixsize, tempm;
-    pastix_complex64_t *Akk, *Lik, *Ukj, *Aij;
-
-    blocknbr = pastix_iceil( n, MAXSIZEOFBLOCKS );
-
-    Akk = A; /* Lk,k     */
-
-    for (k=0; k<blocknbr; k++) {
-
-        tempm = n - k * MAXSIZEOFBLOCKS;
-        blocksize = pastix_imin(MAXSIZEOFBLOCKS, tempm);
-        Lik = Akk + blocksize;
-        Ukj = Akk + blocksize*lda;
-        Aij = Ukj + blocksize;
-
-        /* Factorize the diagonal block Akk*/
-        core_zgetf2sp( tempm, blocksize, Akk, lda, nbpivots, criterion );
-
-        matrixsize = tempm - blocksize;
-        if ( matrixsize > 0 ) {
-
-            /* Compute the column Ukk+1 */
-            cblas_ztrsm(CblasColMajor,
-                        CblasLeft, CblasLower,
-                        CblasNoTrans, CblasUnit,
-                        blocksize, matrixsize,
-                        CBLAS_SADDR(zone), Akk, lda,
-                                           Ukj, lda);
-
-            /* Update Ak+1,k+1 = Ak+1,k+1 - Lk+1,k*Uk,k+1 */
-            cblas_zgemm(CblasColMajor,
-                        CblasNoTrans, CblasNoTrans,
-                        matrixsize, matrixsize, blocksize,
-                        CBLAS_SADDR(mzone), Lik, lda,
-                                            Ukj, lda,
-                        CBLAS_SADDR(zone),  Aij, lda);
+    pastix_int_t n1, n2;
+    pastix_complex64_t *A12, *A21, *A22;
+
+    /* Factorize the small diagonal blocks with the level-2 kernel */
+    if ( n <= MAXSIZEOFBLOCKS ) {
+        core_zgetf2sp( n, n, A, lda, nbpivots, criterion );
+        return;
+    }
+
+    /* Split the block such that the first part is a multiple of the block size */
+    n1 = MAXSIZEOFBLOCKS * pastix_iceil( n / 2, MAXSIZEOFBLOCKS );
+    n2 = n - n1;
+    A21 = A   + n1;
+    A12 = A   + n1 * lda;
+    A22 = A12 + n1;
+
+    /* Factorize A11 = L11 * U11 */
+    core_zgetrfsp( n1, A, lda, nbpivots, criterion );
+
+    /* Compute U12 = L11^{-1} A12 */
+    cblas_ztrsm(CblasColMajor,
+                CblasLeft, CblasLower,
+                CblasNoTrans, CblasUnit,
+                n1, n2,
+                CBLAS_SADDR(zone), A,   lda,
+                                   A12, lda);
+
+    /* Compute L21 = A21 U11^{-1} */
+    cblas_ztrsm(CblasColMajor,
+                CblasRight, CblasUpper,
+                CblasNoTrans, CblasNonUnit,
+                n2, n1,
+                CBLAS_SADDR(zone), A,   lda,
+                                   A21, lda);
+
+    /* Update A22 = A22 - L21 * U12 */
+    cblas_zgemm(CblasColMajor,
+                CblasNoTrans, CblasNoTrans,
+                n2, n2, n1,
+                CBLAS_SADDR(mzone), A21, lda,
+                                    A12, lda,
+                CBLAS_SADDR(zone),  A22, lda);
+
+    /* Factorize A22 = L22 * U22 */
+    core_zgetrfsp( n2, A22, lda, nbpivots, criterion );
+}
+
+/**
+ *******************************************************************************
+ *
+ * @ingroup kernel_blas_lapack_null
+ *
+ * @brief Compute the sequential threshold partial pivoting LU factorization of
+ * the m-by-n panel P * A = L * U.
+ *
+ * At each step, the row of the panel with the largest element in the current
+ * column is swapped with the diagonal one if the diagonal element is smaller
+ * than threshold times this largest element. The static pivoting is then
+ * applied if the selected pivot is still below the criterion.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the panel A.
+ *
+ * @param[in] n
+ *          The number of columns of the panel A.
+ *
+ * @param[inout] A
+ *          The panel A to factorize with LU factorization. The matrix
+ *          is of size lda -by- n.
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrix A.
+ *
+ * @param[out] ipiv
+ *          Array of size min(m, n). The row i of the panel has been
+ *          interchanged with the row ipiv[i], 0-based.
+ *
+ * @param[inout] nbpivots
+ *          Pointer to the number of piovting operations made during
+ *          factorization. It is updated during this call
+ *
+ * @param[in] threshold
+ *          Threshold of the partial pivoting, in ]0, 1].
+ *
+ * @param[in] criterion
+ *          Threshold use for static pivoting. If diagonal value is under this
+ *          threshold, its value is replaced by the threshold and the number of
+ *          pivots is incremented.
+ *
+ *******************************************************************************/
+static inline void
+core_zgetf2sp_piv( pastix_int_t        m,
+                   pastix_int_t        n,
+                   pastix_complex64_t *A,
+                   pastix_int_t        lda,
+                   pastix_int_t       *ipiv,
+                   pastix_int_t       *nbpivots,
+                   double              threshold,
+                   double              criterion )
+{
+    pastix_int_t k, p, minMN;
+    pastix_complex64_t *Akk, *Aik;
+
+    minMN = pastix_imin( m, n );
+
+    Akk = A;
+    for (k=0; k<minMN; k++) {
+        Aik = Akk + 1;
+
+        /* Search the largest element of the column */
+        p = k + cblas_izamax( m-k, Akk, 1 );
+        ipiv[k] = k;
+        if ( (p != k) && (cabs(*Akk) < threshold * cabs(A[k * lda + p])) ) {
+            ipiv[k] = p;
+            cblas_zswap( n, A + k, lda, A + p, lda );
+        }
+
+        /* A_ik = A_ik / A_kk, i = k+1 .. n */
+        (*nbpivots) += core_zscalpiv( m-k-1, Akk, Aik, criterion, 0 );
+
+        if ( k+1 < minMN ) {
+
+            /* A_ij = A_ij - A_ik * A_kj, i,j = k+1..n */
+            cblas_zgeru(CblasColMajor, m-k-1, n-k-1,
+                        CBLAS_SADDR(mzone),
+                        Aik,        1,
+                        Akk+lda, lda,
+                        Aik+lda, lda);
+        }
+
+        Akk += lda+1;
+    }
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Compute the block threshold partial pivoting LU factorization of the
+ * matrix n-by-n P * A = L * U.
+ *
+ * The pivots are searched in all the rows of the matrix, such that the panels
+ * of MAXSIZEOFBLOCKS columns are factorized by the level-2 kernel on the full
+ * height of the remaining matrix. The row interchanges are then applied to the
+ * other columns before the level-3 updates.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The number of rows and columns of the matrix A.
+ *
+ * @param[inout] A
+ *          The matrix A to factorize with LU factorization. The matrix
+ *          is of size lda -by- n.
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrix A.
+ *
+ * @param[out] ipiv
+ *          Array of size n. The row i of the matrix has been interchanged with
+ *          the row ipiv[i], 0-based, in the increasing order of i.
+ *
+ * @param[inout] nbpivots
+ *          Pointer to the number of piovting operations made during
+ *          factorization. It is updated during this call
+ *
+ * @param[in] threshold
+ *          Threshold of the partial pivoting, in ]0, 1].
+ *
+ * @param[in] criterion
+ *          Threshold use for static pivoting. If diagonal value is under this
+ *          threshold, its value is replaced by the threshold and the number of
+ *          pivots is incremented.
+ *
+ *******************************************************************************/
+void
+core_zgetrfsp_piv( pastix_int_t        n,
+                   pastix_complex64_t *A,
+                   pastix_int_t        lda,
+                   pastix_int_t       *ipiv,
+                   pastix_int_t       *nbpivots,
+                   double              threshold,
+                   double              criterion )
+{
+    pastix_int_t k, i, nb, nr;
+    pastix_complex64_t *Akk, *A21, *A12, *A22;
+
+    for (k=0; k<n; k+=MAXSIZEOFBLOCKS) {
+        nb  = pastix_imin( MAXSIZEOFBLOCKS, n-k );
+        nr  = n - k - nb;
+        Akk = A + k * lda + k;
+        A21 = Akk + nb;
+        A12 = Akk + nb * lda;
+        A22 = A12 + nb;
+
+        /* Factorize the panel on the full height of the remaining rows */
+        core_zgetf2sp_piv( n-k, nb, Akk, lda, ipiv + k,
+                           nbpivots, threshold, criterion );
+
+        /* Apply the interchanges to the columns on both sides of the panel */
+        for (i=k; i<k+nb; i++) {
+            ipiv[i] += k;
+            if ( ipiv[i] != i ) {
+                cblas_zswap( k,  A   + i,       lda, A   + ipiv[i],       lda );
+                cblas_zswap( nr, A12 + (i - k), lda, A12 + (ipiv[i] - k), lda );
+            }
+        }
+
+        if ( nr == 0 ) {
+            continue;
         }
 
-        Akk += blocksize * (lda+1);
+        /* Compute U12 = L11^{-1} A12 */
+        cblas_ztrsm(CblasColMajor,
+                    CblasLeft, CblasLower,
+                    CblasNoTrans, CblasUnit,
+                    nb, nr,
+                    CBLAS_SADDR(zone), Akk, lda,
+                                       A12, lda);
+
+        /* Update A22 = A22 - L21 * U12 */
+        cblas_zgemm(CblasColMajor,
+                    CblasNoTrans, CblasNoTrans,
+                    nr, nr, nb,
+                    CBLAS_SADDR(mzone), A21, lda,
+                                        A12, lda,
+                    CBLAS_SADDR(zone),  A22, lda);
+    }
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Apply the row interchanges of the diagonal block of a panel to the
+ * off-diagonal blocks of its upper part.
+ *
+ * As U^t is stored, the rows of the diagonal block are the columns of the
+ * ucoeftab array, such that the columns of the off-diagonal blocks are
+ * interchanged.
+ *
+ *******************************************************************************
+ *
+ * @param[in] cblk
+ *          Pointer to the structure representing the panel.
+ *
+ * @param[inout] dataU
+ *          The pointer to the correct representation of the upper part of the data.
+ *          - coeftab if the block is in full rank. Must be of size cblk.stride -by- cblk.width
+ *          - pastix_lr_block if the block is compressed.
+ *
+ * @param[in] ipiv
+ *          The row interchanges of the diagonal block, 0-based.
+ *
+ *******************************************************************************/
+static inline void
+cpucblk_zlaswpsp_upper( const SolverCblk   *cblk,
+                        void               *dataU,
+                        const pastix_int_t *ipiv )
+{
+    const SolverBlok   *blok = cblk->fblokptr + 1;
+    const SolverBlok   *lblk = cblk[1].fblokptr;
+    pastix_complex64_t *U;
+    pastix_lrblock_t   *lrU;
+    pastix_int_t        ncols = cblk_colnbr( cblk );
+    pastix_int_t        i, M, ld;
+
+    if ( blok == lblk ) {
+        return;
+    }
+
+    if ( cblk->cblktype & CBLK_COMPRESSED ) {
+        lrU = (pastix_lrblock_t *)dataU;
+        for (; blok < lblk; blok++) {
+            pastix_lrblock_t *lrblok = lrU + (blok - cblk->fblokptr);
+            M = blok_rownbr( blok );
+
+            for (i=0; i<ncols; i++) {
+                if ( ipiv[i] == i ) {
+                    continue;
+                }
+                if ( lrblok->rk == -1 ) {
+                    U = lrblok->u;
+                    cblas_zswap( M, U + i * M, 1, U + ipiv[i] * M, 1 );
+                }
+                else if ( lrblok->rk > 0 ) {
+                    U = lrblok->v;
+                    cblas_zswap( lrblok->rk, U + i * lrblok->rkmax, 1,
+                                             U + ipiv[i] * lrblok->rkmax, 1 );
+                }
+            }
+        }
+        return;
+    }
+
+    if ( cblk->cblktype & CBLK_LAYOUT_2D ) {
+        for (; blok < lblk; blok++) {
+            U  = (pastix_complex64_t *)dataU + blok->coefind;
+            ld = blok_rownbr( blok );
+
+            for (i=0; i<ncols; i++) {
+                if ( ipiv[i] != i ) {
+                    cblas_zswap( ld, U + i * ld, 1, U + ipiv[i] * ld, 1 );
+                }
+            }
+        }
+        return;
+    }
+
+    /* All the off-diagonal blocks are contiguous in the 1D layout */
+    U  = (pastix_complex64_t *)dataU + blok->coefind;
+    ld = cblk->stride;
+    M  = ld - ncols;
+    for (i=0; i<ncols; i++) {
+        if ( ipiv[i] != i ) {
+            cblas_zswap( M, U + i * ld, 1, U + ipiv[i] * ld, 1 );
+        }
     }
 }
 
@@ -257,7 +529,18 @@ cpucblk_zgetrfsp1d_getrf( SolverMatrix *solvmtx,
     /* Factorize diagonal block */
     flops = FLOPS_ZGETRF( ncols, ncols );
     kernel_trace_start_lvl2( PastixKernelLvl2GETRF );
-    core_zgetrfsp(ncols, L, stride, &nbpivots, criterion);
+    if ( solvmtx->pivtab != NULL ) {
+        pastix_int_t *ipiv = solvmtx->pivtab + cblk->lcolidx;
+
+        core_zgetrfsp_piv( ncols, L, stride, ipiv, &nbpivots,
+                           solvmtx->pivthreshold, criterion );
+
+        /* The interchanged rows of A continue in the upper part of the panel */
+        cpucblk_zlaswpsp_upper( cblk, dataU, ipiv );
+    }
+    else {
+        core_zgetrfsp(ncols, L, stride, &nbpivots, criterion);
+    }
     kernel_trace_stop_lvl2( flops );
 
     /* Transpose Akk in ucoeftab */
@@ -265,6 +548,9 @@ cpucblk_zgetrfsp1d_getrf( SolverMatrix *solvmtx,
 
     kernel_trace_stop( cblk->fblokptr->inlast, PastixKernelGETRF, ncols, 0, 0, flops, time );
 
+    if ( solvmtx->cblkpivots != NULL ) {
+        solvmtx->cblkpivots[ cblk - solvmtx->cblktab ] = nbpivots;
+    }
     if ( nbpivots ) {
         pastix_atomic_add_32b( &(solvmtx->nbpivots), nbpivots );
     }
@@ -315,12 +601,153 @@ cpucblk_zgetrfsp1d_panel( SolverMatrix *solvmtx,
      * column, and by transposition the L part of the diagonal block is
      * similarly stored in the U panel
      */
-    cpucblk_ztrsmsp( PastixRight, PastixUpper,
-                     PastixNoTrans, PastixNonUnit,
-                     cblk, L, L, &(solvmtx->lowrank) );
-    cpucblk_ztrsmsp( PastixRight, PastixUpper,
-                     PastixNoTrans, PastixUnit,
-                     cblk, U, U, &(solvmtx->lowrank) );
+    cpucblk_ztrsmsp_team( solvmtx, PastixRight, PastixUpper,
+                          PastixNoTrans, PastixNonUnit,
+                          cblk, L, L );
+    cpucblk_ztrsmsp_team( solvmtx, PastixRight, PastixUpper,
+                          PastixNoTrans, PastixUnit,
+                          cblk, U, U );
+    return nbpivots;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Solve a chunk of rows of the off-diagonal blocks of a large panel.
+ *
+ * Team item of cpucblk_zgetrfsp1d_team(). The chunks are as high as the panel
+ * is wide.
+ *
+ *******************************************************************************/
+static void
+core_zgetrfsp1d_team_trsm( SolverMatrix *solvmtx,
+                           void         *args,
+                           pastix_int_t  item,
+                           void         *work,
+                           pastix_int_t  lwork )
+{
+    SolverCblk  *cblk   = (SolverCblk *)args;
+    pastix_int_t n      = cblk_colnbr( cblk );
+    pastix_int_t fstrow = item * n;
+    pastix_int_t nbrows = pastix_imin( n, cblk->stride - n - fstrow );
+
+    cpucblk_ztrsmsp_rows( PastixRight, PastixUpper,
+                          PastixNoTrans, PastixNonUnit,
+                          cblk, cblk->lcoeftab, cblk->lcoeftab,
+                          fstrow, nbrows );
+    cpucblk_ztrsmsp_rows( PastixRight, PastixUpper,
+                          PastixNoTrans, PastixUnit,
+                          cblk, cblk->ucoeftab, cblk->ucoeftab,
+                          fstrow, nbrows );
+
+    (void)solvmtx;
+    (void)work;
+    (void)lwork;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Apply the updates of one off-diagonal block of a large panel.
+ *
+ * Team item of cpucblk_zgetrfsp1d_team().
+ *
+ *******************************************************************************/
+static void
+core_zgetrfsp1d_team_gemm( SolverMatrix *solvmtx,
+                           void         *args,
+                           pastix_int_t  item,
+                           void         *work,
+                           pastix_int_t  lwork )
+{
+    SolverCblk *cblk  = (SolverCblk *)args;
+    SolverBlok *blok  = cblk->fblokptr + 1 + item;
+    SolverCblk *fcblk = solvmtx->cblktab + blok->fcblknm;
+
+    if ( fcblk->cblktype & CBLK_FANIN ) {
+        cpucblk_zalloc( PastixLUCoef, fcblk );
+    }
+
+    /* Update on L and U in a single pass */
+    if ( solvmtx->lufused ) {
+        cpucblk_zgemmsp_lu( cblk, blok, fcblk,
+                            cblk->lcoeftab, cblk->ucoeftab,
+                            work, lwork, &(solvmtx->lowrank) );
+    }
+    else {
+        /* Update on L */
+        cpucblk_zgemmsp( PastixLCoef, PastixTrans,
+                         cblk, blok, fcblk,
+                         cblk->lcoeftab, cblk->ucoeftab, cblk_getdataL( fcblk ),
+                         work, lwork, &(solvmtx->lowrank) );
+
+        /* Update on U */
+        if ( blok+1 < cblk[1].fblokptr ) {
+            cpucblk_zgemmsp( PastixUCoef, PastixTrans,
+                             cblk, blok, fcblk,
+                             cblk->ucoeftab, cblk->lcoeftab, cblk_getdataU( fcblk ),
+                             work, lwork, &(solvmtx->lowrank) );
+        }
+    }
+    cpucblk_zrelease_deps( PastixLUCoef, solvmtx, cblk, fcblk );
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Perform the LU factorization of a large panel and apply all its
+ * updates with the help of the idle threads.
+ *
+ * The diagonal block is factorized by the calling thread. The TRSM of the
+ * off-diagonal blocks, and then their updates, are split in items processed by
+ * the calling thread and by the threads of the static scheduler that wait for
+ * their dependencies (see solverTeamRun()). The panel must be stored in 1D and
+ * in full rank.
+ *
+ *******************************************************************************
+ *
+ * @param[in] solvmtx
+ *          Solver Matrix structure of the problem
+ *
+ * @param[in] cblk
+ *          Pointer to the structure representing the panel to factorize in the
+ *          cblktab array.  Next column blok must be accessible through cblk[1].
+ *
+ * @param[in] work
+ *          Temporary memory buffer.
+ *
+ * @param[in] lwork
+ *          Temporary workspace dimension.
+ *
+ *******************************************************************************
+ *
+ * @return The number of static pivoting during factorization of the diagonal
+ * block.
+ *
+ *******************************************************************************/
+static inline int
+cpucblk_zgetrfsp1d_team( SolverMatrix       *solvmtx,
+                         SolverCblk         *cblk,
+                         pastix_complex64_t *work,
+                         pastix_int_t        lwork )
+{
+    pastix_int_t n      = cblk_colnbr( cblk );
+    pastix_int_t nbblok = cblk[1].fblokptr - cblk->fblokptr - 1;
+    pastix_int_t nbpivots;
+
+    assert( !(cblk->cblktype & (CBLK_LAYOUT_2D | CBLK_COMPRESSED)) );
+
+    nbpivots = cpucblk_zgetrfsp1d_getrf( solvmtx, cblk,
+                                         cblk->lcoeftab, cblk->ucoeftab );
+    if ( nbblok == 0 ) {
+        return nbpivots;
+    }
+
+    solverTeamRun( solvmtx, core_zgetrfsp1d_team_trsm, cblk,
+                   pastix_iceil( cblk->stride - n, n ), work, lwork );
+    solverTeamRun( solvmtx, core_zgetrfsp1d_team_gemm, cblk,
+                   nbblok, work, lwork );
+
     return nbpivots;
 }
 
@@ -363,11 +790,33 @@ cpucblk_zgetrfsp1d( SolverMatrix       *solvmtx,
     SolverBlok  *blok, *lblk;
     pastix_int_t nbpivots;
 
+    /* Large panels are shared with the idle threads of the static scheduler */
+    if ( (solvmtx->teamwidth > 0) &&
+         (cblk_colnbr( cblk ) >= solvmtx->teamwidth) &&
+         !(cblk->cblktype & (CBLK_LAYOUT_2D | CBLK_COMPRESSED)) )
+    {
+        return cpucblk_zgetrfsp1d_team( solvmtx, cblk, work, lwork );
+    }
+
     nbpivots = cpucblk_zgetrfsp1d_panel( solvmtx, cblk, L, U );
 
     blok = cblk->fblokptr + 1; /* this diagonal block */
     lblk = cblk[1].fblokptr;   /* the next diagonal block */
 
+    /* Small panels emit all their updates at once */
+    if ( cpucblk_zgemmsp_batch( PastixLCoef, PastixTrans,
+                                solvmtx, cblk, L, U ) == PASTIX_SUCCESS )
+    {
+        /* The upper part is then eligible as well */
+        cpucblk_zgemmsp_batch( PastixUCoef, PastixTrans,
+                               solvmtx, cblk, U, L );
+        for( ; blok < lblk; blok++ ) {
+            cpucblk_zrelease_deps( PastixLUCoef, solvmtx, cblk,
+                                   solvmtx->cblktab + blok->fcblknm );
+        }
+        return nbpivots;
+    }
+
     /* if there are off-diagonal supernodes in the column */
     for( ; blok < lblk; blok++ )
     {
@@ -377,20 +826,162 @@ cpucblk_zgetrfsp1d( SolverMatrix       *solvmtx,
             cpucblk_zalloc( PastixLUCoef, fcblk );
         }
 
+        /* Update on L and U in a single pass */
+        if ( solvmtx->lufused ) {
+            cpucblk_zgemmsp_lu( cblk, blok, fcblk, L, U,
+                                work, lwork, &(solvmtx->lowrank) );
+        }
+        else {
+            /* Update on L */
+            cpucblk_zgemmsp( PastixLCoef, PastixTrans,
+                             cblk, blok, fcblk,
+                             L, U, cblk_getdataL( fcblk ),
+                             work, lwork, &(solvmtx->lowrank) );
+
+            /* Update on U */
+            if ( blok+1 < lblk ) {
+                cpucblk_zgemmsp( PastixUCoef, PastixTrans,
+                                 cblk, blok, fcblk,
+                                 U, L, cblk_getdataU( fcblk ),
+                                 work, lwork, &(solvmtx->lowrank) );
+            }
+        }
+        cpucblk_zrelease_deps( PastixLUCoef, solvmtx, cblk, fcblk );
+    }
+
+    return nbpivots;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Gather all the updates contributing to a panel for the left-looking
+ * LU factorization.
+ *
+ * The contributions are pulled from the blocks facing the panel in the browtab
+ * array. All the source panels must have been factorized. The Schur
+ * complement panels are never a source of contribution.
+ *
+ *******************************************************************************
+ *
+ * @param[in] solvmtx
+ *          Solver Matrix structure of the problem
+ *
+ * @param[inout] cblk
+ *          Pointer to the structure representing the panel that receives the
+ *          updates in the cblktab array.
+ *
+ * @param[in] work
+ *          Temporary memory buffer.
+ *
+ * @param[in] lwork
+ *          Temporary workspace dimension.
+ *
+ *******************************************************************************/
+void
+cpucblk_zgetrfsp1d_gather( SolverMatrix       *solvmtx,
+                           SolverCblk         *cblk,
+                           pastix_complex64_t *work,
+                           pastix_int_t        lwork )
+{
+    SolverCblk  *scblk;
+    SolverBlok  *blok;
+    pastix_int_t m;
+
+    for( m = cblk[0].brownum; m < cblk[1].brownum; m++ )
+    {
+        blok  = solvmtx->bloktab + solvmtx->browtab[m];
+        scblk = solvmtx->cblktab + blok->lcblknm;
+
+        if ( scblk->cblktype & CBLK_IN_SCHUR ) {
+            continue;
+        }
+
+        /* Update on L and U in a single pass */
+        if ( solvmtx->lufused ) {
+            cpucblk_zgemmsp_lu( scblk, blok, cblk,
+                                cblk_getdataL( scblk ), cblk_getdataU( scblk ),
+                                work, lwork, &(solvmtx->lowrank) );
+            continue;
+        }
+
         /* Update on L */
         cpucblk_zgemmsp( PastixLCoef, PastixTrans,
-                         cblk, blok, fcblk,
-                         L, U, cblk_getdataL( fcblk ),
+                         scblk, blok, cblk,
+                         cblk_getdataL( scblk ), cblk_getdataU( scblk ),
+                         cblk_getdataL( cblk ),
                          work, lwork, &(solvmtx->lowrank) );
 
         /* Update on U */
-        if ( blok+1 < lblk ) {
+        if ( blok+1 < scblk[1].fblokptr ) {
             cpucblk_zgemmsp( PastixUCoef, PastixTrans,
-                             cblk, blok, fcblk,
-                             U, L, cblk_getdataU( fcblk ),
+                             scblk, blok, cblk,
+                             cblk_getdataU( scblk ), cblk_getdataL( scblk ),
+                             cblk_getdataU( cblk ),
                              work, lwork, &(solvmtx->lowrank) );
         }
-        cpucblk_zrelease_deps( PastixLUCoef, solvmtx, cblk, fcblk );
+    }
+
+    /* All the contributions are in, apply the deferred low-rank updates */
+    if ( solvmtx->lowrank.compress_deferred &&
+         (cblk->cblktype & CBLK_COMPRESSED) )
+    {
+        cpucblk_zlrflush( PastixLUCoef, cblk, &(solvmtx->lowrank) );
+    }
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Perform the left-looking LU factorization of a given panel.
+ *
+ * All the updates are first gathered into the panel, which is then factorized.
+ * The dependencies of the panels facing the off-diagonal blocks are released
+ * without any update, as they will pull their contributions themselves. Thus,
+ * a single thread writes into each panel.
+ *
+ *******************************************************************************
+ *
+ * @param[in] solvmtx
+ *          Solver Matrix structure of the problem
+ *
+ * @param[in] cblk
+ *          Pointer to the structure representing the panel to factorize in the
+ *          cblktab array.  Next column blok must be accessible through cblk[1].
+ *
+ * @param[in] work
+ *          Temporary memory buffer.
+ *
+ * @param[in] lwork
+ *          Temporary workspace dimension.
+ *
+ *******************************************************************************
+ *
+ * @return The number of static pivoting during factorization of the diagonal
+ * block.
+ *
+ *******************************************************************************/
+int
+cpucblk_zgetrfsp1d_ll( SolverMatrix       *solvmtx,
+                       SolverCblk         *cblk,
+                       pastix_complex64_t *work,
+                       pastix_int_t        lwork )
+{
+    SolverBlok  *blok, *lblk;
+    pastix_int_t nbpivots;
+
+    cpucblk_zgetrfsp1d_gather( solvmtx, cblk, work, lwork );
+
+    nbpivots = cpucblk_zgetrfsp1d_panel( solvmtx, cblk,
+                                         cblk_getdataL( cblk ),
+                                         cblk_getdataU( cblk ) );
+
+    blok = cblk->fblokptr + 1; /* First off-diagonal block */
+    lblk = cblk[1].fblokptr;   /* Next diagonal block      */
+
+    for( ; blok < lblk; blok++ ) {
+        cpucblk_zrelease_deps( PastixLUCoef, solvmtx, cblk,
+                               solvmtx->cblktab + blok->fcblknm );
     }
 
     return nbpivots;
@@ -146,7 +146,7 @@ core_zlr2lr( core_zlrmm_t           *params,
         pastix_complex64_t *Cfr, *Coff;
         int allocated = 0;
         if ( (Cfr = core_zlrmm_getws( params, Cm * Cn )) == NULL ) {
-            Cfr = malloc( Cm * Cn * sizeof(pastix_complex64_t) );
+            Cfr = pastix_lrmem_malloc( Cm * Cn * sizeof(pastix_complex64_t) );
             allocated = 1;
         }
         Coff = Cfr + Cm * offy + offx;
@@ -185,7 +185,7 @@ core_zlr2lr( core_zlrmm_t           *params,
         total_flops += flops;
 
         if (allocated) {
-            free(Cfr);
+            pastix_lrmem_free(Cfr);
         }
     }
     /*
@@ -255,7 +255,7 @@ core_zlr2null(core_zlrmm_t           *params,
     if ( AB->rk > rklimit ) {
         pastix_complex64_t *Cfr, *Coff;
         if ( (Cfr = core_zlrmm_getws( params, Cm * Cn )) == NULL ) {
-            Cfr = malloc( Cm * Cn * sizeof(pastix_complex64_t) );
+            Cfr = pastix_lrmem_malloc( Cm * Cn * sizeof(pastix_complex64_t) );
             allocated = 1;
         }
         Coff = Cfr + Cm * offy + offx;
@@ -283,7 +283,7 @@ core_zlr2null(core_zlrmm_t           *params,
         total_flops += flops;
 
         if ( allocated ) {
-            free( work );
+            pastix_lrmem_free( Cfr );
         }
     }
     else {
@@ -300,7 +300,7 @@ core_zlr2null(core_zlrmm_t           *params,
 
             if ( AB->rk > 0 ) {
                 if ( (ABfr = core_zlrmm_getws( params, M * N )) == NULL ) {
-                    ABfr = malloc( M * N * sizeof(pastix_complex64_t) );
+                    ABfr = pastix_lrmem_malloc( M * N * sizeof(pastix_complex64_t) );
                     allocated = 1;
                 }
 
@@ -328,7 +328,7 @@ core_zlr2null(core_zlrmm_t           *params,
             total_flops += flops;
 
             if ( allocated ) {
-                free( ABfr );
+                pastix_lrmem_free( ABfr );
             }
         }
         /*
@@ -345,6 +345,186 @@ core_zlr2null(core_zlrmm_t           *params,
     return total_flops;
 }
 
+/**
+ *******************************************************************************
+ *
+ * @brief Dispatch the addition of the low-rank matrix A into C, with respect to
+ * the current format of C. The lock of C must be held by the caller.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] params
+ *          The LRMM structure that stores all the parameters used in the LRMM
+ *          functions family.
+ *          @sa core_zlrmm_t
+ *
+ * @param[in] A
+ *          The low-rank structure of the A matrix to add to C.
+ *
+ * @param[in] transV
+ *          Specify if A->v is stored normally or transposed.
+ *
+ * @param[in] infomask
+ *          Mask of informations returned by the core_zxx2lr() functions.
+ *
+ *******************************************************************************
+ *
+ * @return The number of flops required to perform the operation.
+ *
+ *******************************************************************************/
+static inline pastix_fixdbl_t
+core_zlradd_dispatch( core_zlrmm_t           *params,
+                      const pastix_lrblock_t *A,
+                      pastix_trans_t          transV,
+                      int                     infomask )
+{
+    switch ( params->C->rk ) {
+    case -1:
+        /*
+         * C became full rank
+         */
+        return core_zlr2fr( params, A, transV );
+
+    case 0:
+        /*
+         * C is still null
+         */
+        return core_zlr2null( params, A, transV, infomask );
+
+    default:
+        /*
+         * C is low-rank of rank k
+         */
+        return core_zlr2lr( params, A, transV );
+    }
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Add the accumulated updates of params->Cacc to C with a single
+ * recompression, and release the accumulator. The lock of C must be held by
+ * the caller.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] params
+ *          The LRMM structure that stores all the parameters used in the LRMM
+ *          functions family. Only lowrank, Cm, Cn, C, Cacc and the workspace
+ *          are used.
+ *          @sa core_zlrmm_t
+ *
+ *******************************************************************************
+ *
+ * @return The number of flops required to perform the operation.
+ *
+ *******************************************************************************/
+static inline pastix_fixdbl_t
+core_zlracc_flush( core_zlrmm_t *params )
+{
+    core_zlrmm_t      fparams = *params;
+    pastix_lrblock_t *acc     = *(params->Cacc);
+    pastix_fixdbl_t   flops   = 0.;
+
+    /* The accumulator is aligned on C */
+    fparams.M     = params->Cm;
+    fparams.N     = params->Cn;
+    fparams.offx  = 0;
+    fparams.offy  = 0;
+    fparams.alpha = 1.0;
+    fparams.beta  = 1.0;
+    fparams.Cacc  = NULL;
+
+    if ( acc->rk > 0 ) {
+        flops = core_zlradd_dispatch( &fparams, acc, PastixNoTrans, 0 );
+    }
+
+    core_zlrfree( acc );
+    memFree_null( acc );
+    *(params->Cacc) = NULL;
+
+    return flops;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Stack the low-rank product AB in the accumulator of the deferred
+ * updates of C. The accumulator is flushed into C first if it cannot store AB.
+ * The lock of C must be held by the caller.
+ *
+ * The columns of alpha * AB->u and the rows of AB->v are copied at the offsets
+ * of AB in C, such that the accumulator is a Cm-by-Cn low-rank matrix whose
+ * rank is the sum of the ranks of the stacked products.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] params
+ *          The LRMM structure that stores all the parameters used in the LRMM
+ *          functions family.
+ *          @sa core_zlrmm_t
+ *
+ * @param[in] AB
+ *          The low-rank structure of the AB matrix to stack. AB->rk > 0.
+ *
+ * @param[in] transV
+ *          Specify if AB->v is stored normally or transposed.
+ *
+ *******************************************************************************
+ *
+ * @return The number of flops required to perform the operation.
+ *
+ *******************************************************************************/
+static inline pastix_fixdbl_t
+core_zlracc_add( core_zlrmm_t           *params,
+                 const pastix_lrblock_t *AB,
+                 pastix_trans_t          transV )
+{
+    PASTE_CORE_ZLRMM_PARAMS( params );
+    pastix_lrblock_t   *acc   = *(params->Cacc);
+    pastix_int_t        rkacc = pastix_imin( core_get_rklimit( Cm, Cn ), pastix_imin( Cm, Cn ) );
+    pastix_int_t        ldabv = (transV == PastixNoTrans) ? AB->rkmax : N;
+    pastix_complex64_t *u, *v;
+    pastix_fixdbl_t     flops = 0.;
+
+    assert( AB->rk > 0 );
+
+    /* Make room for AB */
+    if ( (acc != NULL) && ((acc->rk + AB->rk) > acc->rkmax) ) {
+        flops += core_zlracc_flush( params );
+        acc = NULL;
+    }
+
+    /* AB alone exceeds the budget, it is directly added to C */
+    if ( AB->rk > rkacc ) {
+        flops += core_zlradd_dispatch( params, AB, transV, 0 );
+        PASTE_CORE_ZLRMM_VOID;
+        return flops;
+    }
+
+    if ( acc == NULL ) {
+        /* core_zlralloc() initializes the factors to 0 */
+        MALLOC_INTERN( acc, 1, pastix_lrblock_t );
+        core_zlralloc( Cm, Cn, rkacc, acc );
+        *(params->Cacc) = acc;
+    }
+    assert( (acc->rk + AB->rk) <= acc->rkmax );
+
+    u = ((pastix_complex64_t*)(acc->u)) + Cm * acc->rk + offx;
+    v = ((pastix_complex64_t*)(acc->v)) + acc->rkmax * offy + acc->rk;
+
+    core_zgeadd( PastixNoTrans, M, AB->rk,
+                 alpha, AB->u, M,
+                 0.,    u,     Cm );
+    core_zgeadd( transV, AB->rk, N,
+                 1.,    AB->v, ldabv,
+                 0.,    v,     acc->rkmax );
+    acc->rk += AB->rk;
+
+    PASTE_CORE_ZLRMM_VOID;
+    return flops;
+}
+
 /**
  *******************************************************************************
  *
@@ -389,27 +569,16 @@ core_zlradd( core_zlrmm_t           *params,
     pastix_fixdbl_t   flops = 0.;
 
     if ( A->rk != 0 ) {
-        pastix_atomic_lock( params->lock );
-        switch ( C->rk ) {
-        case -1:
-            /*
-             * C became full rank
-             */
-            flops = core_zlr2fr( params, A, transV );
-            break;
-
-        case 0:
-            /*
-             * C is still null
-             */
-            flops = core_zlr2null( params, A, transV, infomask );
-            break;
-
-        default:
-            /*
-             * C is low-rank of rank k
-             */
-            flops = core_zlr2lr( params, A, transV );
+        kernels_lock( params->lock );
+        /*
+         * Low-rank updates of a low-rank C are stacked and recompressed
+         * together when the accumulator is full or flushed
+         */
+        if ( (params->Cacc != NULL) && (C->rk > 0) && (A->rk > 0) ) {
+            flops = core_zlracc_add( params, A, transV );
+        }
+        else {
+            flops = core_zlradd_dispatch( params, A, transV, infomask );
         }
         assert( C->rk <= C->rkmax);
         pastix_atomic_unlock( params->lock );
@@ -417,3 +586,59 @@ core_zlradd( core_zlrmm_t           *params,
 
     return flops;
 }
+
+/**
+ *******************************************************************************
+ *
+ * @brief Add the deferred updates accumulated in Cacc to the low-rank matrix C.
+ *
+ * This function is not protected by the lock of C, and must be called when no
+ * more updates can be added to C, for instance when all the contributions to
+ * the column block of C have been received.
+ *
+ *******************************************************************************
+ *
+ * @param[in] lowrank
+ *          The structure with low-rank parameters.
+ *
+ * @param[in] M
+ *          The number of rows of the matrix C.
+ *
+ * @param[in] N
+ *          The number of columns of the matrix C.
+ *
+ * @param[inout] C
+ *          The low-rank structure of the C matrix.
+ *          On exit, C is updated with the accumulated updates.
+ *
+ * @param[inout] Cacc
+ *          The accumulator of the deferred updates of C.
+ *          On exit, the accumulator is released and *Cacc is set to NULL.
+ *
+ *******************************************************************************
+ *
+ * @return The number of flops required to perform the operation.
+ *
+ *******************************************************************************/
+pastix_fixdbl_t
+core_zlrflush( const pastix_lr_t *lowrank,
+               pastix_int_t       M,
+               pastix_int_t       N,
+               pastix_lrblock_t  *C,
+               pastix_lrblock_t **Cacc )
+{
+    core_zlrmm_t params;
+
+    if ( *Cacc == NULL ) {
+        return 0.;
+    }
+
+    memset( &params, 0, sizeof(core_zlrmm_t) );
+    params.lowrank = lowrank;
+    params.Cm      = M;
+    params.Cn      = N;
+    params.C       = C;
+    params.Cacc    = Cacc;
+
+    return core_zlracc_flush( &params );
+}
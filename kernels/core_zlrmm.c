@@ -159,10 +159,10 @@ core_zlrmm_Cnull( core_zlrmm_t *params )
 
     /* Free memory from zlrm3 */
     if ( infomask & PASTIX_LRM3_ALLOCU ) {
-        free(AB.u);
+        pastix_lrmem_free(AB.u);
     }
     if ( infomask & PASTIX_LRM3_ALLOCV ) {
-        free(AB.v);
+        pastix_lrmem_free(AB.v);
     }
 
     PASTE_CORE_ZLRMM_VOID;
@@ -242,10 +242,10 @@ core_zlrmm_Clr( core_zlrmm_t *params )
 
     /* Free memory from zlrm3 */
     if ( infomask & PASTIX_LRM3_ALLOCU ) {
-        free(AB.u);
+        pastix_lrmem_free(AB.u);
     }
     if ( infomask & PASTIX_LRM3_ALLOCV ) {
-        free(AB.v);
+        pastix_lrmem_free(AB.v);
     }
 
     PASTE_CORE_ZLRMM_VOID;
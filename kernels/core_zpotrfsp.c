@@ -74,25 +74,19 @@ core_zpotf2sp( pastix_int_t        n,
     pastix_int_t k;
     pastix_complex64_t *Akk = A;   /* A [k  ][k] */
     pastix_complex64_t *Amk = A+1; /* A [k+1][k] */
-    pastix_complex64_t  alpha;
 
     for (k=0; k<n; k++){
-        if ( cabs(*Akk) < criterion ) {
-            (*Akk) = (pastix_complex64_t)criterion;
-            (*nbpivots)++;
-        }
-
-        /* Hermitian matrices, so imaginary part should be 0 */
-        if ( creal(*Akk) < 0.0 )
+        /*
+         * Hermitian matrices, so imaginary part should be 0. The elements below
+         * the criterion are perturbed to +criterion.
+         */
+        if ( creal(*Akk) <= -criterion )
         {
             pastix_print_error( "Negative diagonal term\n" );
         }
 
-        *Akk = csqrt(*Akk);
-        alpha = 1.0 / (*Akk);
-
         /* Scale the diagonal to compute L((k+1):n,k) */
-        cblas_zscal(n-k-1, CBLAS_SADDR( alpha ), Amk, 1 );
+        (*nbpivots) += core_zscalpiv( n-k-1, Akk, Amk, criterion, 1 );
 
         /* Move to next Akk */
         Akk += (lda+1);
@@ -113,6 +107,11 @@ core_zpotf2sp( pastix_int_t        n,
  * @brief Compute the block static pivoting Cholesky factorization of the matrix
  * n-by-n A = L * L^t .
  *
+ * The matrix is recursively split in two halves, such that most of the
+ * computations are performed by level-3 kernels whatever the size of the
+ * diagonal block. Blocks of at most MAXSIZEOFBLOCKS columns are factorized by
+ * the level-2 kernel, which applies the static pivoting.
+ *
  *******************************************************************************
  *
  * @param[in] n
@@ -147,45 +146,40 @@ core_zpotrfsp( pastix_int_t        n,
                pastix_int_t       *nbpivots,
                double              criterion )
 {
-    pastix_int_t k, blocknbr, blocksize, matrixsize;
-    pastix_complex64_t *tmp,*tmp1,*tmp2;
-
-    /* diagonal supernode is divided into MAXSIZEOFBLOCK-by-MAXSIZEOFBLOCKS blocks */
-    blocknbr = pastix_iceil( n, MAXSIZEOFBLOCKS );
-
-    for (k=0; k<blocknbr; k++) {
-
-        blocksize = pastix_imin(MAXSIZEOFBLOCKS, n-k*MAXSIZEOFBLOCKS);
-        tmp  = A+(k*MAXSIZEOFBLOCKS)*(lda+1);      /* Lk,k     */
-
-        /* Factorize the diagonal block Akk*/
-        core_zpotf2sp(blocksize, tmp, lda, nbpivots, criterion);
-
-        if ((k*MAXSIZEOFBLOCKS+blocksize) < n) {
-
-            tmp1 = tmp  + blocksize;       /* Lk+1,k   */
-            tmp2 = tmp1 + blocksize * lda; /* Lk+1,k+1 */
+    pastix_int_t n1, n2;
+    pastix_complex64_t *A21, *A22;
 
-            matrixsize = n-(k*MAXSIZEOFBLOCKS+blocksize);
-
-            /* Compute the column L(k+1:n,k) = (L(k,k)D(k,k))^{-1}A(k+1:n,k)    */
-            /* 1) Compute A(k+1:n,k) = A(k+1:n,k)L(k,k)^{-T} = D(k,k)L(k+1:n,k) */
-                        /* input: L(k,k) in tmp, A(k+1:n,k) in tmp1   */
-                        /* output: A(k+1:n,k) in tmp1                 */
-            cblas_ztrsm(CblasColMajor,
-                        CblasRight, CblasLower,
-                        CblasConjTrans, CblasNonUnit,
-                        matrixsize, blocksize,
-                        CBLAS_SADDR(zone), tmp,  lda,
-                                           tmp1, lda);
-
-            /* Update Ak+1k+1 = Ak+1k+1 - Lk+1k * Lk+1kT */
-            cblas_zherk(CblasColMajor, CblasLower, CblasNoTrans,
-                        matrixsize, blocksize,
-                        (double)mzone, tmp1, lda,
-                        (double)zone,  tmp2, lda);
-        }
+    /* Factorize the small diagonal blocks with the level-2 kernel */
+    if ( n <= MAXSIZEOFBLOCKS ) {
+        core_zpotf2sp( n, A, lda, nbpivots, criterion );
+        return;
     }
+
+    /* Split the block such that the first part is a multiple of the block size */
+    n1 = MAXSIZEOFBLOCKS * pastix_iceil( n / 2, MAXSIZEOFBLOCKS );
+    n2 = n - n1;
+    A21 = A   + n1;
+    A22 = A21 + n1 * lda;
+
+    /* Factorize A11 */
+    core_zpotrfsp( n1, A, lda, nbpivots, criterion );
+
+    /* Compute L21 = A21 L11^{-H} */
+    cblas_ztrsm(CblasColMajor,
+                CblasRight, CblasLower,
+                CblasConjTrans, CblasNonUnit,
+                n2, n1,
+                CBLAS_SADDR(zone), A,   lda,
+                                   A21, lda);
+
+    /* Update A22 = A22 - L21 * L21^H */
+    cblas_zherk(CblasColMajor, CblasLower, CblasNoTrans,
+                n2, n1,
+                (double)mzone, A21, lda,
+                (double)zone,  A22, lda);
+
+    /* Factorize A22 */
+    core_zpotrfsp( n2, A22, lda, nbpivots, criterion );
 }
 
 /**
@@ -257,6 +251,9 @@ cpucblk_zpotrfsp1d_potrf( SolverMatrix *solvmtx,
 
     kernel_trace_stop( cblk->fblokptr->inlast, PastixKernelPOTRF, ncols, 0, 0, flops, time );
 
+    if ( solvmtx->cblkpivots != NULL ) {
+        solvmtx->cblkpivots[ cblk - solvmtx->cblktab ] = nbpivots;
+    }
     if ( nbpivots ) {
         pastix_atomic_add_32b( &(solvmtx->nbpivots), nbpivots );
     }
@@ -296,13 +293,133 @@ cpucblk_zpotrfsp1d_panel( SolverMatrix *solvmtx,
     pastix_int_t nbpivots;
     nbpivots = cpucblk_zpotrfsp1d_potrf( solvmtx, cblk, L );
 
-    cpucblk_ztrsmsp( PastixRight, PastixLower,
-                     PastixConjTrans, PastixNonUnit,
-                     cblk, L, L, &(solvmtx->lowrank) );
+    cpucblk_ztrsmsp_team( solvmtx, PastixRight, PastixLower,
+                          PastixConjTrans, PastixNonUnit,
+                          cblk, L, L );
     return nbpivots;
 }
 
 
+/**
+ *******************************************************************************
+ *
+ * @brief Solve a chunk of rows of the off-diagonal blocks of a large panel.
+ *
+ * Team item of cpucblk_zpotrfsp1d_team(). The chunks are as high as the panel
+ * is wide.
+ *
+ *******************************************************************************/
+static void
+core_zpotrfsp1d_team_trsm( SolverMatrix *solvmtx,
+                           void         *args,
+                           pastix_int_t  item,
+                           void         *work,
+                           pastix_int_t  lwork )
+{
+    SolverCblk  *cblk   = (SolverCblk *)args;
+    pastix_int_t n      = cblk_colnbr( cblk );
+    pastix_int_t fstrow = item * n;
+    pastix_int_t nbrows = pastix_imin( n, cblk->stride - n - fstrow );
+
+    cpucblk_ztrsmsp_rows( PastixRight, PastixLower,
+                          PastixConjTrans, PastixNonUnit,
+                          cblk, cblk->lcoeftab, cblk->lcoeftab,
+                          fstrow, nbrows );
+
+    (void)solvmtx;
+    (void)work;
+    (void)lwork;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Apply the updates of one off-diagonal block of a large panel.
+ *
+ * Team item of cpucblk_zpotrfsp1d_team().
+ *
+ *******************************************************************************/
+static void
+core_zpotrfsp1d_team_gemm( SolverMatrix *solvmtx,
+                           void         *args,
+                           pastix_int_t  item,
+                           void         *work,
+                           pastix_int_t  lwork )
+{
+    SolverCblk *cblk  = (SolverCblk *)args;
+    SolverBlok *blok  = cblk->fblokptr + 1 + item;
+    SolverCblk *fcblk = solvmtx->cblktab + blok->fcblknm;
+
+    if ( fcblk->cblktype & CBLK_FANIN ) {
+        cpucblk_zalloc( PastixLCoef, fcblk );
+    }
+
+    cpucblk_zgemmsp( PastixLCoef, PastixConjTrans,
+                     cblk, blok, fcblk,
+                     cblk->lcoeftab, cblk->lcoeftab, cblk_getdataL( fcblk ),
+                     work, lwork, &(solvmtx->lowrank) );
+
+    cpucblk_zrelease_deps( PastixLCoef, solvmtx, cblk, fcblk );
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Perform the Cholesky factorization of a large panel and apply all its
+ * updates with the help of the idle threads.
+ *
+ * The diagonal block is factorized by the calling thread. The TRSM of the
+ * off-diagonal blocks, and then their updates, are split in items processed by
+ * the calling thread and by the threads of the static scheduler that wait for
+ * their dependencies (see solverTeamRun()). The panel must be stored in 1D and
+ * in full rank.
+ *
+ *******************************************************************************
+ *
+ * @param[in] solvmtx
+ *          Solver Matrix structure of the problem
+ *
+ * @param[in] cblk
+ *          Pointer to the structure representing the panel to factorize in the
+ *          cblktab array.  Next column blok must be accessible through cblk[1].
+ *
+ * @param[in] work
+ *          Temporary memory buffer.
+ *
+ * @param[in] lwork
+ *          Temporary workspace dimension.
+ *
+ *******************************************************************************
+ *
+ * @return The number of static pivoting during factorization of the diagonal
+ * block.
+ *
+ *******************************************************************************/
+static inline int
+cpucblk_zpotrfsp1d_team( SolverMatrix       *solvmtx,
+                         SolverCblk         *cblk,
+                         pastix_complex64_t *work,
+                         pastix_int_t        lwork )
+{
+    pastix_int_t n      = cblk_colnbr( cblk );
+    pastix_int_t nbblok = cblk[1].fblokptr - cblk->fblokptr - 1;
+    pastix_int_t nbpivots;
+
+    assert( !(cblk->cblktype & (CBLK_LAYOUT_2D | CBLK_COMPRESSED)) );
+
+    nbpivots = cpucblk_zpotrfsp1d_potrf( solvmtx, cblk, cblk->lcoeftab );
+    if ( nbblok == 0 ) {
+        return nbpivots;
+    }
+
+    solverTeamRun( solvmtx, core_zpotrfsp1d_team_trsm, cblk,
+                   pastix_iceil( cblk->stride - n, n ), work, lwork );
+    solverTeamRun( solvmtx, core_zpotrfsp1d_team_gemm, cblk,
+                   nbblok, work, lwork );
+
+    return nbpivots;
+}
+
 /**
  *******************************************************************************
  *
@@ -341,11 +458,30 @@ cpucblk_zpotrfsp1d( SolverMatrix       *solvmtx,
     SolverBlok  *blok, *lblk;
     pastix_int_t nbpivots;
 
+    /* Large panels are shared with the idle threads of the static scheduler */
+    if ( (solvmtx->teamwidth > 0) &&
+         (cblk_colnbr( cblk ) >= solvmtx->teamwidth) &&
+         !(cblk->cblktype & (CBLK_LAYOUT_2D | CBLK_COMPRESSED)) )
+    {
+        return cpucblk_zpotrfsp1d_team( solvmtx, cblk, work, lwork );
+    }
+
     nbpivots = cpucblk_zpotrfsp1d_panel( solvmtx, cblk, L );
 
     blok = cblk->fblokptr + 1; /* First off-diagonal block */
     lblk = cblk[1].fblokptr;   /* Next diagonal block      */
 
+    /* Small panels emit all their updates at once */
+    if ( cpucblk_zgemmsp_batch( PastixLCoef, PastixConjTrans,
+                                solvmtx, cblk, L, L ) == PASTIX_SUCCESS )
+    {
+        for( ; blok < lblk; blok++ ) {
+            cpucblk_zrelease_deps( PastixLCoef, solvmtx, cblk,
+                                   solvmtx->cblktab + blok->fcblknm );
+        }
+        return nbpivots;
+    }
+
     /* If there are off-diagonal blocks, perform the updates */
     for( ; blok < lblk; blok++ )
     {
@@ -365,3 +501,119 @@ cpucblk_zpotrfsp1d( SolverMatrix       *solvmtx,
 
     return nbpivots;
 }
+
+/**
+ *******************************************************************************
+ *
+ * @brief Gather all the updates contributing to a panel for the left-looking
+ * Cholesky factorization.
+ *
+ * The contributions are pulled from the blocks facing the panel in the browtab
+ * array. All the source panels must have been factorized. The Schur
+ * complement panels are never a source of contribution.
+ *
+ *******************************************************************************
+ *
+ * @param[in] solvmtx
+ *          Solver Matrix structure of the problem
+ *
+ * @param[inout] cblk
+ *          Pointer to the structure representing the panel that receives the
+ *          updates in the cblktab array.
+ *
+ * @param[in] work
+ *          Temporary memory buffer.
+ *
+ * @param[in] lwork
+ *          Temporary workspace dimension.
+ *
+ *******************************************************************************/
+void
+cpucblk_zpotrfsp1d_gather( SolverMatrix       *solvmtx,
+                           SolverCblk         *cblk,
+                           pastix_complex64_t *work,
+                           pastix_int_t        lwork )
+{
+    SolverCblk  *scblk;
+    SolverBlok  *blok;
+    pastix_int_t m;
+
+    for( m = cblk[0].brownum; m < cblk[1].brownum; m++ )
+    {
+        blok  = solvmtx->bloktab + solvmtx->browtab[m];
+        scblk = solvmtx->cblktab + blok->lcblknm;
+
+        if ( scblk->cblktype & CBLK_IN_SCHUR ) {
+            continue;
+        }
+
+        cpucblk_zgemmsp( PastixLCoef, PastixConjTrans,
+                         scblk, blok, cblk,
+                         cblk_getdataL( scblk ), cblk_getdataL( scblk ),
+                         cblk_getdataL( cblk ),
+                         work, lwork, &(solvmtx->lowrank) );
+    }
+
+    /* All the contributions are in, apply the deferred low-rank updates */
+    if ( solvmtx->lowrank.compress_deferred &&
+         (cblk->cblktype & CBLK_COMPRESSED) )
+    {
+        cpucblk_zlrflush( PastixLCoef, cblk, &(solvmtx->lowrank) );
+    }
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Perform the left-looking Cholesky factorization of a given panel.
+ *
+ * All the updates are first gathered into the panel, which is then factorized.
+ * The dependencies of the panels facing the off-diagonal blocks are released
+ * without any update, as they will pull their contributions themselves. Thus,
+ * a single thread writes into each panel.
+ *
+ *******************************************************************************
+ *
+ * @param[in] solvmtx
+ *          Solver Matrix structure of the problem
+ *
+ * @param[in] cblk
+ *          Pointer to the structure representing the panel to factorize in the
+ *          cblktab array.  Next column blok must be accessible through cblk[1].
+ *
+ * @param[in] work
+ *          Temporary memory buffer.
+ *
+ * @param[in] lwork
+ *          Temporary workspace dimension.
+ *
+ *******************************************************************************
+ *
+ * @return The number of static pivoting during factorization of the diagonal
+ * block.
+ *
+ *******************************************************************************/
+int
+cpucblk_zpotrfsp1d_ll( SolverMatrix       *solvmtx,
+                       SolverCblk         *cblk,
+                       pastix_complex64_t *work,
+                       pastix_int_t        lwork )
+{
+    SolverBlok  *blok, *lblk;
+    pastix_int_t nbpivots;
+
+    cpucblk_zpotrfsp1d_gather( solvmtx, cblk, work, lwork );
+
+    nbpivots = cpucblk_zpotrfsp1d_panel( solvmtx, cblk,
+                                         cblk_getdataL( cblk ) );
+
+    blok = cblk->fblokptr + 1; /* First off-diagonal block */
+    lblk = cblk[1].fblokptr;   /* Next diagonal block      */
+
+    for( ; blok < lblk; blok++ ) {
+        cpucblk_zrelease_deps( PastixLCoef, solvmtx, cblk,
+                               solvmtx->cblktab + blok->fcblknm );
+    }
+
+    return nbpivots;
+}
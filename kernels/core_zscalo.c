@@ -109,6 +109,10 @@ core_zscalo( pastix_trans_t            trans,
     }
 #endif
 
+    if ( core_zscalo_small( trans, M, N, A, lda, D, ldd, B, ldb ) == PASTIX_SUCCESS ) {
+        return PASTIX_SUCCESS;
+    }
+
 #if defined(PRECISION_z) || defined(PRECISION_c)
     if (trans == PastixConjTrans) {
         for( j=0; j<N; j++, D += ldd ) {
@@ -137,6 +141,86 @@ core_zscalo( pastix_trans_t            trans,
     return PASTIX_SUCCESS;
 }
 
+/**
+ ******************************************************************************
+ *
+ * @brief Apply the static pivoting to a diagonal element and scale the column
+ * below it by its inverse.
+ *
+ * If the diagonal element A_kk is below the criterion in absolute value, it is
+ * replaced by the criterion. In the LL^t factorizations, A_kk is then replaced
+ * by its square root. The m elements below A_kk are finally scaled by 1/A_kk.
+ *
+ * This is the per-column step of the level-2 kernels of the diagonal blocks.
+ * Their columns are short, so in real arithmetic the scaling is performed by a
+ * loop vectorized by the compiler instead of a BLAS call.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of elements below the diagonal element.
+ *
+ * @param[inout] Akk
+ *          The diagonal element. On exit, the perturbed element, or its square
+ *          root if llt is true.
+ *
+ * @param[inout] Aik
+ *          The array of the m elements below the diagonal element. On exit,
+ *          the elements are scaled by 1/Akk.
+ *
+ * @param[in] criterion
+ *          Threshold of the static pivoting.
+ *
+ * @param[in] llt
+ *          If true, the diagonal element is perturbed to +criterion and
+ *          replaced by its square root as in the LL^t factorizations.
+ *          Otherwise, it is perturbed to the criterion with the sign of its
+ *          real part.
+ *
+ *******************************************************************************
+ *
+ * @return 1 if the diagonal element has been perturbed, 0 otherwise.
+ *
+ ******************************************************************************/
+pastix_target_clones int
+core_zscalpiv( pastix_int_t        m,
+               pastix_complex64_t *Akk,
+               pastix_complex64_t *Aik,
+               double              criterion,
+               int                 llt )
+{
+    pastix_complex64_t alpha;
+    int perturbed = 0;
+
+    if ( cabs(*Akk) < criterion ) {
+        if ( !llt && (creal(*Akk) < 0.) ) {
+            *Akk = (pastix_complex64_t)(-criterion);
+        }
+        else {
+            *Akk = (pastix_complex64_t)criterion;
+        }
+        perturbed = 1;
+    }
+
+    if ( llt ) {
+        *Akk = csqrt(*Akk);
+    }
+    alpha = 1.0 / (*Akk);
+
+#if defined(PRECISION_z) || defined(PRECISION_c)
+    cblas_zscal( m, CBLAS_SADDR( alpha ), Aik, 1 );
+#else
+    {
+        pastix_int_t i;
+        for( i=0; i<m; i++ ) {
+            Aik[i] *= alpha;
+        }
+    }
+#endif
+
+    return perturbed;
+}
+
 /**
  *******************************************************************************
  *
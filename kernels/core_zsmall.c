@@ -0,0 +1,751 @@
+/**
+ *
+ * @file core_zsmall.c
+ *
+ * PaStiX fixed-size kernels for the small blocks.
+ *
+ * The blocks of the cblks issued from low-degree vertices are often smaller
+ * than 16x16, and the generic BLAS/LAPACK calls are dominated by their
+ * overhead. Each kernel of this file is written once as an inline template
+ * with one compile-time dimension, and instantiated for all the sizes up to
+ * PASTIX_KERNEL_SMALL_MAX, such that the compiler fully unrolls the loops on
+ * this dimension. The dispatch tables select the instance from the size of the
+ * block, while pastix_kernel_small holds the threshold of each kernel in each
+ * arithmetic.
+ *
+ * @copyright 2012-2023 Bordeaux INP, CNRS (LaBRI UMR 5800), Inria,
+ *                      Univ. Bordeaux. All rights reserved.
+ *
+ * @version 6.3.0
+ * @author Mathieu Faverge
+ * @date 2026-10-17
+ * @precisions normal z -> c d s
+ *
+ **/
+#include "common.h"
+#include "blend/solver.h"
+#include "kernels.h"
+#include "pastix_zcores.h"
+
+#if defined(PRECISION_z) || defined(PRECISION_c)
+/**
+ * @brief Complex multiplication without the C99 handling of the infinite
+ * values, such that the loops of the templates can be vectorized.
+ */
+static pastix_always_inline pastix_complex64_t
+core_zsmall_mul( pastix_complex64_t a,
+                 pastix_complex64_t b )
+{
+    double ar = creal( a ), ai = cimag( a );
+    double br = creal( b ), bi = cimag( b );
+
+    return ( ar * br - ai * bi ) + ( ar * bi + ai * br ) * I;
+}
+#else
+#define core_zsmall_mul( _a_, _b_ ) ( (_a_) * (_b_) )
+#endif
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+/*
+ * Instantiate a template for all the sizes from 1 to PASTIX_KERNEL_SMALL_MAX
+ */
+#define core_zsmall_instantiate( _tpl_ )                                \
+    _tpl_(1)  _tpl_(2)  _tpl_(3)  _tpl_(4)                              \
+    _tpl_(5)  _tpl_(6)  _tpl_(7)  _tpl_(8)                              \
+    _tpl_(9)  _tpl_(10) _tpl_(11) _tpl_(12)                             \
+    _tpl_(13) _tpl_(14) _tpl_(15) _tpl_(16)
+
+/*
+ * Threshold of a kernel in the current arithmetic
+ */
+#define core_zsmall_threshold( _kernel_ ) \
+    pastix_kernel_small[PastixComplex64 - PastixFloat][_kernel_]
+
+#if PASTIX_KERNEL_SMALL_MAX != 16
+#error "core_zsmall_instantiate() must cover the sizes up to PASTIX_KERNEL_SMALL_MAX"
+#endif
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+/**
+ *******************************************************************************
+ *
+ * @brief Template of the fixed-size core_zgeadd(): B = beta * B + alpha * op(A)
+ *
+ * The number of rows M of B is the compile-time dimension. alpha must be
+ * non-zero, and B is not read if beta is zero.
+ *
+ *******************************************************************************/
+static pastix_always_inline void
+core_zgeadd_fixed( const pastix_int_t        M,
+                   pastix_trans_t            trans,
+                   pastix_int_t              N,
+                   pastix_complex64_t        alpha,
+                   const pastix_complex64_t *A,
+                   pastix_int_t              lda,
+                   pastix_complex64_t        beta,
+                   pastix_complex64_t       *B,
+                   pastix_int_t              ldb )
+{
+    pastix_complex64_t a[PASTIX_KERNEL_SMALL_MAX];
+    pastix_int_t i, j;
+
+    for( j=0; j<N; j++, B+=ldb ) {
+        if ( trans == PastixNoTrans ) {
+            for( i=0; i<M; i++ ) {
+                a[i] = A[lda * j + i];
+            }
+        }
+#if defined(PRECISION_z) || defined(PRECISION_c)
+        else if ( trans == PastixConjTrans ) {
+            for( i=0; i<M; i++ ) {
+                a[i] = conj( A[lda * i + j] );
+            }
+        }
+#endif
+        else {
+            for( i=0; i<M; i++ ) {
+                a[i] = A[lda * i + j];
+            }
+        }
+
+        if ( beta == 0.0 ) {
+            for( i=0; i<M; i++ ) {
+                B[i] = core_zsmall_mul( alpha, a[i] );
+            }
+        }
+        else {
+            for( i=0; i<M; i++ ) {
+                B[i] = core_zsmall_mul( beta, B[i] ) + core_zsmall_mul( alpha, a[i] );
+            }
+        }
+    }
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Template of the fixed-size core_zscalo(): B = op(A) * D
+ *
+ * The number of rows M of A and B is the compile-time dimension.
+ *
+ *******************************************************************************/
+static pastix_always_inline void
+core_zscalo_fixed( const pastix_int_t        M,
+                   pastix_trans_t            trans,
+                   pastix_int_t              N,
+                   const pastix_complex64_t *A,
+                   pastix_int_t              lda,
+                   const pastix_complex64_t *D,
+                   pastix_int_t              ldd,
+                   pastix_complex64_t       *B,
+                   pastix_int_t              ldb )
+{
+    pastix_complex64_t alpha;
+    pastix_int_t i, j;
+
+    for( j=0; j<N; j++, A+=lda, B+=ldb, D+=ldd ) {
+        alpha = *D;
+#if defined(PRECISION_z) || defined(PRECISION_c)
+        if ( trans == PastixConjTrans ) {
+            for( i=0; i<M; i++ ) {
+                B[i] = core_zsmall_mul( conj( A[i] ), alpha );
+            }
+            continue;
+        }
+#endif
+        for( i=0; i<M; i++ ) {
+            B[i] = core_zsmall_mul( A[i], alpha );
+        }
+    }
+    (void)trans;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Template of the fixed-size core_zgemdm():
+ * C = beta * C + alpha * op(A) * D * op(B)
+ *
+ * The number of rows M of C is the compile-time dimension, such that each
+ * column of C is kept in registers while it is updated. op(A) is first copied
+ * in a tile with a fixed leading dimension if it is transposed, and split in
+ * its real and imaginary parts in complex arithmetic. If D is NULL, it is
+ * considered as the identity. C is not read if beta is zero.
+ *
+ *******************************************************************************/
+static pastix_always_inline void
+core_zgemdm_fixed( const pastix_int_t        M,
+                   pastix_trans_t            transA,
+                   pastix_trans_t            transB,
+                   pastix_int_t              N,
+                   pastix_int_t              K,
+                   pastix_complex64_t        alpha,
+                   const pastix_complex64_t *A,
+                   pastix_int_t              lda,
+                   const pastix_complex64_t *B,
+                   pastix_int_t              ldb,
+                   pastix_complex64_t        beta,
+                   pastix_complex64_t       *C,
+                   pastix_int_t              ldc,
+                   const pastix_complex64_t *D,
+                   pastix_int_t              incD )
+{
+#if defined(PRECISION_z) || defined(PRECISION_c)
+    double                    Ar[PASTIX_KERNEL_SMALL_MAX * PASTIX_KERNEL_SMALL_MAX];
+    double                    Ai[PASTIX_KERNEL_SMALL_MAX * PASTIX_KERNEL_SMALL_MAX];
+    double                    cr[PASTIX_KERNEL_SMALL_MAX];
+    double                    ci[PASTIX_KERNEL_SMALL_MAX];
+    double                    br, bi;
+#else
+    pastix_complex64_t        At[PASTIX_KERNEL_SMALL_MAX * PASTIX_KERNEL_SMALL_MAX];
+    pastix_complex64_t        c[PASTIX_KERNEL_SMALL_MAX];
+#endif
+    const pastix_complex64_t *Bj;
+    pastix_complex64_t        b;
+    pastix_int_t              i, j, k, incB;
+
+#if defined(PRECISION_z) || defined(PRECISION_c)
+    /*
+     * Split op(A) in its real and imaginary parts, such that the updates are
+     * vectorized on real numbers
+     */
+    if ( transA == PastixNoTrans ) {
+        for( k=0; k<K; k++ ) {
+            for( i=0; i<M; i++ ) {
+                Ar[M * k + i] = creal( A[lda * k + i] );
+                Ai[M * k + i] = cimag( A[lda * k + i] );
+            }
+        }
+    }
+    else {
+        for( k=0; k<K; k++ ) {
+            for( i=0; i<M; i++ ) {
+                Ar[M * k + i] = creal( A[lda * i + k] );
+                Ai[M * k + i] = cimag( A[lda * i + k] );
+            }
+        }
+        if ( transA == PastixConjTrans ) {
+            for( i=0; i<M*K; i++ ) {
+                Ai[i] = -Ai[i];
+            }
+        }
+    }
+#else
+    /* Copy op(A) in a M -by- K tile */
+    if ( transA != PastixNoTrans ) {
+        for( k=0; k<K; k++ ) {
+            for( i=0; i<M; i++ ) {
+                At[M * k + i] = A[lda * i + k];
+            }
+        }
+        A   = At;
+        lda = M;
+    }
+#endif
+    incB = ( transB == PastixNoTrans ) ? 1 : ldb;
+
+    for( j=0; j<N; j++, C+=ldc ) {
+#if defined(PRECISION_z) || defined(PRECISION_c)
+        if ( beta == 0.0 ) {
+            for( i=0; i<M; i++ ) {
+                cr[i] = 0.0;
+                ci[i] = 0.0;
+            }
+        }
+        else {
+            for( i=0; i<M; i++ ) {
+                b = core_zsmall_mul( beta, C[i] );
+                cr[i] = creal( b );
+                ci[i] = cimag( b );
+            }
+        }
+#else
+        if ( beta == 0.0 ) {
+            for( i=0; i<M; i++ ) {
+                c[i] = 0.0;
+            }
+        }
+        else {
+            for( i=0; i<M; i++ ) {
+                c[i] = beta * C[i];
+            }
+        }
+#endif
+
+        /* C(:, j) += op(A) * alpha * D * op(B)(:, j) */
+        Bj = ( transB == PastixNoTrans ) ? B + ldb * j : B + j;
+        for( k=0; k<K; k++ ) {
+            b = Bj[incB * k];
+#if defined(PRECISION_z) || defined(PRECISION_c)
+            if ( transB == PastixConjTrans ) {
+                b = conj( b );
+            }
+#endif
+            if ( D != NULL ) {
+                b = core_zsmall_mul( b, D[incD * k] );
+            }
+            b = core_zsmall_mul( b, alpha );
+
+#if defined(PRECISION_z) || defined(PRECISION_c)
+            br = creal( b );
+            bi = cimag( b );
+            for( i=0; i<M; i++ ) {
+                cr[i] += Ar[M * k + i] * br - Ai[M * k + i] * bi;
+                ci[i] += Ar[M * k + i] * bi + Ai[M * k + i] * br;
+            }
+#else
+            for( i=0; i<M; i++ ) {
+                c[i] += A[lda * k + i] * b;
+            }
+#endif
+        }
+
+        for( i=0; i<M; i++ ) {
+#if defined(PRECISION_z) || defined(PRECISION_c)
+            C[i] = cr[i] + ci[i] * I;
+#else
+            C[i] = c[i];
+#endif
+        }
+    }
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Template of the fixed-size left triangular solve: B = op(A)^{-1} B
+ *
+ * The size N of the triangular matrix A is the compile-time dimension. op(A) is
+ * first copied in a tile with a fixed leading dimension, and its diagonal is
+ * inverted once for all the right hand sides.
+ *
+ *******************************************************************************/
+static pastix_always_inline void
+core_ztrsm_fixed( const pastix_int_t        N,
+                  pastix_uplo_t             uplo,
+                  pastix_trans_t            trans,
+                  pastix_diag_t             diag,
+                  pastix_int_t              nrhs,
+                  const pastix_complex64_t *A,
+                  pastix_int_t              lda,
+                  pastix_complex64_t       *B,
+                  pastix_int_t              ldb )
+{
+    pastix_complex64_t T[PASTIX_KERNEL_SMALL_MAX * PASTIX_KERNEL_SMALL_MAX];
+    pastix_complex64_t d[PASTIX_KERNEL_SMALL_MAX];
+    pastix_complex64_t x[PASTIX_KERNEL_SMALL_MAX];
+    pastix_complex64_t y[PASTIX_KERNEL_SMALL_MAX];
+    pastix_int_t i, k, r;
+    int lower;
+
+    /* Copy op(A) in a N -by- N tile */
+    if ( trans == PastixNoTrans ) {
+        for( k=0; k<N; k++ ) {
+            for( i=0; i<N; i++ ) {
+                T[N * k + i] = A[lda * k + i];
+            }
+        }
+        lower = ( uplo == PastixLower );
+    }
+    else {
+        for( k=0; k<N; k++ ) {
+            for( i=0; i<N; i++ ) {
+                T[N * k + i] = A[lda * i + k];
+            }
+        }
+#if defined(PRECISION_z) || defined(PRECISION_c)
+        if ( trans == PastixConjTrans ) {
+            for( i=0; i<N*N; i++ ) {
+                T[i] = conj( T[i] );
+            }
+        }
+#endif
+        lower = ( uplo == PastixUpper );
+    }
+
+    for( k=0; k<N; k++ ) {
+        d[k] = ( diag == PastixNonUnit ) ? 1.0 / T[N * k + k] : 1.0;
+    }
+
+    /* Solve two right hand sides at a time to interleave the two dependency chains */
+    for( r=0; r<nrhs-1; r+=2, B+=2*ldb ) {
+        for( i=0; i<N; i++ ) {
+            x[i] = B[i];
+            y[i] = B[ldb + i];
+        }
+
+        if ( lower ) {
+            for( k=0; k<N; k++ ) {
+                x[k] = core_zsmall_mul( x[k], d[k] );
+                y[k] = core_zsmall_mul( y[k], d[k] );
+                for( i=k+1; i<N; i++ ) {
+                    x[i] -= core_zsmall_mul( T[N * k + i], x[k] );
+                    y[i] -= core_zsmall_mul( T[N * k + i], y[k] );
+                }
+            }
+        }
+        else {
+            for( k=N-1; k>=0; k-- ) {
+                x[k] = core_zsmall_mul( x[k], d[k] );
+                y[k] = core_zsmall_mul( y[k], d[k] );
+                for( i=0; i<k; i++ ) {
+                    x[i] -= core_zsmall_mul( T[N * k + i], x[k] );
+                    y[i] -= core_zsmall_mul( T[N * k + i], y[k] );
+                }
+            }
+        }
+
+        for( i=0; i<N; i++ ) {
+            B[i]       = x[i];
+            B[ldb + i] = y[i];
+        }
+    }
+
+    if ( r < nrhs ) {
+        for( i=0; i<N; i++ ) {
+            x[i] = B[i];
+        }
+
+        if ( lower ) {
+            for( k=0; k<N; k++ ) {
+                x[k] = core_zsmall_mul( x[k], d[k] );
+                for( i=k+1; i<N; i++ ) {
+                    x[i] -= core_zsmall_mul( T[N * k + i], x[k] );
+                }
+            }
+        }
+        else {
+            for( k=N-1; k>=0; k-- ) {
+                x[k] = core_zsmall_mul( x[k], d[k] );
+                for( i=0; i<k; i++ ) {
+                    x[i] -= core_zsmall_mul( T[N * k + i], x[k] );
+                }
+            }
+        }
+
+        for( i=0; i<N; i++ ) {
+            B[i] = x[i];
+        }
+    }
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+/*
+ * Instances of the templates
+ */
+typedef void (*core_zgeadd_fixed_t)( pastix_trans_t, pastix_int_t,
+                                     pastix_complex64_t, const pastix_complex64_t *, pastix_int_t,
+                                     pastix_complex64_t, pastix_complex64_t *, pastix_int_t );
+typedef void (*core_zscalo_fixed_t)( pastix_trans_t, pastix_int_t,
+                                     const pastix_complex64_t *, pastix_int_t,
+                                     const pastix_complex64_t *, pastix_int_t,
+                                     pastix_complex64_t *, pastix_int_t );
+typedef void (*core_zgemdm_fixed_t)( pastix_trans_t, pastix_trans_t, pastix_int_t, pastix_int_t,
+                                     pastix_complex64_t, const pastix_complex64_t *, pastix_int_t,
+                                     const pastix_complex64_t *, pastix_int_t,
+                                     pastix_complex64_t, pastix_complex64_t *, pastix_int_t,
+                                     const pastix_complex64_t *, pastix_int_t );
+typedef void (*core_ztrsm_fixed_t)( pastix_uplo_t, pastix_trans_t, pastix_diag_t, pastix_int_t,
+                                    const pastix_complex64_t *, pastix_int_t,
+                                    pastix_complex64_t *, pastix_int_t );
+
+#define core_zgeadd_fixed_tpl( _n_ )                                    \
+    static pastix_target_clones void                                    \
+    core_zgeadd_fixed_##_n_( pastix_trans_t trans, pastix_int_t N,      \
+                             pastix_complex64_t alpha, const pastix_complex64_t *A, pastix_int_t lda, \
+                             pastix_complex64_t beta, pastix_complex64_t *B, pastix_int_t ldb ) \
+    {                                                                   \
+        core_zgeadd_fixed( _n_, trans, N, alpha, A, lda, beta, B, ldb ); \
+    }
+
+#define core_zscalo_fixed_tpl( _n_ )                                    \
+    static pastix_target_clones void                                    \
+    core_zscalo_fixed_##_n_( pastix_trans_t trans, pastix_int_t N,      \
+                             const pastix_complex64_t *A, pastix_int_t lda, \
+                             const pastix_complex64_t *D, pastix_int_t ldd, \
+                             pastix_complex64_t *B, pastix_int_t ldb )  \
+    {                                                                   \
+        core_zscalo_fixed( _n_, trans, N, A, lda, D, ldd, B, ldb );     \
+    }
+
+#define core_zgemdm_fixed_tpl( _n_ )                                    \
+    static pastix_target_clones void                                    \
+    core_zgemdm_fixed_##_n_( pastix_trans_t transA, pastix_trans_t transB, \
+                             pastix_int_t N, pastix_int_t K,            \
+                             pastix_complex64_t alpha, const pastix_complex64_t *A, pastix_int_t lda, \
+                             const pastix_complex64_t *B, pastix_int_t ldb, \
+                             pastix_complex64_t beta, pastix_complex64_t *C, pastix_int_t ldc, \
+                             const pastix_complex64_t *D, pastix_int_t incD ) \
+    {                                                                   \
+        core_zgemdm_fixed( _n_, transA, transB, N, K, alpha, A, lda,    \
+                           B, ldb, beta, C, ldc, D, incD );             \
+    }
+
+#define core_ztrsm_fixed_tpl( _n_ )                                     \
+    static pastix_target_clones void                                    \
+    core_ztrsm_fixed_##_n_( pastix_uplo_t uplo, pastix_trans_t trans,   \
+                            pastix_diag_t diag, pastix_int_t nrhs,      \
+                            const pastix_complex64_t *A, pastix_int_t lda, \
+                            pastix_complex64_t *B, pastix_int_t ldb )   \
+    {                                                                   \
+        core_ztrsm_fixed( _n_, uplo, trans, diag, nrhs, A, lda, B, ldb ); \
+    }
+
+core_zsmall_instantiate( core_zgeadd_fixed_tpl )
+core_zsmall_instantiate( core_zscalo_fixed_tpl )
+core_zsmall_instantiate( core_zgemdm_fixed_tpl )
+core_zsmall_instantiate( core_ztrsm_fixed_tpl )
+
+/*
+ * Dispatch tables, indexed by the compile-time dimension minus one
+ */
+#define core_zgeadd_fixed_entry( _n_ ) core_zgeadd_fixed_##_n_,
+#define core_zscalo_fixed_entry( _n_ ) core_zscalo_fixed_##_n_,
+#define core_zgemdm_fixed_entry( _n_ ) core_zgemdm_fixed_##_n_,
+#define core_ztrsm_fixed_entry( _n_ )  core_ztrsm_fixed_##_n_,
+
+static const core_zgeadd_fixed_t core_zgeadd_fixed_tab[PASTIX_KERNEL_SMALL_MAX] = {
+    core_zsmall_instantiate( core_zgeadd_fixed_entry )
+};
+static const core_zscalo_fixed_t core_zscalo_fixed_tab[PASTIX_KERNEL_SMALL_MAX] = {
+    core_zsmall_instantiate( core_zscalo_fixed_entry )
+};
+static const core_zgemdm_fixed_t core_zgemdm_fixed_tab[PASTIX_KERNEL_SMALL_MAX] = {
+    core_zsmall_instantiate( core_zgemdm_fixed_entry )
+};
+static const core_ztrsm_fixed_t core_ztrsm_fixed_tab[PASTIX_KERNEL_SMALL_MAX] = {
+    core_zsmall_instantiate( core_ztrsm_fixed_entry )
+};
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+/**
+ *******************************************************************************
+ *
+ * @brief Dispatch core_zgeadd() to its fixed-size variant when the block is
+ * small enough.
+ *
+ *******************************************************************************
+ *
+ * See core_zgeadd() for the parameters.
+ *
+ *******************************************************************************
+ *
+ * @retval PASTIX_SUCCESS if the operation has been performed.
+ * @retval PASTIX_ERR_NOTIMPLEMENTED if the block is too large, and the generic
+ *         kernel must be used.
+ *
+ *******************************************************************************/
+int
+core_zgeadd_small( pastix_trans_t            trans,
+                   pastix_int_t              M,
+                   pastix_int_t              N,
+                   pastix_complex64_t        alpha,
+                   const pastix_complex64_t *A,
+                   pastix_int_t              lda,
+                   pastix_complex64_t        beta,
+                   pastix_complex64_t       *B,
+                   pastix_int_t              ldb )
+{
+    pastix_int_t max = core_zsmall_threshold( PastixKernelSmallGEADD );
+
+    if ( (M < 1) || (M > max) || (N > max) || (alpha == 0.0) ) {
+        return PASTIX_ERR_NOTIMPLEMENTED;
+    }
+
+    core_zgeadd_fixed_tab[M-1]( trans, N, alpha, A, lda, beta, B, ldb );
+    return PASTIX_SUCCESS;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Dispatch core_zscalo() to its fixed-size variant when the block is
+ * small enough.
+ *
+ *******************************************************************************
+ *
+ * See core_zscalo() for the parameters.
+ *
+ *******************************************************************************
+ *
+ * @retval PASTIX_SUCCESS if the operation has been performed.
+ * @retval PASTIX_ERR_NOTIMPLEMENTED if the block is too large, and the generic
+ *         kernel must be used.
+ *
+ *******************************************************************************/
+int
+core_zscalo_small( pastix_trans_t            trans,
+                   pastix_int_t              M,
+                   pastix_int_t              N,
+                   const pastix_complex64_t *A,
+                   pastix_int_t              lda,
+                   const pastix_complex64_t *D,
+                   pastix_int_t              ldd,
+                   pastix_complex64_t       *B,
+                   pastix_int_t              ldb )
+{
+    pastix_int_t max = core_zsmall_threshold( PastixKernelSmallSCALO );
+
+    if ( (M < 1) || (M > max) || (N > max) ) {
+        return PASTIX_ERR_NOTIMPLEMENTED;
+    }
+
+    core_zscalo_fixed_tab[M-1]( trans, N, A, lda, D, ldd, B, ldb );
+    return PASTIX_SUCCESS;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Dispatch core_zgemdm() to its fixed-size variant when the block is
+ * small enough.
+ *
+ *******************************************************************************
+ *
+ * See core_zgemdm() for the parameters.
+ *
+ *******************************************************************************
+ *
+ * @retval PASTIX_SUCCESS if the operation has been performed.
+ * @retval PASTIX_ERR_NOTIMPLEMENTED if the block is too large, and the generic
+ *         kernel must be used.
+ *
+ *******************************************************************************/
+int
+core_zgemdm_small( pastix_trans_t            transA,
+                   pastix_trans_t            transB,
+                   pastix_int_t              M,
+                   pastix_int_t              N,
+                   pastix_int_t              K,
+                   pastix_complex64_t        alpha,
+                   const pastix_complex64_t *A,
+                   pastix_int_t              lda,
+                   const pastix_complex64_t *B,
+                   pastix_int_t              ldb,
+                   pastix_complex64_t        beta,
+                   pastix_complex64_t       *C,
+                   pastix_int_t              ldc,
+                   const pastix_complex64_t *D,
+                   pastix_int_t              incD )
+{
+    pastix_int_t max = core_zsmall_threshold( PastixKernelSmallGEMDM );
+
+    if ( (M < 1) || (M > max) || (N > max) || (K > max) ) {
+        return PASTIX_ERR_NOTIMPLEMENTED;
+    }
+
+    core_zgemdm_fixed_tab[M-1]( transA, transB, N, K,
+                                alpha, A, lda, B, ldb,
+                                beta,  C, ldc, D, incD );
+    return PASTIX_SUCCESS;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Dispatch the gemm C = beta * C + alpha * op(A) * op(B) of the solve
+ * to its fixed-size variant when the block is small enough.
+ *
+ * The number of columns N of C, i.e. the number of right hand sides, is not
+ * limited.
+ *
+ *******************************************************************************
+ *
+ * See core_zgemdm() for the parameters.
+ *
+ *******************************************************************************
+ *
+ * @retval PASTIX_SUCCESS if the operation has been performed.
+ * @retval PASTIX_ERR_NOTIMPLEMENTED if the block is too large, and the generic
+ *         kernel must be used.
+ *
+ *******************************************************************************/
+int
+core_zgemm_small( pastix_trans_t            transA,
+                  pastix_trans_t            transB,
+                  pastix_int_t              M,
+                  pastix_int_t              N,
+                  pastix_int_t              K,
+                  pastix_complex64_t        alpha,
+                  const pastix_complex64_t *A,
+                  pastix_int_t              lda,
+                  const pastix_complex64_t *B,
+                  pastix_int_t              ldb,
+                  pastix_complex64_t        beta,
+                  pastix_complex64_t       *C,
+                  pastix_int_t              ldc )
+{
+    pastix_int_t max = core_zsmall_threshold( PastixKernelSmallGEMM );
+
+    if ( (M < 1) || (M > max) || (K > max) ) {
+        return PASTIX_ERR_NOTIMPLEMENTED;
+    }
+
+    core_zgemdm_fixed_tab[M-1]( transA, transB, N, K,
+                                alpha, A, lda, B, ldb,
+                                beta,  C, ldc, NULL, 0 );
+    return PASTIX_SUCCESS;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Dispatch the left triangular solve B = op(A)^{-1} B to its fixed-size
+ * variant when the triangular matrix is small enough.
+ *
+ * The number of right hand sides is not limited.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          Specify whether the A matrix is upper or lower triangular.
+ *
+ * @param[in] trans
+ *          Specify the transposition used for the A matrix.
+ *
+ * @param[in] diag
+ *          Specify if the A matrix is unit triangular.
+ *
+ * @param[in] N
+ *          The size of the matrix A.
+ *
+ * @param[in] nrhs
+ *          The number of columns of B.
+ *
+ * @param[in] A
+ *          The triangular matrix A of size lda -by- N.
+ *
+ * @param[in] lda
+ *          The leading dimension of A.
+ *
+ * @param[inout] B
+ *          The matrix B of size ldb -by- nrhs.
+ *
+ * @param[in] ldb
+ *          The leading dimension of B.
+ *
+ *******************************************************************************
+ *
+ * @retval PASTIX_SUCCESS if the operation has been performed.
+ * @retval PASTIX_ERR_NOTIMPLEMENTED if the matrix is too large, and the generic
+ *         kernel must be used.
+ *
+ *******************************************************************************/
+int
+core_ztrsm_small( pastix_uplo_t             uplo,
+                  pastix_trans_t            trans,
+                  pastix_diag_t             diag,
+                  pastix_int_t              N,
+                  pastix_int_t              nrhs,
+                  const pastix_complex64_t *A,
+                  pastix_int_t              lda,
+                  pastix_complex64_t       *B,
+                  pastix_int_t              ldb )
+{
+    if ( (N < 1) || (N > core_zsmall_threshold( PastixKernelSmallTRSM )) ) {
+        return PASTIX_ERR_NOTIMPLEMENTED;
+    }
+
+    core_ztrsm_fixed_tab[N-1]( uplo, trans, diag, nrhs, A, lda, B, ldb );
+    return PASTIX_SUCCESS;
+}
@@ -75,23 +75,11 @@ core_zsytf2sp( pastix_int_t        n,
 
     m = n-1;
     for (k=0; k<n; k++, m--){
-        if ( cabs(*Akk) < criterion ) {
-            if ( creal(*Akk) < 0. ) {
-                *Akk = (pastix_complex64_t)(-criterion);
-            }
-            else {
-                *Akk = (pastix_complex64_t)criterion;
-            }
-            (*nbpivots)++;
-        }
-
-        alpha = 1.0 / (*Akk);
-
         /* Transpose the column before scaling */
         cblas_zcopy( m, Amk, 1, Akm, lda );
 
         /* Scale the diagonal to compute L((k+1):n,k) */
-        cblas_zscal(m, CBLAS_SADDR( alpha ), Amk, 1 );
+        (*nbpivots) += core_zscalpiv( m, Akk, Amk, criterion, 0 );
 
         alpha = -(*Akk);
 
@@ -115,6 +103,11 @@ core_zsytf2sp( pastix_int_t        n,
  * @brief Compute the block static pivoting factorization of the symmetric
  * matrix n-by-n A such that A = L * D * L^t.
  *
+ * The matrix is recursively split in two halves, such that most of the
+ * computations are performed by level-3 kernels whatever the size of the
+ * diagonal block. Blocks of at most MAXSIZEOFBLOCKS columns are factorized by
+ * the level-2 kernel, which applies the static pivoting.
+ *
  *******************************************************************************
  *
  * @param[in] n
@@ -144,63 +137,54 @@ core_zsytrfsp( pastix_int_t        n,
                pastix_int_t       *nbpivots,
                double              criterion )
 {
-    pastix_int_t k, blocknbr, blocksize, matrixsize, col;
-    pastix_complex64_t *Akk, *Amk, *Akm, *Amm;
+    pastix_int_t n1, n2, col;
+    pastix_complex64_t *A12, *A21, *A22;
     pastix_complex64_t alpha;
 
-    /* diagonal supernode is divided into MAXSIZEOFBLOCK-by-MAXSIZEOFBLOCKS blocks */
-    blocknbr = pastix_iceil( n, MAXSIZEOFBLOCKS );
-
-    for (k=0; k<blocknbr; k++) {
-
-        blocksize = pastix_imin(MAXSIZEOFBLOCKS, n-k*MAXSIZEOFBLOCKS);
-        Akk = A+(k*MAXSIZEOFBLOCKS)*(lda+1); /* Lk,  k   */
-        Amk = Akk + blocksize;               /* Lk+1,k   */
-        Akm = Akk + blocksize * lda;         /* Lk,  k+1 */
-        Amm = Amk + blocksize * lda;         /* Lk+1,k+1 */
-
-        /* Factorize the diagonal block Akk*/
-        core_zsytf2sp(blocksize, Akk, lda, nbpivots, criterion);
-
-        if ((k*MAXSIZEOFBLOCKS+blocksize) < n) {
-
-            matrixsize = n-(k*MAXSIZEOFBLOCKS+blocksize);
-
-            /*
-             * Solve the lower rectangle below the diagonal block
-             *      L(k+1:n,k) = (L(k,k) D(k,k))^{-1} A(k+1:n,k)
-             */
-            /* 1) Compute A(k+1:n,k) = A(k+1:n,k)L(k,k)^{-T} = D(k,k)L(k+1:n,k) */
-                        /* input: L(k,k) in tmp, A(k+1:n,k) in tmp1   */
-                        /* output: A(k+1:n,k) in tmp1                 */
-            cblas_ztrsm(CblasColMajor,
-                        CblasRight, CblasLower,
-                        CblasTrans, CblasUnit,
-                        matrixsize, blocksize,
-                        CBLAS_SADDR(zone), Akk, lda,
-                                           Amk, lda);
-
-            /* Compute L(k+1:n,k) = A(k+1:n,k)D(k,k)^{-1}     */
-            for(col = 0; col < blocksize; col++) {
-                /* copy L(k+1+col:n,k+col)*D(k+col,k+col) into work(:,col) */
-                cblas_zcopy(matrixsize, Amk + col*lda, 1,
-                                        Akm + col,     lda);
-
-                /* compute L(k+1+col:n,k+col) = A(k+1+col:n,k+col)D(k+col,k+col)^{-1} */
-                alpha = 1.0 / *(Akk + col*(lda+1));
-                cblas_zscal( matrixsize, CBLAS_SADDR(alpha),
-                             Amk + col*lda, 1 );
-            }
-
-            /* Update A(k+1:n,k+1:n) = A(k+1:n,k+1:n) - (L(k+1:n,k)*D(k,k))*L(k+1:n,k)^T */
-            cblas_zgemm(CblasColMajor,
-                        CblasNoTrans, CblasNoTrans,
-                        matrixsize, matrixsize, blocksize,
-                        CBLAS_SADDR(mzone), Amk, lda,
-                                            Akm, lda,
-                        CBLAS_SADDR(zone),  Amm, lda);
-        }
+    /* Factorize the small diagonal blocks with the level-2 kernel */
+    if ( n <= MAXSIZEOFBLOCKS ) {
+        core_zsytf2sp( n, A, lda, nbpivots, criterion );
+        return;
+    }
+
+    /* Split the block such that the first part is a multiple of the block size */
+    n1 = MAXSIZEOFBLOCKS * pastix_iceil( n / 2, MAXSIZEOFBLOCKS );
+    n2 = n - n1;
+    A21 = A   + n1;
+    A12 = A   + n1 * lda;
+    A22 = A12 + n1;
+
+    /* Factorize A11 = L11 D11 L11^t */
+    core_zsytrfsp( n1, A, lda, nbpivots, criterion );
+
+    /* Compute A21 = A21 L11^{-T} = L21 D11 */
+    cblas_ztrsm(CblasColMajor,
+                CblasRight, CblasLower,
+                CblasTrans, CblasUnit,
+                n2, n1,
+                CBLAS_SADDR(zone), A,   lda,
+                                   A21, lda);
+
+    /* Compute L21 = A21 D11^{-1}, and store (L21 D11)^t in A12 */
+    for(col = 0; col < n1; col++) {
+        cblas_zcopy(n2, A21 + col*lda, 1,
+                        A12 + col,     lda);
+
+        alpha = 1.0 / *(A + col*(lda+1));
+        cblas_zscal( n2, CBLAS_SADDR(alpha),
+                     A21 + col*lda, 1 );
     }
+
+    /* Update A22 = A22 - L21 * (D11 L21^t) */
+    cblas_zgemm(CblasColMajor,
+                CblasNoTrans, CblasNoTrans,
+                n2, n2, n1,
+                CBLAS_SADDR(mzone), A21, lda,
+                                    A12, lda,
+                CBLAS_SADDR(zone),  A22, lda);
+
+    /* Factorize A22 = L22 D22 L22^t */
+    core_zsytrfsp( n2, A22, lda, nbpivots, criterion );
 }
 
 /**
@@ -271,6 +255,9 @@ cpucblk_zsytrfsp1d_sytrf( SolverMatrix *solvmtx,
 
     kernel_trace_stop( cblk->fblokptr->inlast, PastixKernelSYTRF, ncols, 0, 0, flops, time );
 
+    if ( solvmtx->cblkpivots != NULL ) {
+        solvmtx->cblkpivots[ cblk - solvmtx->cblktab ] = nbpivots;
+    }
     if ( nbpivots ) {
         pastix_atomic_add_32b( &(solvmtx->nbpivots), nbpivots );
     }
@@ -280,8 +267,17 @@ cpucblk_zsytrfsp1d_sytrf( SolverMatrix *solvmtx,
 /**
  *******************************************************************************
  *
- * core_zsytrfsp1d_gemm - Computes the LDL^t factorization of one panel and
- * apply all the trsm updates to this panel.
+ * @brief Compute the updates generated by one off-diagonal block of a panel of
+ * the LDL^t factorization.
+ *
+ * The block B facing fcblk is scaled once by the diagonal D of the panel in the
+ * work buffer. This N-by-K product is then shared by the GEMMs of all the
+ * blocks A below B, that are applied directly to the facing blocks of fcblk:
+ * C = C - A * (B * D)^t. Neither A nor the panel are copied, and the small
+ * blocks are handled by the fixed-size kernels.
+ *
+ * The panel and fcblk can be stored either in 1D or in 2D, but must be in full
+ * rank.
  *
  *******************************************************************************
  *
@@ -308,7 +304,8 @@ cpucblk_zsytrfsp1d_sytrf( SolverMatrix *solvmtx,
  *          target.
  *
  * @param[inout] work
- *          Temporary buffer used in core_zgemdm().
+ *          Temporary buffer of size at least blok_rownbr( blok ) -by-
+ *          cblk_colnbr( cblk ) to store the block scaled by D.
  *
  *******************************************************************************/
 void core_zsytrfsp1d_gemm( const SolverCblk         *cblk,
@@ -319,7 +316,7 @@ void core_zsytrfsp1d_gemm( const SolverCblk         *cblk,
                            pastix_complex64_t       *work )
 {
     const SolverBlok *iterblok;
-    const SolverBlok *fblok;
+    SolverBlok       *fblok;
     const SolverBlok *lblok;
     const pastix_complex64_t *blokA;
     const pastix_complex64_t *blokB;
@@ -344,6 +341,9 @@ void core_zsytrfsp1d_gemm( const SolverCblk         *cblk,
         ldd = cblk->stride + 1;
     }
 
+    /* Scale the B block by D once for all the blocks below */
+    core_zscalo( PastixNoTrans, N, K, blokB, ldb, blokD, ldd, work, N );
+
     /*
      * Add contribution to C in fcblk:
      *    Get the first facing block of the distant panel, and the last block of
@@ -373,25 +373,19 @@ void core_zsytrfsp1d_gemm( const SolverCblk         *cblk,
             + iterblok->frownum - fblok->frownum
             + (blok->frownum - fcblk->fcolnum) * ldc;
 
-        {
-            pastix_int_t ldw;
-            int ret;
-
-            /* Compute ldw which should never be larger than SOLVE_COEFMAX */
-            ldw = (M+1) * K;
-
-            pastix_cblk_lock( fcblk );
-            ret = core_zgemdm( PastixNoTrans, PastixConjTrans,
-                               M, N, K,
+        pastix_blok_lock( fblok );
+        if ( core_zgemm_small( PastixNoTrans, PastixTrans, M, N, K,
                                -1.0, blokA, lda,
-                                    blokB, ldb,
-                                1.0, blokC, ldc,
-                                    blokD, ldd,
-                               work, ldw );
-            pastix_cblk_unlock( fcblk );
-            assert(ret == PASTIX_SUCCESS);
-            (void)ret;
+                                     work,  N,
+                                1.0, blokC, ldc ) != PASTIX_SUCCESS )
+        {
+            cblas_zgemm( CblasColMajor, CblasNoTrans, CblasTrans,
+                         M, N, K,
+                         CBLAS_SADDR(mzone), blokA, lda,
+                                             work,  N,
+                         CBLAS_SADDR(zone),  blokC, ldc );
         }
+        pastix_blok_unlock( fblok );
     }
 }
 
@@ -435,9 +429,9 @@ cpucblk_zsytrfsp1d_panel( SolverMatrix *solvmtx,
     /*
      * We exploit the fact that (DL^t) is stored in the upper triangle part of L
      */
-    cpucblk_ztrsmsp( PastixRight, PastixUpper,
-                     PastixNoTrans, PastixNonUnit,
-                     cblk, L, L, &(solvmtx->lowrank) );
+    cpucblk_ztrsmsp_team( solvmtx, PastixRight, PastixUpper,
+                          PastixNoTrans, PastixNonUnit,
+                          cblk, L, L );
 
     if ( (DLt != NULL) && (cblk->cblktype & CBLK_LAYOUT_2D) ) {
 
@@ -448,6 +442,50 @@ cpucblk_zsytrfsp1d_panel( SolverMatrix *solvmtx,
 }
 
 
+/**
+ *******************************************************************************
+ *
+ * @brief Check if the updates of a panel of the LDL^t factorization need the
+ * copy of the panel scaled by D.
+ *
+ * The copy, also called the two-terms algorithm, is only required by the
+ * low-rank kernels, i.e. when the panel is compressed or when one of the
+ * updated cblks is compressed. The 1D panels never use it.
+ *
+ *******************************************************************************
+ *
+ * @param[in] solvmtx
+ *          Solver Matrix structure of the problem
+ *
+ * @param[in] cblk
+ *          The panel that emits the updates.
+ *
+ *******************************************************************************
+ *
+ * @return 1 if the scaled copy of the panel is required, 0 otherwise.
+ *
+ *******************************************************************************/
+static inline int
+core_zsytrfsp1d_twoterms( const SolverMatrix *solvmtx,
+                          const SolverCblk   *cblk )
+{
+    const SolverBlok *blok  = cblk->fblokptr + 1;
+    const SolverBlok *lblok = cblk[1].fblokptr;
+
+    if ( !(cblk->cblktype & CBLK_LAYOUT_2D) ) {
+        return 0;
+    }
+    if ( cblk->cblktype & CBLK_COMPRESSED ) {
+        return 1;
+    }
+    for( ; blok < lblok; blok++ ) {
+        if ( solvmtx->cblktab[ blok->fcblknm ].cblktype & CBLK_COMPRESSED ) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
 /**
  *******************************************************************************
  *
@@ -491,7 +529,12 @@ cpucblk_zsytrfsp1d( SolverMatrix       *solvmtx,
     SolverBlok  *blok, *lblk;
     pastix_int_t nbpivots;
 
-    if ( !(cblk->cblktype & CBLK_LAYOUT_2D) ) {
+    /*
+     * The panel is scaled by D in the DLt buffer only when it is compressed, or
+     * when it contributes to a compressed cblk. Otherwise, each update only
+     * scales the block facing the updated cblk (see core_zsytrfsp1d_gemm()).
+     */
+    if ( !core_zsytrfsp1d_twoterms( solvmtx, cblk ) ) {
         DLt = NULL;
     }
     else {
@@ -278,7 +278,7 @@ core_ztrsmsp_lr( pastix_side_t           side,
              */
             if ( lowrank->compress_preselect || (!is_preselected) )
             {
-                flops_lr = cpublok_zcompress( lowrank, M, N, lrC );
+                flops_lr = cpublok_zcompress( lowrank, blok, M, N, lrC );
             }
         }
 
@@ -398,6 +398,217 @@ cpucblk_ztrsmsp( pastix_side_t      side,
     }
 }
 
+/**
+ * @brief Arguments of the team items of cpucblk_ztrsmsp_team()
+ */
+struct cpucblk_ztrsmsp_team_s {
+    pastix_side_t     side;  /**< The side of the TRSM                      */
+    pastix_uplo_t     uplo;  /**< The part of the diagonal block referenced */
+    pastix_trans_t    trans; /**< The transposition of the diagonal block   */
+    pastix_diag_t     diag;  /**< The unit or non-unit diagonal             */
+    const SolverCblk *cblk;  /**< The compressed column block               */
+    const void       *A;     /**< The low-rank blocks of the diagonal       */
+    void             *C;     /**< The low-rank blocks to update             */
+};
+
+/**
+ *******************************************************************************
+ *
+ * @brief Compress and solve the set of off-diagonal blocks facing the same cblk
+ * that starts at the given block.
+ *
+ * Team item of cpucblk_ztrsmsp_team(). The items that are not the first block
+ * of their set return immediately.
+ *
+ *******************************************************************************/
+static void
+cpucblk_ztrsmsp_team_item( SolverMatrix *solvmtx,
+                           void         *args,
+                           pastix_int_t  item,
+                           void         *work,
+                           pastix_int_t  lwork )
+{
+    struct cpucblk_ztrsmsp_team_s *arg = (struct cpucblk_ztrsmsp_team_s *)args;
+    const SolverBlok *blok = arg->cblk->fblokptr + 1 + item;
+
+    if ( (item > 0) && (blok[-1].fcblknm == blok->fcblknm) ) {
+        return;
+    }
+
+    cpublok_ztrsmsp( arg->side, arg->uplo, arg->trans, arg->diag,
+                     arg->cblk, 1 + item, arg->A,
+                     ((pastix_lrblock_t *)(arg->C)) + 1 + item,
+                     &(solvmtx->lowrank) );
+
+    (void)work;
+    (void)lwork;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Compute the updates associated to a column of off-diagonal blocks,
+ * with the help of the idle threads for the large compressed cblks.
+ *
+ * If the cblk is compressed and has at least
+ * solvmtx->lowrank.compress_team_bloknbr off-diagonal blocks, the compression
+ * and the TRSM of each set of blocks facing the same cblk are distributed over
+ * the threads that join the team (see solverTeamRun()). Otherwise, this is
+ * cpucblk_ztrsmsp().
+ *
+ *******************************************************************************
+ *
+ * @param[inout] solvmtx
+ *          The pointer to the solver matrix structure.
+ *
+ * @param[in] side
+ *          Specify whether the A matrix appears on the left or right in the
+ *          equation. It has to be either PastixLeft or PastixRight.
+ *
+ * @param[in] uplo
+ *          Specify whether the A matrix is upper or lower triangular. It has to
+ *          be either PastixUpper or PastixLower.
+ *
+ * @param[in] trans
+ *          Specify the transposition used for the A matrix. It has to be either
+ *          PastixTrans or PastixConjTrans.
+ *
+ * @param[in] diag
+ *          Specify if the A matrix is unit triangular. It has to be either
+ *          PastixUnit or PastixNonUnit.
+ *
+ * @param[in] cblk
+ *          The cblk structure to which block belongs to. The A and B pointers
+ *          must be the coeftab of this column block.
+ *          Next column blok must be accessible through cblk[1].
+ *
+ * @param[in] A
+ *          The pointer to the correct representation of A.
+ *          - coeftab if the block is in full rank. Must be of size cblk.stride -by- cblk.width.
+ *          - pastix_lr_block if the block is compressed.
+ *
+ * @param[inout] C
+ *          The pointer to the correct representation of C.
+ *          - coeftab if the block is in full rank. Must be of size cblk.stride -by- cblk.width.
+ *          - pastix_lr_block if the block is compressed.
+ *
+ *******************************************************************************/
+void
+cpucblk_ztrsmsp_team( SolverMatrix     *solvmtx,
+                      pastix_side_t     side,
+                      pastix_uplo_t     uplo,
+                      pastix_trans_t    trans,
+                      pastix_diag_t     diag,
+                      const SolverCblk *cblk,
+                      const void       *A,
+                      void             *C )
+{
+    pastix_int_t nbblok = cblk[1].fblokptr - cblk[0].fblokptr - 1;
+    struct cpucblk_ztrsmsp_team_s args;
+
+    if ( !(cblk->cblktype & CBLK_COMPRESSED) ||
+         (solvmtx->lowrank.compress_team_bloknbr <= 0) ||
+         (nbblok < solvmtx->lowrank.compress_team_bloknbr) )
+    {
+        cpucblk_ztrsmsp( side, uplo, trans, diag,
+                         cblk, A, C, &(solvmtx->lowrank) );
+        return;
+    }
+
+    args.side  = side;
+    args.uplo  = uplo;
+    args.trans = trans;
+    args.diag  = diag;
+    args.cblk  = cblk;
+    args.A     = A;
+    args.C     = C;
+
+    solverTeamRun( solvmtx, cpucblk_ztrsmsp_team_item, &args, nbblok, NULL, 0 );
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Compute the updates associated to a set of rows of the off-diagonal
+ * blocks of a cblk stored in 1D.
+ *
+ * This is used to split the TRSM of a large panel among several threads.
+ *
+ *******************************************************************************
+ *
+ * @param[in] side
+ *          Specify whether the A matrix appears on the left or right in the
+ *          equation. It has to be either PastixLeft or PastixRight.
+ *
+ * @param[in] uplo
+ *          Specify whether the A matrix is upper or lower triangular. It has to
+ *          be either PastixUpper or PastixLower.
+ *
+ * @param[in] trans
+ *          Specify the transposition used for the A matrix. It has to be either
+ *          PastixTrans or PastixConjTrans.
+ *
+ * @param[in] diag
+ *          Specify if the A matrix is unit triangular. It has to be either
+ *          PastixUnit or PastixNonUnit.
+ *
+ * @param[in] cblk
+ *          The cblk structure to which block belongs to. The A and C pointers
+ *          must be the coeftab of this column block. It must be stored in 1D
+ *          and in full rank.
+ *          Next column blok must be accessible through cblk[1].
+ *
+ * @param[in] A
+ *          The pointer to the coeftab of the cblk.
+ *
+ * @param[inout] C
+ *          The pointer to the coeftab of the cblk.
+ *
+ * @param[in] fstrow
+ *          The index of the first row to update, starting from the first row of
+ *          the first off-diagonal block.
+ *
+ * @param[in] nbrows
+ *          The number of rows to update.
+ *
+ *******************************************************************************/
+void
+cpucblk_ztrsmsp_rows( pastix_side_t             side,
+                      pastix_uplo_t             uplo,
+                      pastix_trans_t            trans,
+                      pastix_diag_t             diag,
+                      const SolverCblk         *cblk,
+                      const pastix_complex64_t *A,
+                      pastix_complex64_t       *C,
+                      pastix_int_t              fstrow,
+                      pastix_int_t              nbrows )
+{
+    pastix_fixdbl_t time, flops;
+    pastix_int_t n   = cblk_colnbr( cblk );
+    pastix_int_t lda = cblk->stride;
+
+    assert( !(cblk->cblktype & (CBLK_LAYOUT_2D | CBLK_COMPRESSED)) );
+    assert( (fstrow >= 0) && (fstrow + nbrows <= lda - n) );
+
+    if ( nbrows <= 0 ) {
+        return;
+    }
+
+    time  = kernel_trace_start( PastixKernelTRSMCblk1d );
+    flops = FLOPS_ZTRSM( side, nbrows, n );
+
+    /* The diagonal block is stored first, such that the off-diagonal rows start at n */
+    kernel_trace_start_lvl2( PastixKernelLvl2_FR_TRSM );
+    cblas_ztrsm( CblasColMajor,
+                 (CBLAS_SIDE)side, (CBLAS_UPLO)uplo, (CBLAS_TRANSPOSE)trans, (CBLAS_DIAG)diag,
+                 nbrows, n,
+                 CBLAS_SADDR(zone), A, lda,
+                                    C + n + fstrow, lda );
+    kernel_trace_stop_lvl2( flops );
+
+    kernel_trace_stop( cblk->fblokptr->inlast, PastixKernelTRSMCblk1d, nbrows, n, 0, flops, time );
+}
+
 /**
  *******************************************************************************
  *
@@ -601,7 +812,7 @@ core_ztrsmsp_lrsub( pastix_side_t           side,
              */
             if ( lowrank->compress_preselect || (!is_preselected) )
             {
-                flops = cpublok_zcompress( lowrank, M, N, lrC );
+                flops = cpublok_zcompress( lowrank, blok, M, N, lrC );
             }
         }
 
@@ -58,7 +58,7 @@ core_zfrfr2fr( core_zlrmm_t *params )
     Cptr  = C->u;
     Cptr += ldcu * offy + offx;
 
-    pastix_atomic_lock( lock );
+    kernels_lock( lock );
     assert( C->rk == -1 ); /* Check that C has not changed due to parallelism */
 
     /*
@@ -121,7 +121,7 @@ core_zfrlr2fr( core_zlrmm_t *params )
      */
     if ( flops1 <= flops2 ) {
         if ( (work = core_zlrmm_getws( params, M * B->rk )) == NULL ) {
-            work = malloc( M * B->rk * sizeof(pastix_complex64_t) );
+            work = pastix_lrmem_malloc( M * B->rk * sizeof(pastix_complex64_t) );
             allocated = 1;
         }
 
@@ -134,7 +134,7 @@ core_zfrlr2fr( core_zlrmm_t *params )
                                          B->v, ldbv,
                      CBLAS_SADDR(zzero), work, M );
 
-        pastix_atomic_lock( lock );
+        kernels_lock( lock );
         assert( C->rk == -1 ); /* Check that C has not changed due to parallelism */
         cblas_zgemm( CblasColMajor, CblasNoTrans, (CBLAS_TRANSPOSE)transB,
                      M, N, B->rk,
@@ -146,7 +146,7 @@ core_zfrlr2fr( core_zlrmm_t *params )
     }
     else {
         if ( (work = core_zlrmm_getws( params, K * N )) == NULL ) {
-            work = malloc( K * N * sizeof(pastix_complex64_t) );
+            work = pastix_lrmem_malloc( K * N * sizeof(pastix_complex64_t) );
             allocated = 1;
         }
 
@@ -159,7 +159,7 @@ core_zfrlr2fr( core_zlrmm_t *params )
                                          B->v, ldbv,
                      CBLAS_SADDR(zzero), work, K );
 
-        pastix_atomic_lock( lock );
+        kernels_lock( lock );
         assert( C->rk == -1 ); /* Check that C has not changed due to parallelism */
         cblas_zgemm( CblasColMajor, (CBLAS_TRANSPOSE)transA, (CBLAS_TRANSPOSE)transB,
                      M, N, K,
@@ -172,7 +172,7 @@ core_zfrlr2fr( core_zlrmm_t *params )
     }
 
     if ( allocated ) {
-        free( work );
+        pastix_lrmem_free( work );
     }
     PASTE_CORE_ZLRMM_VOID;
     return flops;
@@ -222,7 +222,7 @@ core_zlrfr2fr( core_zlrmm_t *params )
      */
     if ( flops1 <= flops2 ) {
         if ( (work = core_zlrmm_getws( params, A->rk * N )) == NULL ) {
-            work = malloc( A->rk * N * sizeof(pastix_complex64_t) );
+            work = pastix_lrmem_malloc( A->rk * N * sizeof(pastix_complex64_t) );
             allocated = 1;
         }
 
@@ -235,7 +235,7 @@ core_zlrfr2fr( core_zlrmm_t *params )
                                          B->u, ldbu,
                      CBLAS_SADDR(zzero), work, A->rk );
 
-        pastix_atomic_lock( lock );
+        kernels_lock( lock );
         assert( C->rk == -1 ); /* Check that C has not changed due to parallelism */
         cblas_zgemm( CblasColMajor, CblasNoTrans, CblasNoTrans,
                      M, N, A->rk,
@@ -248,7 +248,7 @@ core_zlrfr2fr( core_zlrmm_t *params )
     }
     else {
         if ( (work = core_zlrmm_getws( params, M * K )) == NULL ) {
-            work = malloc( M * K * sizeof(pastix_complex64_t) );
+            work = pastix_lrmem_malloc( M * K * sizeof(pastix_complex64_t) );
             allocated = 1;
         }
 
@@ -261,7 +261,7 @@ core_zlrfr2fr( core_zlrmm_t *params )
                                          A->v, ldav,
                      CBLAS_SADDR(zzero), work, M );
 
-        pastix_atomic_lock( lock );
+        kernels_lock( lock );
         assert( C->rk == -1 ); /* Check that C has not changed due to parallelism */
         cblas_zgemm( CblasColMajor, (CBLAS_TRANSPOSE)transA, (CBLAS_TRANSPOSE)transB,
                      M, N, K,
@@ -274,7 +274,7 @@ core_zlrfr2fr( core_zlrmm_t *params )
     }
 
     if ( allocated ) {
-        free( work );
+        pastix_lrmem_free( work );
     }
     PASTE_CORE_ZLRMM_VOID;
     return flops;
@@ -326,7 +326,7 @@ core_zlrlr2fr( core_zlrmm_t *params )
     if ( AB.rk > 0 ) {
         pastix_int_t ldabv = (trans == PastixNoTrans) ? AB.rkmax : N;
 
-        pastix_atomic_lock( lock );
+        kernels_lock( lock );
         assert( C->rk == -1 ); /* Check that C has not changed due to parallelism */
 
         cblas_zgemm( CblasColMajor, CblasNoTrans, (CBLAS_TRANSPOSE)trans,
@@ -340,10 +340,10 @@ core_zlrlr2fr( core_zlrmm_t *params )
 
     /* Free memory from zlrm3 */
     if ( infomask & PASTIX_LRM3_ALLOCU ) {
-        free(AB.u);
+        pastix_lrmem_free(AB.u);
     }
     if ( infomask & PASTIX_LRM3_ALLOCV ) {
-        free(AB.v);
+        pastix_lrmem_free(AB.v);
     }
 
     PASTE_CORE_ZLRMM_VOID;
@@ -94,7 +94,7 @@ core_zfrfr2lr( core_zlrmm_t     *params,
          * pastix_imin( M, N )
          */
         if ( (work = core_zlrmm_getws( params, M * N )) == NULL ) {
-            work = malloc( M * N * sizeof(pastix_complex64_t) );
+            work = pastix_lrmem_malloc( M * N * sizeof(pastix_complex64_t) );
             *infomask |= PASTIX_LRM3_ALLOCU;
         }
         AB->rk = -1;
@@ -180,7 +180,7 @@ core_zfrlr2lr( core_zlrmm_t     *params,
 
         if ( flops1 <= flops2 ) {
             if ( (work = core_zlrmm_getws( params, M * B->rk + M * N )) == NULL ) {
-                work = malloc( (M * B->rk + M * N) * sizeof(pastix_complex64_t) );
+                work = pastix_lrmem_malloc( (M * B->rk + M * N) * sizeof(pastix_complex64_t) );
                 *infomask |= PASTIX_LRM3_ALLOCU;
             }
 
@@ -207,7 +207,7 @@ core_zfrlr2lr( core_zlrmm_t     *params,
         }
         else {
             if ( (work = core_zlrmm_getws( params, K * N + M * N )) == NULL ) {
-                work = malloc( (K * N + M * N) * sizeof(pastix_complex64_t) );
+                work = pastix_lrmem_malloc( (K * N + M * N) * sizeof(pastix_complex64_t) );
                 *infomask |= PASTIX_LRM3_ALLOCU;
             }
 
@@ -243,7 +243,7 @@ core_zfrlr2lr( core_zlrmm_t     *params,
         *infomask |= PASTIX_LRM3_TRANSB;
 
         if ( (work = core_zlrmm_getws( params, M * B->rk )) == NULL ) {
-            work = malloc( M * B->rk * sizeof(pastix_complex64_t) );
+            work = pastix_lrmem_malloc( M * B->rk * sizeof(pastix_complex64_t) );
             *infomask |= PASTIX_LRM3_ALLOCU;
         }
         AB->u = work;
@@ -326,7 +326,7 @@ core_zlrfr2lr( core_zlrmm_t     *params,
 
         if ( flops1 <= flops2 ) {
             if ( (work = core_zlrmm_getws( params, A->rk * N + M * N )) == NULL ) {
-                work = malloc( (A->rk * N + M * N) * sizeof(pastix_complex64_t) );
+                work = pastix_lrmem_malloc( (A->rk * N + M * N) * sizeof(pastix_complex64_t) );
                 *infomask |= PASTIX_LRM3_ALLOCU;
             }
 
@@ -353,7 +353,7 @@ core_zlrfr2lr( core_zlrmm_t     *params,
         }
         else {
             if ( (work = core_zlrmm_getws( params, M * K + M * N )) == NULL ) {
-                work = malloc( (M * K + M * N) * sizeof(pastix_complex64_t) );
+                work = pastix_lrmem_malloc( (M * K + M * N) * sizeof(pastix_complex64_t) );
                 *infomask |= PASTIX_LRM3_ALLOCU;
             }
 
@@ -389,7 +389,7 @@ core_zlrfr2lr( core_zlrmm_t     *params,
         *infomask |= PASTIX_LRM3_ORTHOU;
 
         if ( (work = core_zlrmm_getws( params, A->rk * N )) == NULL ) {
-            work = malloc( A->rk * N * sizeof(pastix_complex64_t) );
+            work = pastix_lrmem_malloc( A->rk * N * sizeof(pastix_complex64_t) );
             *infomask |= PASTIX_LRM3_ALLOCV;
         }
         AB->v = work;
@@ -462,7 +462,7 @@ core_zlrlr2lr( core_zlrmm_t     *params,
     ldbv = B->rkmax;
 
     if ( (work2 = core_zlrmm_getws( params, A->rk * B->rk )) == NULL ) {
-        work2 = malloc( A->rk * B->rk * sizeof(pastix_complex64_t) );
+        work2 = pastix_lrmem_malloc( A->rk * B->rk * sizeof(pastix_complex64_t) );
         allocated = 1;
     }
 
@@ -491,7 +491,7 @@ core_zlrlr2lr( core_zlrmm_t     *params,
              *    ABv = (Av^h Bv^h') * Bu'
              */
             if ( (work = core_zlrmm_getws( params, A->rk * N )) == NULL ) {
-                work = malloc( A->rk * N * sizeof(pastix_complex64_t) );
+                work = pastix_lrmem_malloc( A->rk * N * sizeof(pastix_complex64_t) );
                 *infomask |= PASTIX_LRM3_ALLOCV;
             }
 
@@ -514,7 +514,7 @@ core_zlrlr2lr( core_zlrmm_t     *params,
              *    ABv = Bu'
              */
             if ( (work = core_zlrmm_getws( params, B->rk * M )) == NULL ) {
-                work = malloc( B->rk * M * sizeof(pastix_complex64_t) );
+                work = pastix_lrmem_malloc( B->rk * M * sizeof(pastix_complex64_t) );
                 *infomask |= PASTIX_LRM3_ALLOCU;
             }
 
@@ -545,7 +545,7 @@ core_zlrlr2lr( core_zlrmm_t     *params,
      */
     else {
         if ( (work = core_zlrmm_getws( params, (M + N) * rArB.rk )) == NULL ) {
-            work = malloc( (M + N) * rArB.rk * sizeof(pastix_complex64_t) );
+            work = pastix_lrmem_malloc( (M + N) * rArB.rk * sizeof(pastix_complex64_t) );
             *infomask |= PASTIX_LRM3_ALLOCU;
         }
 
@@ -572,7 +572,7 @@ core_zlrlr2lr( core_zlrmm_t     *params,
     core_zlrfree(&rArB);
 
     if ( allocated ) {
-        free( work2 );
+        pastix_lrmem_free( work2 );
     }
     PASTE_CORE_ZLRMM_VOID;
     return flops;
@@ -72,7 +72,7 @@ cpucblk_zadd_frlr( pastix_coefside_t   side,
                    const pastix_lr_t  *lowrank )
 {
     const SolverBlok   *blokA  = cblkA->fblokptr;
-    const SolverBlok   *blokB  = cblkB->fblokptr;
+    SolverBlok         *blokB  = cblkB->fblokptr;
     const SolverBlok   *lblokA = cblkA[1].fblokptr;
     const SolverBlok   *lblokB = cblkB[1].fblokptr;
     pastix_complex64_t *A;
@@ -107,7 +107,7 @@ cpucblk_zadd_frlr( pastix_coefside_t   side,
     params.work    = work;
     params.lwork   = lwork;
     params.lwused  = 0;
-    params.lock    = &(cblkB->lock);
+    params.Cacc    = NULL;
 
     /* Dimensions on N */
     params.N    = cblk_colnbr( cblkA );
@@ -134,6 +134,7 @@ cpucblk_zadd_frlr( pastix_coefside_t   side,
         params.Cm   = blok_rownbr( blokB );
         params.offx = blokA->frownum - blokB->frownum;
         params.C    = blokB->LRblock[shift];
+        params.lock = &(blokB->lock);
 
         flops += core_zlradd( &params, &lrA,
                               PastixNoTrans, 0 );
@@ -191,7 +192,7 @@ cpucblk_zadd_lrlr( pastix_coefside_t   side,
                    const pastix_lr_t  *lowrank )
 {
     const SolverBlok   *blokA  = cblkA->fblokptr;
-    const SolverBlok   *blokB  = cblkB->fblokptr;
+    SolverBlok         *blokB  = cblkB->fblokptr;
     const SolverBlok   *lblokA = cblkA[1].fblokptr;
     const SolverBlok   *lblokB = cblkB[1].fblokptr;
     pastix_int_t        shift;
@@ -214,7 +215,6 @@ cpucblk_zadd_lrlr( pastix_coefside_t   side,
     params.work    = work;
     params.lwork   = lwork;
     params.lwused  = 0;
-    params.lock    = &(cblkB->lock);
 
     /* Dimensions on N */
     params.N    = cblk_colnbr( cblkA );
@@ -235,6 +235,8 @@ cpucblk_zadd_lrlr( pastix_coefside_t   side,
         params.Cm   = blok_rownbr( blokB );
         params.offx = blokA->frownum - blokB->frownum;
         params.C    = blokB->LRblock[shift];
+        params.lock = &(blokB->lock);
+        params.Cacc = lowrank->compress_deferred ? &(blokB->LRacc[shift]) : NULL;
         flops += core_zlradd( &params, blokA->LRblock[shift], PastixNoTrans, PASTIX_LRM3_ORTHOU );
     }
     return flops;
@@ -281,6 +283,8 @@ cpucblk_zadd_frfr( pastix_coefside_t side,
     pastix_int_t        n = cblk_colnbr( cblkA );
     pastix_int_t        m = cblkA->stride;
     pastix_fixdbl_t     flops = m * n;
+    SolverBlok         *blokB  = cblkB->fblokptr;
+    const SolverBlok   *lblokB = cblkB[1].fblokptr;
 
     assert( !(cblkA->cblktype & CBLK_COMPRESSED) );
     assert( !(cblkB->cblktype & CBLK_COMPRESSED) );
@@ -296,22 +300,29 @@ cpucblk_zadd_frfr( pastix_coefside_t side,
 
     assert( (A != NULL) && (B != NULL) );
 
-    /* If the cblk matches */
+    /*
+     * If the cblk matches, both cblks share the same blocks and the same
+     * layout. The addition is still split by block, such that it is protected
+     * by the same locks as the updates.
+     */
     if ( (n == cblk_colnbr( cblkB )) &&
          (m == cblkB->stride) ) {
+        pastix_int_t ld;
+
+        for (; blokB < lblokB; blokB++) {
+            ld = (cblkB->cblktype & CBLK_LAYOUT_2D) ? blok_rownbr( blokB ) : m;
 
-        pastix_cblk_lock( cblkB );
-        core_zgeadd( PastixNoTrans, m, n,
-                     alpha, A, m,
-                        1., B, m );
-        pastix_cblk_unlock( cblkB );
+            pastix_blok_lock( blokB );
+            core_zgeadd( PastixNoTrans, blok_rownbr( blokB ), n,
+                         alpha, A + blokB->coefind, ld,
+                            1., B + blokB->coefind, ld );
+            pastix_blok_unlock( blokB );
+        }
     }
     else {
         pastix_complex64_t *bA, *bB;
         const SolverBlok   *blokA  = cblkA->fblokptr;
-        const SolverBlok   *blokB  = cblkB->fblokptr;
         const SolverBlok   *lblokA = cblkA[1].fblokptr;
-        const SolverBlok   *lblokB = cblkB[1].fblokptr;
         pastix_int_t        lda, ldb;
 
         /* Both cblk A and B must be stored in 2D */
@@ -335,11 +346,11 @@ cpucblk_zadd_frfr( pastix_coefside_t side,
             bB = bB + ldb * ( cblkA->fcolnum - cblkB->fcolnum ) + ( blokA->frownum - blokB->frownum );
             m = lda;
 
-            pastix_cblk_lock( cblkB );
+            pastix_blok_lock( blokB );
             core_zgeadd( PastixNoTrans, m, n,
                          alpha, bA, lda,
                             1., bB, ldb );
-            pastix_cblk_unlock( cblkB );
+            pastix_blok_unlock( blokB );
         }
     }
     return flops;
@@ -420,3 +431,58 @@ cpucblk_zadd( pastix_coefside_t  side,
     kernel_trace_stop( cblkB->fblokptr->inlast, ktype, m, n, 0, flops, time );
 }
 
+
+/**
+ *******************************************************************************
+ *
+ * @brief Add the deferred low-rank updates accumulated in the blocks of a
+ * compressed column block.
+ *
+ * When IPARM_COMPRESS_DEFERRED is enabled, the low-rank contributions to a
+ * low-rank block are stacked in its accumulator and recompressed together.
+ * This function applies the remaining accumulated contributions, and must be
+ * called once all the contributions to the cblk have been received.
+ *
+ *******************************************************************************
+ *
+ * @param[in] side
+ *          Define which side of the cblk must be flushed.
+ *          @arg PastixLCoef if lower part only
+ *          @arg PastixUCoef if upper part only
+ *          @arg PastixLUCoef if both sides.
+ *
+ * @param[inout] cblk
+ *          The column block to flush.
+ *
+ * @param[in] lowrank
+ *          The structure with low-rank parameters.
+ *
+ *******************************************************************************/
+void
+cpucblk_zlrflush( pastix_coefside_t  side,
+                  SolverCblk        *cblk,
+                  const pastix_lr_t *lowrank )
+{
+    SolverBlok     *blok  = cblk[0].fblokptr;
+    SolverBlok     *lblok = cblk[1].fblokptr;
+    pastix_int_t    ncols = cblk_colnbr( cblk );
+    pastix_int_t    nrows;
+    pastix_fixdbl_t time, flops = 0.0;
+
+    assert( cblk->cblktype & CBLK_COMPRESSED );
+
+    time = kernel_trace_start( PastixKernelGEADDCblkLRLR );
+    for (; blok<lblok; blok++) {
+        nrows = blok_rownbr( blok );
+        if ( side != PastixUCoef ) {
+            flops += core_zlrflush( lowrank, nrows, ncols,
+                                    blok->LRblock[0], &(blok->LRacc[0]) );
+        }
+        if ( side != PastixLCoef ) {
+            flops += core_zlrflush( lowrank, nrows, ncols,
+                                    blok->LRblock[1], &(blok->LRacc[1]) );
+        }
+    }
+    kernel_trace_stop( cblk->fblokptr->inlast, PastixKernelGEADDCblkLRLR,
+                       cblk->stride, ncols, 0, flops, time );
+}
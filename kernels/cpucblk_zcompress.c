@@ -23,13 +23,285 @@
 #include "pastix_zcores.h"
 #include "pastix_zlrcores.h"
 
+/**
+ *******************************************************************************
+ *
+ * @brief Compress a full-rank block with a given limit on the rank.
+ *
+ *******************************************************************************
+ *
+ * @param[in] lowrank
+ *          The pointer to the low-rank structure describing the lo-rank
+ *          compression parameters.
+ *
+ * @param[in] rklimit
+ *          The maximum rank to store the matrix in low-rank format. If
+ *          -1, set to core_get_rklimit(M, N)
+ *
+ * @param[in] M
+ *          The number of rows in the block
+ *
+ * @param[in] N
+ *          The number of columns in the block
+ *
+ * @param[in] omega
+ *          The Gaussian matrix shared by the blocks of the column block with
+ *          PastixCompressMethodARRF, NULL otherwise.
+ *
+ * @param[inout] lrA
+ *          The full-rank block to compress.
+ *
+ *******************************************************************************
+ *
+ * @return The number of flops used to compress the block.
+ *
+ *******************************************************************************/
+static inline pastix_fixdbl_t
+cpublok_zcompress_rklimit( const pastix_lr_t        *lowrank,
+                           pastix_int_t              rklimit,
+                           pastix_int_t              M,
+                           pastix_int_t              N,
+                           const pastix_complex64_t *omega,
+                           pastix_lrblock_t         *lrA )
+{
+    pastix_fixdbl_t     flops;
+    pastix_complex64_t *A = lrA->u;
+
+    assert( lrA->rk == -1 );
+    assert( lrA->u != NULL );
+    assert( lrA->v == NULL );
+
+    kernel_trace_start_lvl2( PastixKernelLvl2_LR_init_compress );
+    if ( omega != NULL ) {
+        flops = core_zge2lr_arrf_sketch( lowrank->use_reltol, lowrank->tolerance, rklimit,
+                                         M, N, A, M, omega, N, lrA );
+    }
+    else {
+        flops = lowrank->core_ge2lr( lowrank->use_reltol, lowrank->tolerance, rklimit,
+                                     M, N, A, M, lrA );
+    }
+    kernel_trace_stop_lvl2_rank( flops, lrA->rk );
+
+    assert( A != lrA->u );
+    pastix_lrmem_free( A );
+
+    return flops;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Look up the rank cache of a block before its compression.
+ *
+ * The rank obtained for the block at the previous factorization is used to:
+ *   - skip the compression if the block was incompressible. The block is
+ *     compressed again after PASTIX_LR_RKCACHE_RETRY skipped factorizations,
+ *     in case its values changed,
+ *   - bound the rank of the randomized methods to this rank plus a margin.
+ *
+ * The time of the last compression made without the rank cache is credited
+ * as saved only once, for the first skip or reuse that follows it.
+ *
+ *******************************************************************************
+ *
+ * @param[in] lowrank
+ *          The pointer to the low-rank structure describing the lo-rank
+ *          compression parameters.
+ *
+ * @param[inout] blok
+ *          The block structure that holds the rank cache.
+ *
+ * @param[in] side
+ *          The side of the block: 0 for L, 1 for U.
+ *
+ * @param[in] M
+ *          The number of rows in the block
+ *
+ * @param[in] N
+ *          The number of columns in the block
+ *
+ * @param[out] rklimit
+ *          On exit, the bound on the rank of the block, or -1 if none.
+ *
+ *******************************************************************************
+ *
+ * @return 1 if the compression of the block is skipped, 0 otherwise.
+ *
+ *******************************************************************************/
+static inline int
+cpublok_zrkcache_lookup( const pastix_lr_t *lowrank,
+                         SolverBlok        *blok,
+                         int                side,
+                         pastix_int_t       M,
+                         pastix_int_t       N,
+                         pastix_int_t      *rklimit )
+{
+    int rkprev = blok->rkcache[side];
+
+    *rklimit = -1;
+    pastix_atomic_add_64b( kernels_rkcache_stats + 1, 1 );
+
+    /* The block was incompressible at one of the previous factorizations */
+    if ( (rkprev == -1) && (blok->rkskip[side] > 0) ) {
+        blok->rkskip[side]--;
+        pastix_atomic_add_64b( kernels_rkcache_stats,     1 );
+        pastix_atomic_add_64b( kernels_rkcache_stats + 2, (uint64_t)(blok->rktime[side] * 1.e9) );
+        blok->rktime[side] = 0.;
+        return 1;
+    }
+
+    /* Bound the rank of the randomized methods */
+    if ( (rkprev >= 0) &&
+         ( (lowrank->compress_method == PastixCompressMethodRQRCP) ||
+           (lowrank->compress_method == PastixCompressMethodTQRCP) ||
+           (lowrank->compress_method == PastixCompressMethodRQRRT) ||
+           (lowrank->compress_method == PastixCompressMethodARRF ) ) )
+    {
+        pastix_int_t rkbound = rkprev + pastix_imax( rkprev / 4, PASTIX_LR_RKCACHE_MARGIN );
+
+        if ( rkbound < core_get_rklimit( M, N ) ) {
+            *rklimit = rkbound;
+        }
+    }
+    return 0;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Store the result of the compression of a block in its rank cache.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] blok
+ *          The block structure that holds the rank cache.
+ *
+ * @param[in] side
+ *          The side of the block: 0 for L, 1 for U.
+ *
+ * @param[in] reused
+ *          True if the block has been compressed within the bound given by
+ *          cpublok_zrkcache_lookup().
+ *
+ * @param[in] time
+ *          The time spent in the compression of the block.
+ *
+ * @param[in] rk
+ *          The rank of the compressed block.
+ *
+ *******************************************************************************/
+static inline void
+cpublok_zrkcache_store( SolverBlok  *blok,
+                        int          side,
+                        int          reused,
+                        double       time,
+                        pastix_int_t rk )
+{
+    if ( reused ) {
+        double saved = blok->rktime[side] - time;
+
+        pastix_atomic_add_64b( kernels_rkcache_stats, 1 );
+        if ( saved > 0. ) {
+            pastix_atomic_add_64b( kernels_rkcache_stats + 2, (uint64_t)(saved * 1.e9) );
+        }
+        blok->rktime[side] = 0.;
+    }
+    else {
+        blok->rktime[side] = time;
+    }
+    blok->rkcache[side] = rk;
+    blok->rkskip[side]  = ( rk == -1 ) ? PASTIX_LR_RKCACHE_RETRY : 0;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Compress a single block with the help of the rank cache.
+ *
+ * The rank cache is looked up with cpublok_zrkcache_lookup(). If the bound it
+ * gives is not sufficient anymore, the compression is restarted without it.
+ * The rank and the time of the compression are stored in the block for the
+ * next factorization, and the statistics are accumulated in
+ * kernels_rkcache_stats.
+ *
+ *******************************************************************************
+ *
+ * @param[in] lowrank
+ *          The pointer to the low-rank structure describing the lo-rank
+ *          compression parameters.
+ *
+ * @param[inout] blok
+ *          The block structure that holds the rank cache of lrA, or NULL if
+ *          the rank cache is not used.
+ *
+ * @param[in] M
+ *          The number of rows in the block
+ *
+ * @param[in] N
+ *          The number of columns in the block
+ *
+ * @param[in] omega
+ *          The Gaussian matrix shared by the blocks of the column block with
+ *          PastixCompressMethodARRF, NULL otherwise.
+ *
+ * @param[inout] lrA
+ *          The block to compress. On input, it points to a full-rank matrix. On
+ *          output, if possible the matrix is compressed in block low-rank
+ *          format.
+ *
+ *******************************************************************************
+ *
+ * @return The number of flops used to compress the block.
+ *
+ *******************************************************************************/
+static inline pastix_fixdbl_t
+cpublok_zcompress_cached( const pastix_lr_t        *lowrank,
+                          SolverBlok               *blok,
+                          pastix_int_t              M,
+                          pastix_int_t              N,
+                          const pastix_complex64_t *omega,
+                          pastix_lrblock_t         *lrA )
+{
+    pastix_fixdbl_t flops;
+    pastix_int_t    rklimit;
+    double          time;
+    int             side, reused;
+
+    if ( lrA->rk != -1 ) {
+        return 0.;
+    }
+
+    if ( (blok == NULL) || !(lowrank->rank_cache) ) {
+        return cpublok_zcompress_rklimit( lowrank, -1, M, N, omega, lrA );
+    }
+
+    side = ( lrA == blok->LRblock[0] ) ? 0 : 1;
+    if ( cpublok_zrkcache_lookup( lowrank, blok, side, M, N, &rklimit ) ) {
+        return 0.;
+    }
+
+    time   = clockGetLocal();
+    flops  = cpublok_zcompress_rklimit( lowrank, rklimit, M, N, omega, lrA );
+    reused = (rklimit != -1) && (lrA->rk != -1);
+
+    /* The rank grew beyond the bound, the block is compressed again */
+    if ( (rklimit != -1) && (lrA->rk == -1) ) {
+        flops += cpublok_zcompress_rklimit( lowrank, -1, M, N, omega, lrA );
+    }
+
+    cpublok_zrkcache_store( blok, side, reused, clockGetLocal() - time, lrA->rk );
+    return flops;
+}
+
 /**
  *******************************************************************************
  *
  * @brief Compress a single block from full-rank to low-rank format
  *
  * The compression to low-rank format is parameterized by the input information
- * stored in the low-rank structure.
+ * stored in the low-rank structure. If the rank cache is enabled, the rank of
+ * the previous factorization stored in the block structure is reused (see
+ * IPARM_COMPRESS_RANK_CACHE).
  *
  *******************************************************************************
  *
@@ -37,6 +309,10 @@
  *          The pointer to the low-rank structure describing the lo-rank
  *          compression parameters.
  *
+ * @param[inout] blok
+ *          The block structure associated to lrA, that holds its rank cache.
+ *          May be NULL to disable the rank cache.
+ *
  * @param[in] M
  *          The number of rows in the block
  *
@@ -55,28 +331,296 @@
  *******************************************************************************/
 pastix_fixdbl_t
 cpublok_zcompress( const pastix_lr_t *lowrank,
+                   SolverBlok        *blok,
                    pastix_int_t       M,
                    pastix_int_t       N,
                    pastix_lrblock_t  *lrA )
 {
+    return cpublok_zcompress_cached( lowrank, blok, M, N, NULL, lrA );
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Compress both sides of an off-diagonal block of a column block.
+ *
+ *******************************************************************************
+ *
+ * @param[in] lowrank
+ *          The pointer to the low-rank structure describing the lo-rank
+ *          compression parameters.
+ *
+ * @param[in] side
+ *          Define which side of the matrix must be compressed.
+ *
+ * @param[in] max_ilulvl
+ *          The blocks with an ILU level lower or equal to max_ilulvl are kept
+ *          in full-rank.
+ *
+ * @param[in] ncols
+ *          The number of columns of the column block.
+ *
+ * @param[in] omega
+ *          The Gaussian matrix shared by the blocks of the column block with
+ *          PastixCompressMethodARRF, NULL otherwise.
+ *
+ * @param[inout] blok
+ *          The block to compress.
+ *
+ *******************************************************************************
+ *
+ * @return The memory gain resulting from the compression to low-rank format in
+ *         number of elements.
+ *
+ *******************************************************************************/
+static inline pastix_int_t
+cpublok_zcompress_sides( const pastix_lr_t        *lowrank,
+                         pastix_coefside_t         side,
+                         int                       max_ilulvl,
+                         pastix_int_t              ncols,
+                         const pastix_complex64_t *omega,
+                         SolverBlok               *blok )
+{
+    pastix_lrblock_t *lrA;
+    pastix_int_t      nrows = blok_rownbr( blok );
+    pastix_int_t      gain;
+    pastix_int_t      gainL = 0;
+    pastix_int_t      gainU = 0;
+    int is_preselected = ( blok->iluklvl <= max_ilulvl );
+
+    /* Skip uncompressible blocks */
+    if ( nrows < lowrank->compress_min_height ) {
+        return 0;
+    }
+
+    if ( is_preselected ) {
+        return 0;
+    }
+
+    gain = nrows * ncols;
+
+    /* Lower part */
+    if ( side != PastixUCoef ) {
+        lrA = blok->LRblock[0];
+
+        /* Try to compress non selected blocks */
+        cpublok_zcompress_cached( lowrank, blok, nrows, ncols, omega, lrA );
+
+        if ( lrA->rk != -1 ) {
+            gainL += gain - ((nrows+ncols) * lrA->rk);
+        }
+    }
+
+    /* Upper part */
+    if ( side != PastixLCoef ) {
+        lrA = blok->LRblock[1];
+
+        cpublok_zcompress_cached( lowrank, blok, nrows, ncols, omega, lrA );
+
+        if ( lrA->rk != -1 ) {
+            gainU += gain - ((nrows+ncols) * lrA->rk);
+        }
+    }
+
+    return gainL + gainU;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Compress the off-diagonal blocks of a column block together with the
+ * adaptive randomized range finder.
+ *
+ * For each side, the full-rank blocks to compress are stacked in a single
+ * matrix, such that they are sampled with a single product per batch of
+ * samples (see core_zge2lr_arrf_stack()). Each block still gets its own rank.
+ *
+ *******************************************************************************
+ *
+ * @param[in] lowrank
+ *          The pointer to the low-rank structure describing the lo-rank
+ *          compression parameters.
+ *
+ * @param[in] side
+ *          Define which side of the matrix must be compressed.
+ *
+ * @param[in] max_ilulvl
+ *          The blocks with an ILU level lower or equal to max_ilulvl are kept
+ *          in full-rank.
+ *
+ * @param[inout] cblk
+ *          The column block to compress.
+ *
+ * @param[in] omega
+ *          The Gaussian matrix shared by the blocks of the column block.
+ *
+ *******************************************************************************
+ *
+ * @return The memory gain resulting from the compression to low-rank format in
+ *         number of elements.
+ *
+ *******************************************************************************/
+static inline pastix_int_t
+cpucblk_zcompress_stack( const pastix_lr_t        *lowrank,
+                         pastix_coefside_t         side,
+                         int                       max_ilulvl,
+                         SolverCblk               *cblk,
+                         const pastix_complex64_t *omega )
+{
+    SolverBlok         *fblok  = cblk[0].fblokptr + 1;
+    SolverBlok         *lblok  = cblk[1].fblokptr;
+    SolverBlok         *blok, **bloks;
+    pastix_lrblock_t  **lrAs;
+    pastix_int_t       *rklimit, *offset;
+    pastix_complex64_t *A;
     pastix_fixdbl_t     flops;
-    pastix_complex64_t *A = lrA->u;
+    pastix_int_t        ncols  = cblk_colnbr( cblk );
+    pastix_int_t        nbblok = lblok - fblok;
+    pastix_int_t        i, nrows, nblk, lda;
+    pastix_int_t        gain = 0;
+    double              time;
+    int                 s, reused, ret;
+
+    MALLOC_INTERN( bloks,   nbblok,     SolverBlok*       );
+    MALLOC_INTERN( lrAs,    nbblok,     pastix_lrblock_t* );
+    MALLOC_INTERN( rklimit, nbblok,     pastix_int_t      );
+    MALLOC_INTERN( offset,  nbblok + 1, pastix_int_t      );
+
+    for ( s=0; s<2; s++ ) {
+        if ( ((s == 0) && (side == PastixUCoef)) ||
+             ((s == 1) && (side == PastixLCoef)) )
+        {
+            continue;
+        }
 
-    if ( lrA->rk != -1 ) {
-        return 0.;
+        /* Select the full-rank blocks to compress */
+        nblk      = 0;
+        offset[0] = 0;
+        for ( blok = fblok; blok < lblok; blok++ ) {
+            nrows = blok_rownbr( blok );
+
+            if ( (nrows < lowrank->compress_min_height) ||
+                 (blok->iluklvl <= max_ilulvl) ||
+                 (blok->LRblock[s]->rk != -1) )
+            {
+                continue;
+            }
+
+            rklimit[nblk] = -1;
+            if ( lowrank->rank_cache &&
+                 cpublok_zrkcache_lookup( lowrank, blok, s, nrows, ncols, rklimit + nblk ) )
+            {
+                continue;
+            }
+
+            bloks[nblk]    = blok;
+            lrAs[nblk]     = blok->LRblock[s];
+            offset[nblk+1] = offset[nblk] + nrows;
+            nblk++;
+        }
+
+        if ( nblk == 0 ) {
+            continue;
+        }
+
+        time = clockGetLocal();
+
+        /* Stack the blocks, and release their full-rank storage */
+        lda = offset[nblk];
+        MALLOC_INTERN( A, lda * ncols, pastix_complex64_t );
+        for ( i=0; i<nblk; i++ ) {
+            nrows = offset[i+1] - offset[i];
+            ret = LAPACKE_zlacpy_work( LAPACK_COL_MAJOR, 'A', nrows, ncols,
+                                       lrAs[i]->u, nrows, A + offset[i], lda );
+            assert( ret == 0 );
+            pastix_lrmem_free( lrAs[i]->u );
+            lrAs[i]->u = NULL;
+        }
+
+        kernel_trace_start_lvl2( PastixKernelLvl2_LR_init_compress );
+        flops = core_zge2lr_arrf_stack( lowrank->use_reltol, lowrank->tolerance,
+                                        nblk, rklimit, offset, ncols, A, lda,
+                                        omega, ncols, lrAs );
+        kernel_trace_stop_lvl2( flops );
+        memFree_null( A );
+
+        time = clockGetLocal() - time;
+
+        for ( i=0; i<nblk; i++ ) {
+            pastix_lrblock_t *lrA = lrAs[i];
+
+            nrows = offset[i+1] - offset[i];
+
+            if ( lowrank->rank_cache ) {
+                /* Share of the block in the time of the stacked compression */
+                double btime = time * (double)nrows / (double)lda;
+
+                reused = (rklimit[i] != -1) && (lrA->rk != -1);
+
+                /* The rank grew beyond the bound, the block is compressed again */
+                if ( (rklimit[i] != -1) && (lrA->rk == -1) ) {
+                    double t = clockGetLocal();
+                    cpublok_zcompress_rklimit( lowrank, -1, nrows, ncols, omega, lrA );
+                    btime += clockGetLocal() - t;
+                }
+                cpublok_zrkcache_store( bloks[i], s, reused, btime, lrA->rk );
+            }
+
+            if ( lrA->rk != -1 ) {
+                gain += nrows * ncols - ((nrows+ncols) * lrA->rk);
+            }
+        }
     }
-    assert( lrA->u != NULL );
-    assert( lrA->v == NULL );
 
-    kernel_trace_start_lvl2( PastixKernelLvl2_LR_init_compress );
-    flops = lowrank->core_ge2lr( lowrank->use_reltol, lowrank->tolerance, -1,
-                                 M, N, A, M, lrA );
-    kernel_trace_stop_lvl2_rank( flops, lrA->rk );
+    (void)ret;
+    memFree_null( bloks );
+    memFree_null( lrAs );
+    memFree_null( rklimit );
+    memFree_null( offset );
+    return gain;
+}
 
-    assert( A != lrA->u );
-    free( A );
+/**
+ * @brief Arguments of the team items of cpucblk_zcompress()
+ */
+struct cpucblk_zcompress_team_s {
+    pastix_coefside_t         side;       /**< The side(s) to compress                   */
+    int                       max_ilulvl; /**< The ILU level of the preselected blocks   */
+    const SolverCblk         *cblk;       /**< The column block to compress              */
+    const pastix_complex64_t *omega;      /**< The shared sketch of ARRF, or NULL        */
+    pastix_atomic_lock_t      lock;       /**< Lock to protect the gain update           */
+    pastix_int_t              gain;       /**< The memory gain on output                 */
+};
 
-    return flops;
+/**
+ *******************************************************************************
+ *
+ * @brief Compress one off-diagonal block of a column block.
+ *
+ * Team item of cpucblk_zcompress().
+ *
+ *******************************************************************************/
+static void
+cpucblk_zcompress_team( SolverMatrix *solvmtx,
+                        void         *args,
+                        pastix_int_t  item,
+                        void         *work,
+                        pastix_int_t  lwork )
+{
+    struct cpucblk_zcompress_team_s *arg = (struct cpucblk_zcompress_team_s *)args;
+    const SolverCblk *cblk = arg->cblk;
+    pastix_int_t      gain;
+
+    gain = cpublok_zcompress_sides( &(solvmtx->lowrank), arg->side, arg->max_ilulvl,
+                                    cblk_colnbr( cblk ), arg->omega,
+                                    cblk->fblokptr + 1 + item );
+
+    pastix_atomic_lock( &(arg->lock) );
+    arg->gain += gain;
+    pastix_atomic_unlock( &(arg->lock) );
+
+    (void)work;
+    (void)lwork;
 }
 
 /**
@@ -85,7 +629,15 @@ cpublok_zcompress( const pastix_lr_t *lowrank,
  * @brief Compress a single column block from full-rank to low-rank format
  *
  * The compression to low-rank format is parameterized by the input information
- * stored in the low-rank structure.
+ * stored in the low-rank structure. With PastixCompressMethodARRF, a single
+ * Gaussian matrix is generated for the column block and used to sample all its
+ * off-diagonal blocks, on both sides. The blocks of each side are stacked to
+ * be sampled together (see cpucblk_zcompress_stack()).
+ *
+ * If the column block has at least lowrank->compress_team_bloknbr off-diagonal
+ * blocks, they are compressed with the help of the idle threads (see
+ * solverTeamRun()). In that case, each block is sampled on its own with the
+ * shared Gaussian matrix.
  *
  *******************************************************************************
  *
@@ -116,14 +668,13 @@ cpucblk_zcompress( const SolverMatrix *solvmtx,
                    int                 max_ilulvl,
                    SolverCblk         *cblk )
 {
-    pastix_lrblock_t   *lrA;
-    SolverBlok         *blok  = cblk[0].fblokptr + 1;
-    SolverBlok         *lblok = cblk[1].fblokptr;
-    pastix_int_t        ncols = cblk_colnbr( cblk );
-    pastix_int_t        gain;
-    pastix_int_t        gainL = 0;
-    pastix_int_t        gainU = 0;
+    SolverBlok         *blok   = cblk[0].fblokptr + 1;
+    SolverBlok         *lblok  = cblk[1].fblokptr;
+    pastix_int_t        ncols  = cblk_colnbr( cblk );
+    pastix_int_t        nbblok = lblok - blok;
+    pastix_int_t        gain   = 0;
     const pastix_lr_t  *lowrank = &(solvmtx->lowrank);
+    pastix_complex64_t *omega   = NULL;
 
     assert( cblk->cblktype & CBLK_LAYOUT_2D  );
     assert( cblk->cblktype & CBLK_COMPRESSED );
@@ -132,51 +683,69 @@ cpucblk_zcompress( const SolverMatrix *solvmtx,
         return 0;
     }
 
-    for (; blok<lblok; blok++)
-    {
-        pastix_int_t nrows = blok_rownbr( blok );
-        int is_preselected = ( blok->iluklvl <= max_ilulvl );
-
-        /* Skip uncompressible blocks */
-        if ( nrows < lowrank->compress_min_height ) {
-            continue;
-        }
-
-        if ( is_preselected ) {
-            continue;
-        }
-
-        gain = nrows * ncols;
-
-        /* Lower part */
-        if ( side != PastixUCoef ) {
-            lrA = blok->LRblock[0];
-
-            /* Try to compress non selected blocks */
-            if ( lrA->rk == -1 ) {
-                cpublok_zcompress( lowrank, nrows, ncols, lrA );
-            }
-
-            if ( lrA->rk != -1 ) {
-                gainL += gain - ((nrows+ncols) * lrA->rk);
+    /*
+     * Generate the sketch shared by all the blocks, with enough columns for the
+     * largest rank accepted among them.
+     */
+    if ( lowrank->compress_method == PastixCompressMethodARRF ) {
+        int          SEED[4] = {26, 67, 52, 197};
+        pastix_int_t maxrank = 0;
+        pastix_int_t size_O;
+        SolverBlok  *b;
+        int          ret;
+
+        for (b = blok; b<lblok; b++) {
+            pastix_int_t nrows = blok_rownbr( b );
+            pastix_int_t rklimit;
+
+            if ( (nrows < lowrank->compress_min_height) ||
+                 (b->iluklvl <= max_ilulvl) )
+            {
+                continue;
             }
+            rklimit = pastix_imin( core_get_rklimit( nrows, ncols ),
+                                   pastix_imin( nrows, ncols ) );
+            maxrank = pastix_imax( maxrank, rklimit );
         }
 
-        /* Upper part */
-        if ( side != PastixLCoef ) {
-            lrA = blok->LRblock[1];
-
-            if ( lrA->rk == -1 ) {
-                cpublok_zcompress( lowrank, nrows, ncols, lrA );
-            }
+        size_O = ncols * ( maxrank + 2 * PASTIX_LR_ARRF_NB );
+        MALLOC_INTERN( omega, size_O, pastix_complex64_t );
+        ret = LAPACKE_zlarnv_work( 3, SEED, size_O, omega );
+        assert( ret == 0 );
+        (void)ret;
+    }
 
-            if ( lrA->rk != -1 ) {
-                gainU += gain - ((nrows+ncols) * lrA->rk);
-            }
+    if ( (lowrank->compress_team_bloknbr > 0) &&
+         (nbblok >= lowrank->compress_team_bloknbr) )
+    {
+        struct cpucblk_zcompress_team_s args;
+
+        args.side       = side;
+        args.max_ilulvl = max_ilulvl;
+        args.cblk       = cblk;
+        args.omega      = omega;
+        args.lock       = PASTIX_ATOMIC_UNLOCKED;
+        args.gain       = 0;
+
+        /* The team is the only field of the solver matrix modified by the call */
+        solverTeamRun( (SolverMatrix *)solvmtx, cpucblk_zcompress_team,
+                       &args, nbblok, NULL, 0 );
+        gain = args.gain;
+    }
+    else if ( omega != NULL ) {
+        gain = cpucblk_zcompress_stack( lowrank, side, max_ilulvl, cblk, omega );
+    }
+    else {
+        for (; blok<lblok; blok++) {
+            gain += cpublok_zcompress_sides( lowrank, side, max_ilulvl,
+                                             ncols, omega, blok );
         }
     }
 
-    return gainL + gainU;
+    if ( omega != NULL ) {
+        memFree_null( omega );
+    }
+    return gain;
 }
 
 /**
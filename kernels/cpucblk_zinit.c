@@ -330,6 +330,10 @@ cpucblk_zfree( pastix_coefside_t  side,
             assert( blok->LRblock[0] != NULL );
             for (; blok<lblok; blok++) {
                 core_zlrfree(blok->LRblock[0]);
+                if ( blok->LRacc[0] != NULL ) {
+                    core_zlrfree( blok->LRacc[0] );
+                    memFree_null( blok->LRacc[0] );
+                }
             }
 
             if ( cblk->lcoeftab != (void*)-1 ) {
@@ -350,6 +354,10 @@ cpucblk_zfree( pastix_coefside_t  side,
             assert( blok->LRblock[1] != NULL );
             for (; blok<lblok; blok++) {
                 core_zlrfree(blok->LRblock[1]);
+                if ( blok->LRacc[1] != NULL ) {
+                    core_zlrfree( blok->LRacc[1] );
+                    memFree_null( blok->LRacc[1] );
+                }
             }
         }
         cblk->ucoeftab = NULL;
@@ -573,6 +573,47 @@ cpucblk_zincoming_deps( int                rank,
     return 0;
 }
 
+/**
+ *******************************************************************************
+ *
+ * @brief Make progress on the incoming dependencies without waiting for a
+ * given cblk.
+ *
+ * This is used by the static scheduler with lookahead when none of the tasks
+ * of its window is ready: the pending communications are progressed with MPI,
+ * and the core is yielded otherwise.
+ *
+ *******************************************************************************
+ *
+ * @param[in] rank
+ *          The rank of the current thread.
+ *
+ * @param[in] side
+ *          Define which side of the cblk must be released.
+ *          @arg PastixLCoef if lower part only
+ *          @arg PastixUCoef if upper part only
+ *          @arg PastixLUCoef if both sides.
+ *
+ * @param[inout] solvmtx
+ *          The solver matrix structure.
+ *
+ *******************************************************************************/
+void
+cpucblk_zincoming_progress( int                rank,
+                            pastix_coefside_t  side,
+                            SolverMatrix      *solvmtx )
+{
+#if defined(PASTIX_WITH_MPI)
+    cpucblk_zmpi_progress( side, solvmtx, rank );
+#else
+    pastix_yield();
+#endif
+
+    (void)rank;
+    (void)side;
+    (void)solvmtx;
+}
+
 /**
  *******************************************************************************
  *
@@ -605,6 +646,12 @@ cpucblk_zrelease_deps( pastix_coefside_t  side,
     int32_t ctrbcnt;
     ctrbcnt = pastix_atomic_dec_32b( &(fcbk->ctrbcnt) );
     if ( !ctrbcnt ) {
+        /* All the contributions are in, apply the deferred low-rank updates */
+        if ( solvmtx->lowrank.compress_deferred &&
+             (fcbk->cblktype & CBLK_COMPRESSED) )
+        {
+            cpucblk_zlrflush( side, fcbk, &(solvmtx->lowrank) );
+        }
 #if defined(PASTIX_WITH_MPI)
         if ( fcbk->cblktype & CBLK_FANIN ) {
             cpucblk_zisend( side, solvmtx, fcbk );
@@ -617,6 +664,7 @@ cpucblk_zrelease_deps( pastix_coefside_t  side,
             pastix_queue_t *queue = solvmtx->computeQueue[ cblk->threadid ];
             assert( fcbk->priority != -1 );
             pqueuePush1( queue, fcbk - solvmtx->cblktab, fcbk->priority );
+            solverIdleWakeup( solvmtx, 0 );
         }
     }
 }
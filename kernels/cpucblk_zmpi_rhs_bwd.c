@@ -229,6 +229,7 @@ cpucblk_zrequest_rhs_bwd_handle_recv( const args_solve_t *enums,
         const SolverCblk *fcbk  = solvmtx->cblktab + blok->lcblknm;
 
         pqueuePush1( queue, cblk - solvmtx->cblktab, - fcbk->priority );
+        solverIdleWakeup( solvmtx, 0 );
     }
     else {
         solve_cblk_ztrsmsp_backward( enums, solvmtx, cblk, rhsb );
@@ -543,6 +544,7 @@ cpucblk_zrelease_rhs_bwd_deps( const args_solve_t *enums,
             pastix_queue_t *queue = solvmtx->computeQueue[ cblk->threadid ];
             assert( fcbk->priority != -1 );
             pqueuePush1( queue, fcbk - solvmtx->cblktab, - fcbk->priority );
+            solverIdleWakeup( solvmtx, 0 );
         }
     }
     (void)enums;
@@ -784,6 +784,7 @@ cpucblk_zrelease_rhs_fwd_deps( const args_solve_t *enums,
             pastix_queue_t *queue = solvmtx->computeQueue[ cblk->threadid ];
             assert( fcbk->priority != -1 );
             pqueuePush1( queue, fcbk - solvmtx->cblktab, fcbk->priority );
+            solverIdleWakeup( solvmtx, 0 );
         }
     }
 }
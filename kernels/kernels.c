@@ -15,8 +15,102 @@
  *
  **/
 #include "common.h"
+#include "kernels.h"
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 pthread_mutex_t    pastix_comm_lock = PTHREAD_MUTEX_INITIALIZER;
 volatile pthread_t pastix_comm_tid  = (pthread_t)-1;
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+/**
+ * @brief Thresholds of the fixed-size kernels of the small blocks.
+ *
+ * The default values come from the small_kernels_time benchmark: in complex
+ * arithmetic, the gemm-like kernels are faster than the BLAS only for the
+ * smallest blocks.
+ */
+pastix_int_t pastix_kernel_small[4][PastixKernelSmallNbr] = {
+    { 16, 16, 16, 16, 16 }, /* PastixFloat     */
+    { 16, 16, 16, 16, 16 }, /* PastixDouble    */
+    { 16, 16,  4,  4, 12 }, /* PastixComplex32 */
+    { 16, 16,  4,  4, 12 }, /* PastixComplex64 */
+};
+
+/**
+ *******************************************************************************
+ *
+ * @brief Initialize the thresholds of the fixed-size kernels.
+ *
+ * If it is defined, the PASTIX_KERNEL_SMALL_MAX environment variable overwrites
+ * the threshold of all the kernels. Setting it to 0 disables the fixed-size
+ * kernels.
+ *
+ *******************************************************************************/
+void
+kernelsSmallInit( void )
+{
+    pastix_int_t size;
+
+    size = pastix_getenv_get_value_int( "PASTIX_KERNEL_SMALL_MAX", -1 );
+    if ( size >= 0 ) {
+        kernelsSmallSetThreshold( PastixPattern, PastixKernelSmallNbr, size );
+    }
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Set the threshold of the fixed-size variant of a kernel.
+ *
+ *******************************************************************************
+ *
+ * @param[in] flttype
+ *          The arithmetic to configure. If PastixPattern, all the arithmetics
+ *          are configured.
+ *
+ * @param[in] kernel
+ *          The kernel to configure. If PastixKernelSmallNbr, all the kernels
+ *          are configured.
+ *
+ * @param[in] size
+ *          The largest dimension of the blocks handled by the fixed-size
+ *          variant. It is bounded by PASTIX_KERNEL_SMALL_MAX, and 0 disables
+ *          the variant.
+ *
+ *******************************************************************************/
+void
+kernelsSmallSetThreshold( pastix_coeftype_t flttype,
+                          pastix_ksmall_t   kernel,
+                          pastix_int_t      size )
+{
+    int a, afirst, alast;
+    int k, kfirst, klast;
+
+    size = pastix_imax( 0, pastix_imin( size, PASTIX_KERNEL_SMALL_MAX ) );
+
+    if ( flttype == PastixPattern ) {
+        afirst = 0;
+        alast  = 4;
+    }
+    else {
+        assert( (flttype >= PastixFloat) && (flttype <= PastixComplex64) );
+        afirst = flttype - PastixFloat;
+        alast  = afirst + 1;
+    }
+
+    if ( kernel == PastixKernelSmallNbr ) {
+        kfirst = 0;
+        klast  = PastixKernelSmallNbr;
+    }
+    else {
+        assert( (kernel >= 0) && (kernel < PastixKernelSmallNbr) );
+        kfirst = kernel;
+        klast  = kernel + 1;
+    }
+
+    for ( a = afirst; a < alast; a++ ) {
+        for ( k = kfirst; k < klast; k++ ) {
+            pastix_kernel_small[a][k] = size;
+        }
+    }
+}
@@ -22,4 +22,35 @@ extern pthread_mutex_t    pastix_comm_lock;
 extern volatile pthread_t pastix_comm_tid;
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
+/**
+ * @brief Largest dimension handled by the fixed-size kernels of the small blocks.
+ */
+#define PASTIX_KERNEL_SMALL_MAX 16
+
+/**
+ * @brief List of the kernels with a fixed-size variant for the small blocks.
+ *
+ * The variant is used when all the dimensions of the block are at most the
+ * threshold of the kernel in pastix_kernel_small.
+ */
+typedef enum pastix_ksmall_e {
+    PastixKernelSmallGEADD, /**< core_zgeadd(), fixed number of rows            */
+    PastixKernelSmallSCALO, /**< core_zscalo(), fixed number of rows            */
+    PastixKernelSmallGEMDM, /**< core_zgemdm(), fixed number of rows            */
+    PastixKernelSmallGEMM,  /**< solve_blok_zgemm(), fixed number of rows       */
+    PastixKernelSmallTRSM,  /**< solve_blok_ztrsm(), fixed size of the triangle */
+    PastixKernelSmallNbr
+} pastix_ksmall_t;
+
+/**
+ * @brief Thresholds of the fixed-size kernels, per arithmetic
+ * (flttype - PastixFloat) and per kernel.
+ */
+extern pastix_int_t pastix_kernel_small[4][PastixKernelSmallNbr];
+
+void kernelsSmallInit( void );
+void kernelsSmallSetThreshold( pastix_coeftype_t flttype,
+                               pastix_ksmall_t   kernel,
+                               pastix_int_t      size );
+
 #endif /* _kernels_h_ */
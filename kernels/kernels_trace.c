@@ -65,6 +65,8 @@ int32_t               model_size        = 0;
 
 pastix_atomic_lock_t lock_flops = PASTIX_ATOMIC_UNLOCKED;
 double overall_flops[3] = { 0.0, 0.0, 0.0 };
+volatile uint64_t kernels_lock_stats[2] = { 0, 0 };
+volatile uint64_t kernels_rkcache_stats[3] = { 0, 0, 0 };
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 /**
@@ -154,6 +156,8 @@ kernelsTraceStart( const pastix_data_t *pastix_data )
     overall_flops[0] = 0.0;
     overall_flops[1] = 0.0;
     overall_flops[2] = 0.0;
+    kernels_lock_stats[0] = 0;
+    kernels_lock_stats[1] = 0;
     kernels_trace_started = 1;
 
     (void)solvmtx;
@@ -184,6 +188,18 @@ kernelsTraceStop( const pastix_data_t *pastix_data )
     int32_t nbstart;
 
     assert( kernels_trace_started > 0 );
+
+    /* Merge the statistics of the arenas of the low-rank memory pool of the solver */
+    if ( pastix_data->solvmatr->lowrank.lrmem != NULL ) {
+        uint64_t lrmem_stats[3];
+
+        pastix_lrmem_getstats( pastix_data->solvmatr->lowrank.lrmem, lrmem_stats );
+        pastix_data->dparm[DPARM_MEM_LR_PEAK] = (double)(lrmem_stats[2]);
+    }
+    else {
+        pastix_data->dparm[DPARM_MEM_LR_PEAK] = -1.;
+    }
+
     pastix_atomic_lock( &lock_flops );
     nbstart = pastix_atomic_dec_32b( &(kernels_trace_started) );
     if ( nbstart > 0 ) {
@@ -263,6 +279,8 @@ kernelsTraceStop( const pastix_data_t *pastix_data )
 
     /* Update the real number of Flops performed */
     pastix_data->dparm[DPARM_FACT_RLFLOPS] = overall_flops[0] + overall_flops[1] + overall_flops[2];
+    pastix_data->dparm[DPARM_FACT_LOCKWAIT] = (double)(kernels_lock_stats[1]) * 1.e-9;
+    pastix_data->dparm[DPARM_FACT_RKCACHE_SAVED] = (double)(kernels_rkcache_stats[2]) * 1.e-9;
 
 #if defined(PASTIX_SUPERNODE_STATS)
     if (pastix_data->iparm[IPARM_VERBOSE] > PastixVerboseNot) {
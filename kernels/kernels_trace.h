@@ -39,6 +39,50 @@ extern pastix_atomic_lock_t lock_flops;
  */
 extern double overall_flops[3];
 
+/**
+ * @brief Statistics on the locks protecting the accumulation of the updates:
+ * number of contended acquisitions, and time spent waiting on them in ns
+ */
+extern volatile uint64_t kernels_lock_stats[2];
+
+/**
+ * @brief Statistics on the rank cache of the compression: number of blocks
+ * that reused their previous rank, number of compressed blocks, and estimated
+ * time saved in ns
+ */
+extern volatile uint64_t kernels_rkcache_stats[3];
+
+/**
+ *******************************************************************************
+ *
+ * @brief Take a lock protecting the accumulation of an update.
+ *
+ * The lock is first tried without waiting, such that the clock is read only
+ * when the lock is contended.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] lock
+ *          The lock to acquire.
+ *
+ *******************************************************************************/
+static inline void
+kernels_lock( pastix_atomic_lock_t *lock )
+{
+    double time;
+
+    if ( pastix_atomic_trylock( lock ) ) {
+        return;
+    }
+
+    time = clockGetLocal();
+    pastix_atomic_lock( lock );
+    time = clockGetLocal() - time;
+
+    pastix_atomic_add_64b( kernels_lock_stats,     1 );
+    pastix_atomic_add_64b( kernels_lock_stats + 1, (uint64_t)(time * 1.e9) );
+}
+
 #if defined(PASTIX_GENERATE_MODEL)
 
 /**
@@ -30,6 +30,7 @@ const char *compmeth_shnames[PastixCompressMethodNbr] = {
     "RQRCP",
     "TQRCP",
     "RQRRT",
+    "ARRF",
 };
 
 const char *compmeth_lgnames[PastixCompressMethodNbr] = {
@@ -38,6 +39,7 @@ const char *compmeth_lgnames[PastixCompressMethodNbr] = {
     "Randomized QR with Column Pivoting",
     "Truncated QR with Column Pivoting",
     "Randomized QR with QR rotation",
+    "Adaptive Randomized Range Finder",
 };
 
 const fct_ge2lr_t ge2lrMethods[PastixCompressMethodNbr][4] =
@@ -47,6 +49,7 @@ const fct_ge2lr_t ge2lrMethods[PastixCompressMethodNbr][4] =
     { core_sge2lr_rqrcp, core_dge2lr_rqrcp, core_cge2lr_rqrcp, core_zge2lr_rqrcp },
     { core_sge2lr_tqrcp, core_dge2lr_tqrcp, core_cge2lr_tqrcp, core_zge2lr_tqrcp },
     { core_sge2lr_rqrrt, core_dge2lr_rqrrt, core_cge2lr_rqrrt, core_zge2lr_rqrrt },
+    { core_sge2lr_arrf,  core_dge2lr_arrf,  core_cge2lr_arrf,  core_zge2lr_arrf  },
 };
 
 const fct_rradd_t rraddMethods[PastixCompressMethodNbr][4] =
@@ -55,5 +58,6 @@ const fct_rradd_t rraddMethods[PastixCompressMethodNbr][4] =
     { core_srradd_pqrcp, core_drradd_pqrcp, core_crradd_pqrcp, core_zrradd_pqrcp },
     { core_srradd_rqrcp, core_drradd_rqrcp, core_crradd_rqrcp, core_zrradd_rqrcp },
     { core_srradd_tqrcp, core_drradd_tqrcp, core_crradd_tqrcp, core_zrradd_tqrcp },
+    { core_srradd_pqrcp, core_drradd_pqrcp, core_crradd_pqrcp, core_zrradd_pqrcp },
     { core_srradd_pqrcp, core_drradd_pqrcp, core_crradd_pqrcp, core_zrradd_pqrcp }
 };
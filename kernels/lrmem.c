@@ -0,0 +1,526 @@
+/**
+ *
+ * @file lrmem.c
+ *
+ * PaStiX memory pool for the factors of the low-rank blocks and for the
+ * workspaces of the low-rank kernels.
+ *
+ * Each buffer is preceded by a small header storing its size class. The sizes
+ * are rounded up to classes spaced by an eighth of a power of two, and the
+ * buffers released in a class are kept in a free list to be reused by the next
+ * allocations of the same class. This avoids the fragmentation caused by the
+ * many allocations of slightly different sizes made by the recompressions,
+ * such that the peak memory stays close to the memory of the low-rank factors.
+ *
+ * Each solver owns its pool, made of one arena per thread of its scheduler.
+ * An arena keeps its own free lists and statistics, such that the allocations
+ * and releases of a thread do not access any shared data. The threads bind
+ * themselves to their arena at the beginning of each parallel call of the
+ * solver. The threads that are not bound, as the ones of the runtime
+ * schedulers, directly allocate their buffers without any accounting.
+ *
+ * A buffer released by another thread than the one that allocated it is kept
+ * by the arena of the releasing thread. The free lists of all the arenas are
+ * released together with the pool, when the coefficients of the solver are
+ * freed, once the low-rank blocks of each cblk have been returned.
+ *
+ * @copyright 2016-2023 Bordeaux INP, CNRS (LaBRI UMR 5800), Inria,
+ *                      Univ. Bordeaux. All rights reserved.
+ *
+ * @version 6.3.0
+ * @author Mathieu Faverge
+ * @date 2026-10-17
+ *
+ **/
+#include "common.h"
+#include "pastix_lowrank.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+/*
+ * Size of the header: it keeps the alignment of the buffers given by malloc.
+ */
+#define LRMEM_HEADER    64
+
+/*
+ * The classes go from 2^LRMEM_SHIFT_MIN to 2^LRMEM_SHIFT_MAX bytes with
+ * 2^LRMEM_SHIFT_STEP classes per power of two. Larger buffers are directly
+ * allocated with malloc.
+ */
+#define LRMEM_SHIFT_MIN   9
+#define LRMEM_SHIFT_MAX  23
+#define LRMEM_SHIFT_STEP  3
+#define LRMEM_CLASSNBR   ( ((LRMEM_SHIFT_MAX - LRMEM_SHIFT_MIN) << LRMEM_SHIFT_STEP) + 1 )
+
+/*
+ * Each arena keeps at most max( LRMEM_CACHE_MIN, inuse / LRMEM_CACHE_RATIO )
+ * bytes of unused buffers.
+ */
+#define LRMEM_CACHE_MIN   ((uint64_t)1 << 22)
+#define LRMEM_CACHE_RATIO 16
+
+struct lrmem_arena_s;
+
+typedef union lrmem_head_u {
+    struct {
+        union lrmem_head_u   *next;  /* Next buffer in the free list of the class  */
+        struct lrmem_arena_s *arena; /* Arena holding the buffer, NULL if unpooled */
+        size_t                size;  /* Capacity of the buffer                     */
+        int                   clsid; /* Class of the buffer, -1 if too large       */
+    } h;
+    char pad[LRMEM_HEADER];
+} lrmem_head_t;
+
+/*
+ * The fields of an arena are only accessed by the thread bound to it, except
+ * released that is updated by the other threads releasing its buffers.
+ */
+typedef struct lrmem_arena_s {
+    pastix_lrmem_t    *pool;                  /* Pool of the arena                             */
+    lrmem_head_t      *heads[LRMEM_CLASSNBR]; /* Free lists of the classes                     */
+    uint64_t           nballoc;               /* Number of allocations                         */
+    uint64_t           nbhit;                 /* Number of allocations served by a free list   */
+    uint64_t           held;                  /* Bytes allocated or cached by the arena        */
+    uint64_t           cached;                /* Bytes kept in the free lists                  */
+    uint64_t           peak;                  /* Peak of the bytes held by the arena           */
+    char               pad[LRMEM_HEADER];     /* Keep released on its own cache line           */
+    volatile uint64_t  released;              /* Bytes of the arena released by other threads  */
+    char               pad2[LRMEM_HEADER];    /* Keep the next arena on another cache line     */
+} lrmem_arena_t;
+
+struct pastix_lrmem_s {
+    int            thrdnbr; /* Number of arenas           */
+    lrmem_arena_t *arenas;  /* Arenas of the threads      */
+};
+
+/*
+ * Key of the arena bound to the calling thread, created with the first pool
+ */
+static pthread_key_t  lrmem_key;
+static pthread_once_t lrmem_once   = PTHREAD_ONCE_INIT;
+static volatile int   lrmem_keyset = 0;
+
+static void
+lrmem_key_init( void )
+{
+    pthread_key_create( &lrmem_key, NULL );
+    lrmem_keyset = 1;
+}
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+/**
+ * @brief Return the class of a buffer of the given size, -1 if it is too large
+ * to be pooled.
+ */
+static inline int
+lrmem_class( size_t size )
+{
+    size_t e, step;
+
+    if ( size <= ((size_t)1 << LRMEM_SHIFT_MIN) ) {
+        return 0;
+    }
+    if ( size > ((size_t)1 << LRMEM_SHIFT_MAX) ) {
+        return -1;
+    }
+
+    /* Find e such that 2^e < size <= 2^(e+1) */
+    e = LRMEM_SHIFT_MIN;
+    while ( ((size_t)1 << (e+1)) < size ) {
+        e++;
+    }
+    step = (size_t)1 << (e - LRMEM_SHIFT_STEP);
+
+    return ( (e - LRMEM_SHIFT_MIN) << LRMEM_SHIFT_STEP )
+        + ( size - ((size_t)1 << e) + step - 1 ) / step;
+}
+
+/**
+ * @brief Return the capacity of the buffers of a class.
+ */
+static inline size_t
+lrmem_class_size( int clsid )
+{
+    size_t e, j;
+
+    if ( clsid == 0 ) {
+        return (size_t)1 << LRMEM_SHIFT_MIN;
+    }
+    e = LRMEM_SHIFT_MIN + ( (clsid - 1) >> LRMEM_SHIFT_STEP );
+    j = ( (clsid - 1) & ((1 << LRMEM_SHIFT_STEP) - 1) ) + 1;
+
+    return ((size_t)1 << e) + j * ((size_t)1 << (e - LRMEM_SHIFT_STEP));
+}
+
+/**
+ * @brief Return the arena bound to the calling thread, NULL if none.
+ */
+static inline lrmem_arena_t *
+lrmem_arena( void )
+{
+    if ( !lrmem_keyset ) {
+        return NULL;
+    }
+    return (lrmem_arena_t *)pthread_getspecific( lrmem_key );
+}
+
+/**
+ * @brief Return the number of bytes in use that are held by an arena.
+ */
+static inline uint64_t
+lrmem_arena_inuse( const lrmem_arena_t *arena )
+{
+    return arena->held - arena->released - arena->cached;
+}
+
+/**
+ * @brief Add bytes to an arena, and update its peak.
+ */
+static inline void
+lrmem_arena_add( lrmem_arena_t *arena,
+                 uint64_t       size )
+{
+    uint64_t held;
+
+    arena->held += size;
+    held = arena->held - arena->released;
+    if ( held > arena->peak ) {
+        arena->peak = held;
+    }
+}
+
+/**
+ * @brief Remove the bytes of a buffer from the arena that holds it.
+ */
+static inline void
+lrmem_arena_sub( lrmem_arena_t *arena,
+                 lrmem_arena_t *owner,
+                 uint64_t       size )
+{
+    if ( owner == arena ) {
+        arena->held -= size;
+    }
+    else {
+        pastix_atomic_add_64b( &(owner->released), size );
+    }
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Allocate a buffer of a low-rank block or of a low-rank kernel.
+ *
+ * If the calling thread is bound to an arena, the buffer is taken from the
+ * free list of its size class when possible. The buffer must be released with
+ * pastix_lrmem_free().
+ *
+ *******************************************************************************
+ *
+ * @param[in] size
+ *          The size in bytes of the buffer.
+ *
+ *******************************************************************************
+ *
+ * @return The allocated buffer, NULL if size is 0 or if the allocation failed.
+ *
+ *******************************************************************************/
+void *
+pastix_lrmem_malloc( size_t size )
+{
+    lrmem_arena_t *arena;
+    lrmem_head_t  *head;
+    int            clsid = -1;
+
+    if ( size == 0 ) {
+        return NULL;
+    }
+
+    arena = lrmem_arena();
+    if ( arena != NULL ) {
+        arena->nballoc++;
+
+        clsid = lrmem_class( size );
+        if ( clsid >= 0 ) {
+            head = arena->heads[clsid];
+            if ( head != NULL ) {
+                arena->heads[clsid] = head->h.next;
+                arena->cached      -= head->h.size + LRMEM_HEADER;
+                arena->nbhit++;
+
+                head->h.next = NULL;
+                return (char*)head + LRMEM_HEADER;
+            }
+            size = lrmem_class_size( clsid );
+        }
+    }
+
+    head = malloc( size + LRMEM_HEADER );
+    if ( head == NULL ) {
+        return NULL;
+    }
+    head->h.next  = NULL;
+    head->h.arena = arena;
+    head->h.size  = size;
+    head->h.clsid = clsid;
+
+    if ( arena != NULL ) {
+        lrmem_arena_add( arena, size + LRMEM_HEADER );
+    }
+    return (char*)head + LRMEM_HEADER;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Release a buffer allocated with pastix_lrmem_malloc().
+ *
+ * If the calling thread is bound to an arena of the pool of the buffer, and if
+ * this arena is not full, the buffer is kept in the free list of its class.
+ * Otherwise, it is returned to the system.
+ *
+ *******************************************************************************
+ *
+ * @param[in] ptr
+ *          The buffer to release. Nothing is done if ptr is NULL.
+ *
+ *******************************************************************************/
+void
+pastix_lrmem_free( void *ptr )
+{
+    lrmem_arena_t *arena, *owner;
+    lrmem_head_t  *head;
+    uint64_t       size, limit;
+
+    if ( ptr == NULL ) {
+        return;
+    }
+
+    head  = (lrmem_head_t *)((char*)ptr - LRMEM_HEADER);
+    owner = head->h.arena;
+    if ( owner == NULL ) {
+        free( head );
+        return;
+    }
+
+    size  = head->h.size + LRMEM_HEADER;
+    arena = lrmem_arena();
+
+    if ( (arena != NULL) && (arena->pool == owner->pool) && (head->h.clsid >= 0) ) {
+        limit = lrmem_arena_inuse( arena ) / LRMEM_CACHE_RATIO;
+        limit = ( limit < LRMEM_CACHE_MIN ) ? LRMEM_CACHE_MIN : limit;
+
+        if ( (arena->cached + size) <= limit ) {
+            /* The buffer is now held by the arena of the calling thread */
+            if ( owner != arena ) {
+                lrmem_arena_sub( arena, owner, size );
+                lrmem_arena_add( arena, size );
+                head->h.arena = arena;
+            }
+            arena->cached += size;
+
+            head->h.next = arena->heads[head->h.clsid];
+            arena->heads[head->h.clsid] = head;
+            return;
+        }
+    }
+
+    lrmem_arena_sub( arena, owner, size );
+    free( head );
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Resize a buffer allocated with pastix_lrmem_malloc().
+ *
+ * The buffer is kept if its capacity is large enough, otherwise a new buffer
+ * is allocated and the content of the previous one is copied in it.
+ *
+ *******************************************************************************
+ *
+ * @param[in] ptr
+ *          The buffer to resize. If NULL, a new buffer is allocated.
+ *
+ * @param[in] size
+ *          The new size in bytes of the buffer.
+ *
+ *******************************************************************************
+ *
+ * @return The resized buffer.
+ *
+ *******************************************************************************/
+void *
+pastix_lrmem_realloc( void  *ptr,
+                      size_t size )
+{
+    lrmem_head_t *head;
+    void         *newptr;
+
+    if ( ptr == NULL ) {
+        return pastix_lrmem_malloc( size );
+    }
+
+    head = (lrmem_head_t *)((char*)ptr - LRMEM_HEADER);
+    if ( head->h.size >= size ) {
+        return ptr;
+    }
+
+    newptr = pastix_lrmem_malloc( size );
+    if ( newptr != NULL ) {
+        memcpy( newptr, ptr, head->h.size );
+        pastix_lrmem_free( ptr );
+    }
+    return newptr;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Create the memory pool of a solver.
+ *
+ *******************************************************************************
+ *
+ * @param[in] thrdnbr
+ *          The number of threads of the scheduler of the solver. One arena is
+ *          created per thread.
+ *
+ *******************************************************************************
+ *
+ * @return The memory pool, to release with pastix_lrmem_exit().
+ *
+ *******************************************************************************/
+pastix_lrmem_t *
+pastix_lrmem_init( int thrdnbr )
+{
+    pastix_lrmem_t *pool;
+    int             i;
+
+    pthread_once( &lrmem_once, lrmem_key_init );
+
+    MALLOC_INTERN( pool, 1, pastix_lrmem_t );
+    MALLOC_INTERN( pool->arenas, thrdnbr, lrmem_arena_t );
+    memset( pool->arenas, 0, thrdnbr * sizeof(lrmem_arena_t) );
+
+    pool->thrdnbr = thrdnbr;
+    for ( i=0; i<thrdnbr; i++ ) {
+        pool->arenas[i].pool = pool;
+    }
+    return pool;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Release the memory pool of a solver.
+ *
+ * All the buffers of the pool must have been released. The buffers kept in the
+ * free lists of the arenas are returned to the system in bulk.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] pool
+ *          The memory pool to release. Nothing is done if pool is NULL.
+ *
+ *******************************************************************************/
+void
+pastix_lrmem_exit( pastix_lrmem_t *pool )
+{
+    lrmem_arena_t *arena;
+    lrmem_head_t  *head, *next;
+    uint64_t       inuse = 0;
+    int            i, c;
+
+    if ( pool == NULL ) {
+        return;
+    }
+
+    arena = pool->arenas;
+    for ( i=0; i<pool->thrdnbr; i++, arena++ ) {
+        for ( c=0; c<LRMEM_CLASSNBR; c++ ) {
+            head = arena->heads[c];
+            while ( head != NULL ) {
+                next = head->h.next;
+                free( head );
+                head = next;
+            }
+        }
+        inuse += lrmem_arena_inuse( arena );
+    }
+    assert( inuse == 0 );
+
+    /* The buffers still in use refer to their arena, that must then be kept */
+    if ( inuse > 0 ) {
+        return;
+    }
+
+    memFree_null( pool->arenas );
+    memFree( pool );
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Bind the calling thread to its arena in the pool of a solver.
+ *
+ * This must be called by each thread of a parallel call of the solver before
+ * allocating low-rank buffers, and with a NULL pool at the end of the call.
+ *
+ *******************************************************************************
+ *
+ * @param[in] pool
+ *          The memory pool of the solver. If NULL, the thread is unbound and
+ *          its buffers are directly allocated by the system.
+ *
+ * @param[in] rank
+ *          The rank of the thread in the scheduler of the solver.
+ *
+ *******************************************************************************/
+void
+pastix_lrmem_bind( pastix_lrmem_t *pool,
+                   int             rank )
+{
+    if ( !lrmem_keyset ) {
+        return;
+    }
+    if ( (pool != NULL) && (rank >= 0) && (rank < pool->thrdnbr) ) {
+        pthread_setspecific( lrmem_key, pool->arenas + rank );
+    }
+    else {
+        pthread_setspecific( lrmem_key, NULL );
+    }
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Merge the statistics of the arenas of a pool.
+ *
+ * The peak is the sum of the peaks of the arenas. It is thus an upper bound of
+ * the peak of the memory held by the pool, which is exact with a single thread.
+ *
+ *******************************************************************************
+ *
+ * @param[in] pool
+ *          The memory pool of the solver.
+ *
+ * @param[out] stats
+ *          On exit, the number of allocations, the number of allocations
+ *          served by the free lists, and the peak in bytes of the memory held
+ *          by the pool.
+ *
+ *******************************************************************************/
+void
+pastix_lrmem_getstats( const pastix_lrmem_t *pool,
+                       uint64_t              stats[3] )
+{
+    const lrmem_arena_t *arena = pool->arenas;
+    int                  i;
+
+    stats[0] = 0;
+    stats[1] = 0;
+    stats[2] = 0;
+    for ( i=0; i<pool->thrdnbr; i++, arena++ ) {
+        stats[0] += arena->nballoc;
+        stats[1] += arena->nbhit;
+        stats[2] += arena->peak;
+    }
+}
@@ -63,6 +63,49 @@ extern double pastix_lr_minratio;
  */
 extern pastix_int_t pastix_lr_ortho;
 
+/**
+ * @brief Define the number of samples drawn at each step of the adaptive
+ * randomized range finder (PastixCompressMethodARRF).
+ */
+#define PASTIX_LR_ARRF_NB 16
+
+/**
+ * @brief Define the minimal margin added to the rank of the previous
+ * factorization to bound the rank of the randomized compression methods when
+ * the rank cache is enabled (IPARM_COMPRESS_RANK_CACHE).
+ */
+#define PASTIX_LR_RKCACHE_MARGIN 8
+
+/**
+ * @brief Define the number of factorizations during which a block found
+ * incompressible is kept in full-rank by the rank cache, before trying to
+ * compress it again.
+ */
+#define PASTIX_LR_RKCACHE_RETRY 4
+
+/**
+ * @brief Memory pool of the low-rank buffers of a solver
+ * (IPARM_COMPRESS_MEM_POOL), with one arena per thread.
+ */
+struct pastix_lrmem_s;
+typedef struct pastix_lrmem_s pastix_lrmem_t;
+
+/**
+ *    @name Memory pool of the low-rank buffers
+ *    @{
+ */
+void *pastix_lrmem_malloc( size_t size );
+void *pastix_lrmem_realloc( void *ptr, size_t size );
+void  pastix_lrmem_free( void *ptr );
+
+pastix_lrmem_t *pastix_lrmem_init( int thrdnbr );
+void            pastix_lrmem_exit( pastix_lrmem_t *pool );
+void            pastix_lrmem_bind( pastix_lrmem_t *pool, int rank );
+void            pastix_lrmem_getstats( const pastix_lrmem_t *pool, uint64_t stats[3] );
+/**
+ *    @}
+ */
+
 /**
  *******************************************************************************
  *
@@ -206,6 +249,10 @@ typedef struct pastix_lr_s {
     int                      compress_preselect;  /**< Enable/disable the compression of preselected blocks */
     int                      use_reltol;          /**< Enable/disable relative tolerance vs absolute one    */
     int                      ilu_lvl;             /**< The ILU levels above which the blocks are originally compressed */
+    int                      compress_deferred;   /**< Enable/disable the deferred accumulation of the updates */
+    pastix_int_t             compress_team_bloknbr; /**< Minimal number of blocks compressed by a thread team   */
+    int                      rank_cache;          /**< Enable/disable the reuse of the ranks of the previous compression */
+    pastix_lrmem_t          *lrmem;               /**< Memory pool of the low-rank buffers, NULL if disabled */
     double                   tolerance;           /**< Absolute compression tolerance                       */
     fct_rradd_t              core_rradd;          /**< Recompression function                               */
     fct_ge2lr_t              core_ge2lr;          /**< Compression function                                 */
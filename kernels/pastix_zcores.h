@@ -24,6 +24,11 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 #define pastix_cblk_lock( cblk_ )    pastix_atomic_lock( &((cblk_)->lock) )
 #define pastix_cblk_unlock( cblk_ )  pastix_atomic_unlock( &((cblk_)->lock) )
+#define pastix_blok_lock( blok_ )    kernels_lock( &((blok_)->lock) )
+#define pastix_blok_unlock( blok_ )  pastix_atomic_unlock( &((blok_)->lock) )
+
+/* Maximal width of the panels handled by cpucblk_zgemmsp_batch() */
+#define PASTIX_GEMMSP_BATCH_WIDTH 8
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 /**
@@ -128,6 +133,20 @@ int core_ztqrcp( double              tol,
                  pastix_complex64_t *work,
                  pastix_int_t        lwork,
                  double             *rwork );
+int core_zarrf( double                    tol,
+                pastix_int_t              maxrank,
+                pastix_int_t              nb,
+                pastix_int_t              m,
+                pastix_int_t              n,
+                const pastix_complex64_t *A,
+                pastix_int_t              lda,
+                const pastix_complex64_t *omega,
+                pastix_int_t              ldo,
+                pastix_complex64_t       *Q,
+                pastix_int_t              ldq,
+                pastix_complex64_t       *work,
+                pastix_int_t              lwork,
+                double                   *normR );
 int core_ztradd( pastix_uplo_t             uplo,
                  pastix_trans_t            trans,
                  pastix_int_t              M,
@@ -147,6 +166,72 @@ int core_zscalo( pastix_trans_t            trans,
                  pastix_int_t              ldd,
                  pastix_complex64_t       *B,
                  pastix_int_t              ldb );
+int core_zscalpiv( pastix_int_t        m,
+                   pastix_complex64_t *Akk,
+                   pastix_complex64_t *Aik,
+                   double              criterion,
+                   int                 llt );
+
+/**
+ *    @}
+ *    @name PastixComplex64 fixed-size kernels for the small blocks
+ *    @{
+ */
+int core_zgeadd_small( pastix_trans_t            trans,
+                       pastix_int_t              M,
+                       pastix_int_t              N,
+                       pastix_complex64_t        alpha,
+                       const pastix_complex64_t *A,
+                       pastix_int_t              lda,
+                       pastix_complex64_t        beta,
+                       pastix_complex64_t       *B,
+                       pastix_int_t              ldb );
+int core_zscalo_small( pastix_trans_t            trans,
+                       pastix_int_t              M,
+                       pastix_int_t              N,
+                       const pastix_complex64_t *A,
+                       pastix_int_t              lda,
+                       const pastix_complex64_t *D,
+                       pastix_int_t              ldd,
+                       pastix_complex64_t       *B,
+                       pastix_int_t              ldb );
+int core_zgemdm_small( pastix_trans_t            transA,
+                       pastix_trans_t            transB,
+                       pastix_int_t              M,
+                       pastix_int_t              N,
+                       pastix_int_t              K,
+                       pastix_complex64_t        alpha,
+                       const pastix_complex64_t *A,
+                       pastix_int_t              lda,
+                       const pastix_complex64_t *B,
+                       pastix_int_t              ldb,
+                       pastix_complex64_t        beta,
+                       pastix_complex64_t       *C,
+                       pastix_int_t              ldc,
+                       const pastix_complex64_t *D,
+                       pastix_int_t              incD );
+int core_zgemm_small( pastix_trans_t            transA,
+                      pastix_trans_t            transB,
+                      pastix_int_t              M,
+                      pastix_int_t              N,
+                      pastix_int_t              K,
+                      pastix_complex64_t        alpha,
+                      const pastix_complex64_t *A,
+                      pastix_int_t              lda,
+                      const pastix_complex64_t *B,
+                      pastix_int_t              ldb,
+                      pastix_complex64_t        beta,
+                      pastix_complex64_t       *C,
+                      pastix_int_t              ldc );
+int core_ztrsm_small( pastix_uplo_t             uplo,
+                      pastix_trans_t            trans,
+                      pastix_diag_t             diag,
+                      pastix_int_t              N,
+                      pastix_int_t              nrhs,
+                      const pastix_complex64_t *A,
+                      pastix_int_t              lda,
+                      pastix_complex64_t       *B,
+                      pastix_int_t              ldb );
 
 /**
  *    @}
@@ -203,6 +288,13 @@ void core_zgetrfsp( pastix_int_t        n,
                     pastix_int_t        lda,
                     pastix_int_t       *nbpivots,
                     double              criterion );
+void core_zgetrfsp_piv( pastix_int_t        n,
+                        pastix_complex64_t *A,
+                        pastix_int_t        lda,
+                        pastix_int_t       *ipiv,
+                        pastix_int_t       *nbpivots,
+                        double              threshold,
+                        double              criterion );
 #if defined(PRECISION_z) || defined(PRECISION_c)
 void core_zhetrfsp( pastix_int_t        n,
                     pastix_complex64_t *A,
@@ -247,6 +339,20 @@ pastix_fixdbl_t cpucblk_zgemmsp( pastix_coefside_t   sideA,
                                  pastix_complex64_t *work,
                                  pastix_int_t        lwork,
                                  const pastix_lr_t  *lowrank );
+pastix_fixdbl_t cpucblk_zgemmsp_lu( const SolverCblk   *cblk,
+                                    const SolverBlok   *blok,
+                                    SolverCblk         *fcblk,
+                                    const void         *L,
+                                    const void         *U,
+                                    pastix_complex64_t *work,
+                                    pastix_int_t        lwork,
+                                    const pastix_lr_t  *lowrank );
+int             cpucblk_zgemmsp_batch( pastix_coefside_t         sideA,
+                                       pastix_trans_t            trans,
+                                       SolverMatrix             *solvmtx,
+                                       const SolverCblk         *cblk,
+                                       const pastix_complex64_t *A,
+                                       const pastix_complex64_t *B );
 void cpucblk_ztrsmsp( pastix_side_t      side,
                       pastix_uplo_t      uplo,
                       pastix_trans_t     trans,
@@ -255,6 +361,23 @@ void cpucblk_ztrsmsp( pastix_side_t      side,
                       const void        *A,
                       void              *C,
                       const pastix_lr_t *lowrank );
+void cpucblk_ztrsmsp_team( SolverMatrix     *solvmtx,
+                           pastix_side_t     side,
+                           pastix_uplo_t     uplo,
+                           pastix_trans_t    trans,
+                           pastix_diag_t     diag,
+                           const SolverCblk *cblk,
+                           const void       *A,
+                           void             *C );
+void cpucblk_ztrsmsp_rows( pastix_side_t             side,
+                           pastix_uplo_t             uplo,
+                           pastix_trans_t            trans,
+                           pastix_diag_t             diag,
+                           const SolverCblk         *cblk,
+                           const pastix_complex64_t *A,
+                           pastix_complex64_t       *C,
+                           pastix_int_t              fstrow,
+                           pastix_int_t              nbrows );
 void cpucblk_zscalo ( pastix_trans_t     trans,
                       SolverCblk        *cblk,
                       void              *dataL,
@@ -270,6 +393,15 @@ pastix_fixdbl_t cpublok_zgemmsp( pastix_trans_t     trans,
                                  const void        *B,
                                  void              *C,
                                  const pastix_lr_t *lowrank );
+void            cpublok_zscatter( const SolverBlok         *fblok,
+                                  const SolverBlok         *lblok,
+                                  SolverCblk               *fcblk,
+                                  const pastix_int_t       *scatmap,
+                                  pastix_int_t              M,
+                                  pastix_int_t              N,
+                                  const pastix_complex64_t *W,
+                                  pastix_complex64_t       *C,
+                                  pastix_int_t              ldc );
 pastix_fixdbl_t cpublok_ztrsmsp( pastix_side_t      side,
                                  pastix_uplo_t      uplo,
                                  pastix_trans_t     trans,
@@ -303,6 +435,14 @@ int cpucblk_zgetrfsp1d      ( SolverMatrix       *solvmtx,
                               SolverCblk         *cblk,
                               pastix_complex64_t *work,
                               pastix_int_t        lwork );
+void cpucblk_zgetrfsp1d_gather( SolverMatrix       *solvmtx,
+                                SolverCblk         *cblk,
+                                pastix_complex64_t *work,
+                                pastix_int_t        lwork );
+int  cpucblk_zgetrfsp1d_ll    ( SolverMatrix       *solvmtx,
+                                SolverCblk         *cblk,
+                                pastix_complex64_t *work,
+                                pastix_int_t        lwork );
 
 /**
  *    @}
@@ -319,6 +459,14 @@ int cpucblk_zpotrfsp1d( SolverMatrix       *solvmtx,
                         SolverCblk         *cblk,
                         pastix_complex64_t *work,
                         pastix_int_t        lwork );
+void cpucblk_zpotrfsp1d_gather( SolverMatrix       *solvmtx,
+                                SolverCblk         *cblk,
+                                pastix_complex64_t *work,
+                                pastix_int_t        lwork );
+int  cpucblk_zpotrfsp1d_ll    ( SolverMatrix       *solvmtx,
+                                SolverCblk         *cblk,
+                                pastix_complex64_t *work,
+                                pastix_int_t        lwork );
 
 /**
  *    @}
@@ -357,6 +505,14 @@ int cpucblk_zpxtrfsp1d( SolverMatrix       *solvmtx,
                         SolverCblk         *cblk,
                         pastix_complex64_t *work,
                         pastix_int_t        lwork );
+void cpucblk_zpxtrfsp1d_gather( SolverMatrix       *solvmtx,
+                                SolverCblk         *cblk,
+                                pastix_complex64_t *work,
+                                pastix_int_t        lwork );
+int  cpucblk_zpxtrfsp1d_ll    ( SolverMatrix       *solvmtx,
+                                SolverCblk         *cblk,
+                                pastix_complex64_t *work,
+                                pastix_int_t        lwork );
 
 /**
  *    @}
@@ -421,6 +577,9 @@ void cpucblk_zadd( pastix_coefside_t  side,
                    const SolverCblk  *cblkA,
                    SolverCblk        *cblkB,
                    const pastix_lr_t *lowrank );
+void cpucblk_zlrflush( pastix_coefside_t  side,
+                       SolverCblk        *cblk,
+                       const pastix_lr_t *lowrank );
 
 /**
  *    @}
@@ -431,6 +590,9 @@ int cpucblk_zincoming_deps( int                mt_flag,
                             pastix_coefside_t  side,
                             SolverMatrix      *solvmtx,
                             SolverCblk        *cblk );
+void cpucblk_zincoming_progress( int                rank,
+                                 pastix_coefside_t  side,
+                                 SolverMatrix      *solvmtx );
 void cpucblk_zrelease_deps( pastix_coefside_t  side,
                             SolverMatrix      *solvmtx,
                             const SolverCblk  *cblk,
@@ -504,9 +666,10 @@ void cpucblk_zrecv_rhs_backward( const SolverMatrix *solvmtx,
  *    @{
  */
 pastix_fixdbl_t cpublok_zcompress( const pastix_lr_t *lowrank,
-                                   pastix_int_t        M,
-                                   pastix_int_t        N,
-                                   pastix_lrblock_t   *blok );
+                                   SolverBlok        *blok,
+                                   pastix_int_t       M,
+                                   pastix_int_t       N,
+                                   pastix_lrblock_t  *lrA );
 pastix_int_t cpucblk_zcompress( const SolverMatrix *solvmtx,
                                 pastix_coefside_t   side,
                                 int                 max_ilulvl,
@@ -97,6 +97,7 @@ typedef struct core_zlrmm_s {
     pastix_int_t            lwork;       /**< The size of the given workspace                                       */
     pastix_int_t            lwused;      /**< The size of the workspace that is already used                        */
     pastix_atomic_lock_t   *lock;        /**< The lock to protect the concurrent accesses on the C matrix           */
+    pastix_lrblock_t      **Cacc;        /**< The accumulator of the deferred updates of C, NULL if applied directly */
 } core_zlrmm_t;
 
 /**
@@ -214,6 +215,11 @@ pastix_fixdbl_t core_zlradd( core_zlrmm_t           *params,
                              const pastix_lrblock_t *AB,
                              pastix_trans_t          transV,
                              int                     infomask );
+pastix_fixdbl_t core_zlrflush( const pastix_lr_t *lowrank,
+                               pastix_int_t       M,
+                               pastix_int_t       N,
+                               pastix_lrblock_t  *C,
+                               pastix_lrblock_t **Cacc );
 
 /**
  *    @}
@@ -303,6 +309,20 @@ pastix_fixdbl_t core_zge2lr_rqrrt( int use_reltol, pastix_fixdbl_t tol, pastix_i
                                    pastix_int_t m, pastix_int_t n,
                                    const void *Avoid, pastix_int_t lda, pastix_lrblock_t *Alr );
 
+pastix_fixdbl_t core_zge2lr_arrf( int use_reltol, pastix_fixdbl_t tol, pastix_int_t rklimit,
+                                  pastix_int_t m, pastix_int_t n,
+                                  const void *Avoid, pastix_int_t lda, pastix_lrblock_t *Alr );
+pastix_fixdbl_t core_zge2lr_arrf_sketch( int use_reltol, pastix_fixdbl_t tol, pastix_int_t rklimit,
+                                         pastix_int_t m, pastix_int_t n,
+                                         const void *Avoid, pastix_int_t lda,
+                                         const pastix_complex64_t *omega, pastix_int_t ldo,
+                                         pastix_lrblock_t *Alr );
+pastix_fixdbl_t core_zge2lr_arrf_stack( int use_reltol, pastix_fixdbl_t tol, pastix_int_t nblk,
+                                        const pastix_int_t *rklimit, const pastix_int_t *offset,
+                                        pastix_int_t n, const pastix_complex64_t *A, pastix_int_t lda,
+                                        const pastix_complex64_t *omega, pastix_int_t ldo,
+                                        pastix_lrblock_t **Alr );
+
 
 pastix_fixdbl_t core_zge2lr_qrcp( core_zrrqr_cp_t rrqrfct,
                                   int use_reltol, pastix_fixdbl_t tol, pastix_int_t rklimit,
@@ -21,6 +21,7 @@
 #include <stdio.h>
 #include "common.h"
 #include "queue.h"
+#include "wsqueue.h"
 
 /**
  *******************************************************************************
@@ -81,9 +82,12 @@ int
 pqueueInit(pastix_queue_t *q,
            pastix_int_t    size)
 {
-    q->size = size;
-    q->used = 0;
-    q->lock = PASTIX_ATOMIC_UNLOCKED;
+    q->size  = size;
+    q->used  = 0;
+    q->lock  = PASTIX_ATOMIC_UNLOCKED;
+    q->type  = PastixSchedQueueHeap;
+    q->owner = pthread_self();
+    q->wsq   = NULL;
     if (q->size != 0)
     {
         MALLOC_INTERN(q->elttab, size, pastix_queue_item_t);
@@ -95,6 +99,61 @@ pqueueInit(pastix_queue_t *q,
     return PASTIX_SUCCESS;
 }
 
+/**
+ *******************************************************************************
+ *
+ * @brief Initialize the queue structure with the given implementation.
+ *
+ * The queue must be initialized by the thread that will own it, as with the
+ * work-stealing implementation, only this thread can use the lock-free fast
+ * path.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] q
+ *          The allocated pointer to the queue to initialize.
+ *
+ * @param[in] type
+ *          The implementation of the queue:
+ *          @arg PastixSchedQueueHeap for a binary heap protected by a lock.
+ *          @arg PastixSchedQueueWorkStealing for lock-free work-stealing deques.
+ *
+ * @param[in] size
+ *          The initial size for the queue.
+ *
+ * @param[in] keymin
+ *          The smallest expected key1. Used only by the work-stealing queue to
+ *          dispatch the elements among the priority buckets.
+ *
+ * @param[in] keymax
+ *          The largest expected key1. Used only by the work-stealing queue to
+ *          dispatch the elements among the priority buckets.
+ *
+ *******************************************************************************
+ *
+ * @retval PASTIX_SUCCESS if success.
+ * @retval PASTIX_ERR_OUTOFMEMORY if malloc failed.
+ *
+ *******************************************************************************/
+int
+pqueueInitType( pastix_queue_t      *q,
+                pastix_sched_queue_t type,
+                pastix_int_t         size,
+                double               keymin,
+                double               keymax )
+{
+    if ( type == PastixSchedQueueHeap ) {
+        return pqueueInit( q, size );
+    }
+
+    /* The heap is only used as an inbox for the non owner threads */
+    pqueueInit( q, 0 );
+    q->type = type;
+
+    MALLOC_INTERN( q->wsq, 1, pastix_wsqueue_t );
+    return wsqueueInit( q->wsq, size, keymin, keymax );
+}
+
 /**
  *******************************************************************************
  *
@@ -114,6 +173,12 @@ pqueueExit(pastix_queue_t *q)
         memFree_null(q->elttab);
     }
     q->size = 0;
+
+    if ( q->wsq != NULL ) {
+        wsqueueExit( q->wsq );
+        memFree_null( q->wsq );
+    }
+    q->type = PastixSchedQueueHeap;
 }
 
 /**
@@ -134,7 +199,10 @@ pqueueExit(pastix_queue_t *q)
 pastix_int_t
 pqueueSize(const pastix_queue_t *q)
 {
-  return q->used;
+    if ( q->wsq != NULL ) {
+        return q->used + wsqueueSize( q->wsq );
+    }
+    return q->used;
 }
 
 /**
@@ -157,7 +225,7 @@ pqueueClear(pastix_queue_t *q)
 /**
  *******************************************************************************
  *
- * @brief Insert an element into the sorted queue.
+ * @brief Insert an element into the sorted binary heap.
  *
  *******************************************************************************
  *
@@ -174,11 +242,11 @@ pqueueClear(pastix_queue_t *q)
  *          The second key of the element.
  *
  *******************************************************************************/
-void
-pqueuePush2(pastix_queue_t *q,
-            pastix_int_t    elt,
-            double          key1,
-            double          key2)
+static inline void
+pqueueHeapPush2(pastix_queue_t *q,
+                pastix_int_t    elt,
+                double          key1,
+                double          key2)
 {
     pastix_atomic_lock( &(q->lock) );
     pastix_int_t i, hi;
@@ -223,7 +291,50 @@ pqueuePush2(pastix_queue_t *q,
 /**
  *******************************************************************************
  *
- * @brief Read the first element of the queue.
+ * @brief Insert an element into the sorted queue.
+ *
+ * With the work-stealing implementation, only the owner of the queue pushes
+ * into the lock-free queue. The other threads push into the heap that is
+ * drained by the owner at its next pop.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] q
+ *          The pointer to the queue.
+ *
+ * @param[in] elt
+ *          The element to insert in the queue.
+ *
+ * @param[in] key1
+ *          The first key of the element.
+ *
+ * @param[in] key2
+ *          The second key of the element.
+ *
+ *******************************************************************************/
+void
+pqueuePush2(pastix_queue_t *q,
+            pastix_int_t    elt,
+            double          key1,
+            double          key2)
+{
+    if ( (q->wsq != NULL) && pthread_equal( q->owner, pthread_self() ) ) {
+        wsqueuePush( q->wsq, elt, key1, key2 );
+        return;
+    }
+    pqueueHeapPush2( q, elt, key1, key2 );
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Read the element that the owner of the queue would pop next, without
+ * removing it.
+ *
+ * This function is used to prefetch the data of the next task, so it never
+ * waits: if the heap is locked, the queue is considered as empty. The returned
+ * element is only a hint as it may be removed by another thread at any time,
+ * or preceded by an element pushed later.
  *
  *******************************************************************************
  *
@@ -232,19 +343,35 @@ pqueuePush2(pastix_queue_t *q,
  *
  *******************************************************************************
  *
- * @return The value of the first element sorted by (key1, key2).
+ * @return The next element of the queue, -1 if the queue is empty or busy.
  *
  *******************************************************************************/
 pastix_int_t
-pqueueRead(const pastix_queue_t *q)
+pqueueRead( pastix_queue_t *q )
 {
-    return q->elttab[0].eltptr;
+    pastix_int_t elt = -1;
+
+    if ( (q->wsq != NULL) && pthread_equal( q->owner, pthread_self() ) ) {
+        elt = wsqueueRead( q->wsq );
+        if ( elt != -1 ) {
+            return elt;
+        }
+    }
+
+    if ( (q->used > 0) && pastix_atomic_trylock( &(q->lock) ) ) {
+        if ( q->used > 0 ) {
+            elt = q->elttab[0].eltptr;
+        }
+        pastix_atomic_unlock( &(q->lock) );
+    }
+    return elt;
 }
 
 /**
  *******************************************************************************
  *
- * @brief Remove the first element of the queue and return its keys if needed.
+ * @brief Remove the first element of the binary heap and return its keys if
+ * needed.
  *
  *******************************************************************************
  *
@@ -264,8 +391,8 @@ pqueueRead(const pastix_queue_t *q)
  * @return The value of the first element sorted by (key1, key2).
  *
  *******************************************************************************/
-pastix_int_t
-pqueuePop2(pastix_queue_t *q, double *key1, double*key2)
+static inline pastix_int_t
+pqueueHeapPop2(pastix_queue_t *q, double *key1, double*key2)
 {
     pastix_atomic_lock( &(q->lock) );
     pastix_int_t i, j;
@@ -273,7 +400,6 @@ pqueuePop2(pastix_queue_t *q, double *key1, double*key2)
 
     if (q->used == 0) {
         pastix_atomic_unlock( &(q->lock) );
-        pastix_yield();
         return -1;
     }
 
@@ -316,6 +442,111 @@ pqueuePop2(pastix_queue_t *q, double *key1, double*key2)
     return return_elt;
 }
 
+/**
+ *******************************************************************************
+ *
+ * @brief Remove the first element of the queue and return its keys if needed.
+ *
+ * With the work-stealing implementation, the owner first moves the elements
+ * pushed by the other threads into its lock-free queue, and then pops the most
+ * recent element of the highest priority bucket. The other threads steal the
+ * oldest element of the highest priority bucket.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] q
+ *          The pointer to the queue. On exit, the queue without its head.
+ *
+ * @param[out] key1
+ *          If key1 != NULL, stores the associated key1 to the first element on
+ *          exit.
+ *
+ * @param[out] key2
+ *          If key2 != NULL, stores the associated key2 to the first element on
+ *          exit.
+ *
+ *******************************************************************************
+ *
+ * @return The value of the first element sorted by (key1, key2), -1 if the
+ *         queue is empty.
+ *
+ *******************************************************************************/
+pastix_int_t
+pqueuePop2(pastix_queue_t *q, double *key1, double*key2)
+{
+    pastix_int_t elt;
+
+    if ( q->wsq == NULL ) {
+        elt = pqueueHeapPop2( q, key1, key2 );
+    }
+    else if ( pthread_equal( q->owner, pthread_self() ) ) {
+        double k1, k2;
+
+        while ( q->used > 0 ) {
+            elt = pqueueHeapPop2( q, &k1, &k2 );
+            if ( elt == -1 ) {
+                break;
+            }
+            wsqueuePush( q->wsq, elt, k1, k2 );
+        }
+        elt = wsqueuePop( q->wsq, key1, key2 );
+    }
+    else {
+        elt = wsqueueSteal( q->wsq, key1, key2 );
+        if ( (elt == -1) && (q->used > 0) ) {
+            elt = pqueueHeapPop2( q, key1, key2 );
+        }
+    }
+
+    if ( elt == -1 ) {
+        pastix_yield();
+    }
+    return elt;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Read the first key of the element that a thief would remove.
+ *
+ * This function is used to select the victim of a steal, so it never waits:
+ * if the heap is locked, the queue is considered as empty. The returned key is
+ * only a hint as the element may be removed by another thread at any time.
+ *
+ *******************************************************************************
+ *
+ * @param[in] q
+ *          The pointer to the queue.
+ *
+ * @param[out] key1
+ *          On exit, the first key of the head of the queue if any.
+ *
+ *******************************************************************************
+ *
+ * @retval 1 if an element has been found.
+ * @retval 0 if the queue is empty or busy.
+ *
+ *******************************************************************************/
+int
+pqueuePeek( pastix_queue_t *q,
+            double         *key1 )
+{
+    int found = 0;
+
+    if ( (q->wsq != NULL) && wsqueuePeek( q->wsq, key1 ) ) {
+        return 1;
+    }
+
+    if ( (q->used > 0) && pastix_atomic_trylock( &(q->lock) ) ) {
+        if ( q->used > 0 ) {
+            *key1 = q->elttab[0].key1;
+            found = 1;
+        }
+        pastix_atomic_unlock( &(q->lock) );
+    }
+    return found;
+}
+
 /**
  *******************************************************************************
  *
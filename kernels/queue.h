@@ -23,6 +23,8 @@
 #ifndef _queue_h_
 #define _queue_h_
 
+#include <pthread.h>
+
 /**
  * @brief Queue item structure.
  */
@@ -32,23 +34,36 @@ typedef struct pastix_queue_item_s {
     pastix_int_t eltptr; /**< Pointer to the element */
 } pastix_queue_item_t;
 
+struct pastix_wsqueue_s;
+
 /**
  * @brief Queue structure.
+ *
+ * With the PastixSchedQueueWorkStealing type, the elements pushed and popped
+ * by the owner thread go through the lock-free work-stealing queue, while the
+ * other threads steal from it. The binary heap is then only used as an inbox
+ * for the elements pushed by non owner threads.
  */
 typedef struct pastix_queue_s {
-    pastix_int_t          size;   /**< Allocated memory size                           */
-    volatile pastix_int_t used;   /**< Number of element in the queue                  */
-    pastix_queue_item_t  *elttab; /**< Array of the element                            */
-    pastix_atomic_lock_t  lock;   /**< Lock for insertion and removal in shared memory */
+    pastix_int_t             size;   /**< Allocated memory size                           */
+    volatile pastix_int_t    used;   /**< Number of element in the queue                  */
+    pastix_queue_item_t     *elttab; /**< Array of the element                            */
+    pastix_atomic_lock_t     lock;   /**< Lock for insertion and removal in shared memory */
+    pastix_sched_queue_t     type;   /**< Implementation of the queue                     */
+    pthread_t                owner;  /**< Thread that initialized the queue               */
+    struct pastix_wsqueue_s *wsq;    /**< Work-stealing queue if type is not the heap     */
 } pastix_queue_t;
 
 int          pqueueInit(        pastix_queue_t *, pastix_int_t );
+int          pqueueInitType(    pastix_queue_t *, pastix_sched_queue_t,
+                                pastix_int_t, double, double );
 void         pqueueExit(        pastix_queue_t * );
 pastix_int_t pqueueSize(  const pastix_queue_t * );
 void         pqueueClear(       pastix_queue_t * );
 void         pqueuePush2(       pastix_queue_t *, pastix_int_t, double, double );
-pastix_int_t pqueueRead ( const pastix_queue_t * );
+pastix_int_t pqueueRead (       pastix_queue_t * );
 pastix_int_t pqueuePop2 (       pastix_queue_t *, double *, double * );
+int          pqueuePeek (       pastix_queue_t *, double * );
 void         pqueuePrint( const pastix_queue_t * );
 
 /**
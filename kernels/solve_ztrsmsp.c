@@ -31,6 +31,59 @@ static pastix_complex64_t  zone =  1.0;
 static pastix_complex64_t mzone = -1.0;
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
+/**
+ *******************************************************************************
+ *
+ * @brief Apply the row interchanges of a diagonal block to the right hand side.
+ *
+ *******************************************************************************
+ *
+ * @param[in] cblk
+ *          The cblk structure to which diagonal block belongs to.
+ *
+ * @param[in] nrhs
+ *          The number of right hand side
+ *
+ * @param[inout] B
+ *          The pointer to the rows of the right hand side facing the cblk.
+ *
+ * @param[in] ldb
+ *          The leading dimension of B
+ *
+ * @param[in] ipiv
+ *          The row interchanges of the diagonal block, 0-based.
+ *
+ * @param[in] forward
+ *          If true, the interchanges are applied in increasing order (P * B),
+ *          otherwise in decreasing order (P^t * B).
+ *
+ *******************************************************************************/
+static inline void
+solve_cblk_zlaswp( const SolverCblk   *cblk,
+                   int                 nrhs,
+                   pastix_complex64_t *B,
+                   pastix_int_t        ldb,
+                   const pastix_int_t *ipiv,
+                   int                 forward )
+{
+    pastix_int_t i, n = cblk_colnbr( cblk );
+
+    if ( forward ) {
+        for (i=0; i<n; i++) {
+            if ( ipiv[i] != i ) {
+                cblas_zswap( nrhs, B + i, ldb, B + ipiv[i], ldb );
+            }
+        }
+    }
+    else {
+        for (i=n-1; i>=0; i--) {
+            if ( ipiv[i] != i ) {
+                cblas_zswap( nrhs, B + i, ldb, B + ipiv[i], ldb );
+            }
+        }
+    }
+}
+
 /**
  *******************************************************************************
  *
@@ -99,6 +152,13 @@ solve_blok_ztrsm( pastix_side_t       side,
         lda = (cblk->cblktype & CBLK_LAYOUT_2D) ? n : cblk->stride;
     }
 
+    if ( (side == PastixLeft) &&
+         (core_ztrsm_small( uplo, trans, diag, n, nrhs,
+                            A, lda, b, ldb ) == PASTIX_SUCCESS) )
+    {
+        return;
+    }
+
     cblas_ztrsm(
         CblasColMajor, (CBLAS_SIDE)side, (CBLAS_UPLO)uplo,
         (CBLAS_TRANSPOSE)trans, (CBLAS_DIAG)diag,
@@ -211,12 +271,18 @@ solve_blok_zgemm( pastix_side_t             side,
             break;
         case -1:
             pastix_cblk_lock( fcbk );
-            cblas_zgemm(
-                CblasColMajor, (CBLAS_TRANSPOSE)trans, CblasNoTrans,
-                m, nrhs, n,
-                CBLAS_SADDR(mzone), lrA->u,   lda,
-                                    B + offB, ldb,
-                CBLAS_SADDR(zone),  C + offC, ldc );
+            if ( core_zgemm_small( trans, PastixNoTrans, m, nrhs, n,
+                                   -1.0, lrA->u,   lda,
+                                         B + offB, ldb,
+                                    1.0, C + offC, ldc ) != PASTIX_SUCCESS )
+            {
+                cblas_zgemm(
+                    CblasColMajor, (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                    m, nrhs, n,
+                    CBLAS_SADDR(mzone), lrA->u,   lda,
+                                        B + offB, ldb,
+                    CBLAS_SADDR(zone),  C + offC, ldc );
+            }
             pastix_cblk_unlock( fcbk );
             break;
         default:
@@ -264,12 +330,18 @@ solve_blok_zgemm( pastix_side_t             side,
         lda = (bowner->cblktype & CBLK_LAYOUT_2D) ? lda : bowner->stride;
 
         pastix_cblk_lock( fcbk );
-        cblas_zgemm(
-            CblasColMajor, (CBLAS_TRANSPOSE)trans, CblasNoTrans,
-            m, nrhs, n,
-            CBLAS_SADDR(mzone), A,        lda,
-                                B + offB, ldb,
-            CBLAS_SADDR(zone),  C + offC, ldc );
+        if ( core_zgemm_small( trans, PastixNoTrans, m, nrhs, n,
+                               -1.0, A,        lda,
+                                     B + offB, ldb,
+                                1.0, C + offC, ldc ) != PASTIX_SUCCESS )
+        {
+            cblas_zgemm(
+                CblasColMajor, (CBLAS_TRANSPOSE)trans, CblasNoTrans,
+                m, nrhs, n,
+                CBLAS_SADDR(mzone), A,        lda,
+                                    B + offB, ldb,
+                CBLAS_SADDR(zone),  C + offC, ldc );
+        }
         pastix_cblk_unlock( fcbk );
     }
 }
@@ -363,6 +435,12 @@ solve_cblk_ztrsmsp_forward( const args_solve_t *enums,
     B   = B + cblk->lcolidx;
     ldb = rhsb->ld;
 
+    /* The lower part of a pivoted diagonal block is P^t * L */
+    if ( (datacode->pivtab != NULL) && (cs == PastixLCoef) ) {
+        solve_cblk_zlaswp( cblk, rhsb->n, B, ldb,
+                           datacode->pivtab + cblk->lcolidx, 1 );
+    }
+
     /* Solve the diagonal block */
     solve_blok_ztrsm( side, PastixLower,
                       tA, diag, cblk, rhsb->n,
@@ -547,6 +625,11 @@ solve_cblk_ztrsmsp_backward( const args_solve_t *enums,
                           cblk_getdata( cblk, cs ),
                           B, ldb );
 
+        /* The lower part of a pivoted diagonal block is P^t * L */
+        if ( (datacode->pivtab != NULL) && (cs == PastixLCoef) ) {
+            solve_cblk_zlaswp( cblk, rhsb->n, B, ldb,
+                               datacode->pivtab + cblk->lcolidx, 0 );
+        }
     }
 
     /* Apply the update */
@@ -0,0 +1,551 @@
+/**
+ *
+ * @file wsqueue.c
+ *
+ * PaStiX work-stealing queue structure.
+ *
+ * @copyright 2004-2023 Bordeaux INP, CNRS (LaBRI UMR 5800), Inria,
+ *                      Univ. Bordeaux. All rights reserved.
+ *
+ * @version 6.3.0
+ * @author Mathieu Faverge
+ * @date 2026-10-17
+ *
+ * @addtogroup blend_dev_queue
+ * @{
+ *
+ **/
+#include "common.h"
+#include "wsqueue.h"
+
+/**
+ *******************************************************************************
+ *
+ * @brief Allocate a circular array of 2^k elements large enough to store size
+ * elements.
+ *
+ *******************************************************************************
+ *
+ * @param[in] size
+ *          The minimal number of elements to store.
+ *
+ *******************************************************************************
+ *
+ * @return The allocated array.
+ *
+ *******************************************************************************/
+static inline pastix_wsarray_t *
+wsarrayAlloc( int64_t size )
+{
+    pastix_wsarray_t *a;
+    int64_t           n = 16;
+
+    while ( n < size ) {
+        n *= 2;
+    }
+
+    MALLOC_INTERN( a, 1, pastix_wsarray_t );
+    MALLOC_INTERN( a->elttab, n, pastix_queue_item_t );
+    a->mask = n - 1;
+    a->prev = NULL;
+    return a;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Double the size of the circular array of a deque.
+ *
+ * The former array is kept in the list of retired arrays, as a thief may still
+ * be reading it. It is freed when the queue is destroyed.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] d
+ *          The deque to extend. Must be called by the owner only.
+ *
+ * @param[in] a
+ *          The current array of the deque.
+ *
+ * @param[in] t
+ *          The current top index of the deque.
+ *
+ * @param[in] b
+ *          The current bottom index of the deque.
+ *
+ *******************************************************************************
+ *
+ * @return The new array of the deque.
+ *
+ *******************************************************************************/
+static inline pastix_wsarray_t *
+wsdequeGrow( pastix_wsdeque_t *d,
+             pastix_wsarray_t *a,
+             int64_t           t,
+             int64_t           b )
+{
+    pastix_wsarray_t *na = wsarrayAlloc( 2 * (a->mask + 1) );
+    int64_t           i;
+
+    for( i=t; i<b; i++ ) {
+        na->elttab[ i & na->mask ] = a->elttab[ i & a->mask ];
+    }
+    na->prev = a;
+
+    /* Make sure the copy is visible before publishing the new array */
+    pastix_mfence();
+    d->array = na;
+    return na;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Remove the bottom element of a deque. Owner only.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] d
+ *          The deque.
+ *
+ * @param[out] item
+ *          On exit, the removed item if any.
+ *
+ *******************************************************************************
+ *
+ * @retval 1 if an element has been removed.
+ * @retval 0 if the deque is empty.
+ *
+ *******************************************************************************/
+static inline int
+wsdequePop( pastix_wsdeque_t    *d,
+            pastix_queue_item_t *item )
+{
+    pastix_wsarray_t *a;
+    int64_t           b, t;
+    int               found = 1;
+
+    /* Quick check without barrier, the top index can only increase */
+    if ( (d->bottom - d->top) <= 0 ) {
+        return 0;
+    }
+
+    b = d->bottom - 1;
+    a = d->array;
+    d->bottom = b;
+    pastix_mfence();
+    t = d->top;
+
+    if ( t > b ) {
+        /* The deque has been emptied by the thieves */
+        d->bottom = b + 1;
+        return 0;
+    }
+
+    *item = a->elttab[ b & a->mask ];
+    if ( t == b ) {
+        /* Last element, race against the thieves */
+        if ( !pastix_atomic_cas_64b( (volatile uint64_t*)&(d->top),
+                                     (uint64_t)t, (uint64_t)(t+1) ) )
+        {
+            found = 0;
+        }
+        d->bottom = b + 1;
+    }
+    return found;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Remove the top element of a deque. Can be called by any thread.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] d
+ *          The deque.
+ *
+ * @param[out] item
+ *          On exit, the removed item if any.
+ *
+ *******************************************************************************
+ *
+ * @retval  1 if an element has been removed.
+ * @retval  0 if the deque is empty.
+ * @retval -1 if the element has been taken by another thread.
+ *
+ *******************************************************************************/
+static inline int
+wsdequeSteal( pastix_wsdeque_t    *d,
+              pastix_queue_item_t *item )
+{
+    pastix_queue_item_t tmp;
+    pastix_wsarray_t   *a;
+    int64_t             b, t;
+
+    t = d->top;
+    pastix_mfence();
+    b = d->bottom;
+    if ( t >= b ) {
+        return 0;
+    }
+
+    a   = d->array;
+    tmp = a->elttab[ t & a->mask ];
+    if ( !pastix_atomic_cas_64b( (volatile uint64_t*)&(d->top),
+                                 (uint64_t)t, (uint64_t)(t+1) ) )
+    {
+        return -1;
+    }
+    *item = tmp;
+    return 1;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Compute the bucket associated to a key.
+ *
+ *******************************************************************************/
+static inline int
+wsqueueBucket( const pastix_wsqueue_t *q,
+               double                  key )
+{
+    double idx = (key - q->keymin) * q->keyscale;
+
+    if ( idx <= 0. ) {
+        return 0;
+    }
+    if ( idx >= (double)(q->nbuckets - 1) ) {
+        return q->nbuckets - 1;
+    }
+    return (int)idx;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Initialize the work-stealing queue structure.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] q
+ *          The allocated pointer to the queue to initialize.
+ *
+ * @param[in] size
+ *          The expected number of elements in the queue.
+ *
+ * @param[in] keymin
+ *          The smallest expected key1 value, mapped to the first bucket.
+ *
+ * @param[in] keymax
+ *          The largest expected key1 value, mapped to the last bucket. Keys
+ *          out of [keymin, keymax] are stored in the first or last bucket.
+ *
+ *******************************************************************************
+ *
+ * @retval PASTIX_SUCCESS if success.
+ *
+ *******************************************************************************/
+int
+wsqueueInit( pastix_wsqueue_t *q,
+             pastix_int_t      size,
+             double            keymin,
+             double            keymax )
+{
+    int i, nbuckets;
+
+    nbuckets = pastix_getenv_get_value_int( "PASTIX_WSQUEUE_NBUCKETS",
+                                            PASTIX_WSQUEUE_NBUCKETS );
+    nbuckets = pastix_imax( 1, nbuckets );
+
+    q->nbuckets = nbuckets;
+    q->keymin   = keymin;
+    q->keyscale = (keymax > keymin) ? (double)nbuckets / (keymax - keymin) : 0.;
+
+    MALLOC_INTERN( q->buckets, nbuckets, pastix_wsdeque_t );
+    for( i=0; i<nbuckets; i++ ) {
+        q->buckets[i].top    = 0;
+        q->buckets[i].bottom = 0;
+        q->buckets[i].array  = wsarrayAlloc( size / nbuckets + 1 );
+    }
+    return PASTIX_SUCCESS;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Free the structure associated to the work-stealing queue.
+ *
+ * All threads must be done with the queue before calling this function.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] q
+ *          The pointer to the queue to free.
+ *
+ *******************************************************************************/
+void
+wsqueueExit( pastix_wsqueue_t *q )
+{
+    pastix_wsarray_t *a, *prev;
+    int i;
+
+    for( i=0; i<q->nbuckets; i++ ) {
+        a = q->buckets[i].array;
+        while( a != NULL ) {
+            prev = a->prev;
+            memFree_null( a->elttab );
+            memFree_null( a );
+            a = prev;
+        }
+    }
+    memFree_null( q->buckets );
+    q->nbuckets = 0;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Return the approximate number of elements in the queue.
+ *
+ *******************************************************************************
+ *
+ * @param[in] q
+ *          The pointer to the queue.
+ *
+ *******************************************************************************
+ *
+ * @return The number of elements in the queue when the function has been
+ *         called.
+ *
+ *******************************************************************************/
+pastix_int_t
+wsqueueSize( const pastix_wsqueue_t *q )
+{
+    pastix_int_t size = 0;
+    int64_t      n;
+    int          i;
+
+    for( i=0; i<q->nbuckets; i++ ) {
+        n = q->buckets[i].bottom - q->buckets[i].top;
+        size += (n > 0) ? n : 0;
+    }
+    return size;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Insert an element into the queue. Owner only.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] q
+ *          The pointer to the queue.
+ *
+ * @param[in] elt
+ *          The element to insert in the queue.
+ *
+ * @param[in] key1
+ *          The first key of the element that defines the bucket.
+ *
+ * @param[in] key2
+ *          The second key of the element.
+ *
+ *******************************************************************************/
+void
+wsqueuePush( pastix_wsqueue_t *q,
+             pastix_int_t      elt,
+             double            key1,
+             double            key2 )
+{
+    pastix_wsdeque_t    *d = q->buckets + wsqueueBucket( q, key1 );
+    pastix_wsarray_t    *a = d->array;
+    pastix_queue_item_t *item;
+    int64_t              b, t;
+
+    b = d->bottom;
+    t = d->top;
+    if ( (b - t) > a->mask ) {
+        a = wsdequeGrow( d, a, t, b );
+    }
+
+    item = a->elttab + (b & a->mask);
+    item->key1   = key1;
+    item->key2   = key2;
+    item->eltptr = elt;
+
+    /* Make sure the item is visible before publishing it */
+    pastix_mfence();
+    d->bottom = b + 1;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Remove the most recent element of the highest priority non empty
+ * bucket. Owner only.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] q
+ *          The pointer to the queue.
+ *
+ * @param[out] key1
+ *          If key1 != NULL, stores the key1 of the removed element on exit.
+ *
+ * @param[out] key2
+ *          If key2 != NULL, stores the key2 of the removed element on exit.
+ *
+ *******************************************************************************
+ *
+ * @return The removed element, -1 if the queue is empty.
+ *
+ *******************************************************************************/
+pastix_int_t
+wsqueuePop( pastix_wsqueue_t *q,
+            double           *key1,
+            double           *key2 )
+{
+    pastix_queue_item_t item;
+    int i;
+
+    for( i=0; i<q->nbuckets; i++ ) {
+        if ( wsdequePop( q->buckets + i, &item ) ) {
+            if (key1 != NULL) { *key1 = item.key1; }
+            if (key2 != NULL) { *key2 = item.key2; }
+            return item.eltptr;
+        }
+    }
+    return -1;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Remove the oldest element of the highest priority non empty bucket.
+ * Can be called by any thread.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] q
+ *          The pointer to the queue.
+ *
+ * @param[out] key1
+ *          If key1 != NULL, stores the key1 of the removed element on exit.
+ *
+ * @param[out] key2
+ *          If key2 != NULL, stores the key2 of the removed element on exit.
+ *
+ *******************************************************************************
+ *
+ * @return The removed element, -1 if the queue is empty.
+ *
+ *******************************************************************************/
+pastix_int_t
+wsqueueSteal( pastix_wsqueue_t *q,
+              double           *key1,
+              double           *key2 )
+{
+    pastix_queue_item_t item;
+    int i, rc;
+
+    for( i=0; i<q->nbuckets; i++ ) {
+        do {
+            rc = wsdequeSteal( q->buckets + i, &item );
+        } while ( rc == -1 );
+
+        if ( rc ) {
+            if (key1 != NULL) { *key1 = item.key1; }
+            if (key2 != NULL) { *key2 = item.key2; }
+            return item.eltptr;
+        }
+    }
+    return -1;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Read the first key of the element that would be stolen next.
+ *
+ * This function does not take any lock, so the returned key is only a hint
+ * and the element may have been removed when the function returns.
+ *
+ *******************************************************************************
+ *
+ * @param[in] q
+ *          The pointer to the queue.
+ *
+ * @param[out] key1
+ *          On exit, the key1 of the oldest element of the highest priority non
+ *          empty bucket if any.
+ *
+ *******************************************************************************
+ *
+ * @retval 1 if an element has been found.
+ * @retval 0 if the queue is empty.
+ *
+ *******************************************************************************/
+int
+wsqueuePeek( const pastix_wsqueue_t *q,
+             double                 *key1 )
+{
+    const pastix_wsdeque_t *d = q->buckets;
+    pastix_wsarray_t       *a;
+    int64_t                 t;
+    int                     i;
+
+    for( i=0; i<q->nbuckets; i++, d++ ) {
+        t = d->top;
+        if ( (d->bottom - t) > 0 ) {
+            a = d->array;
+            *key1 = a->elttab[ t & a->mask ].key1;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Read the element that the owner would pop next. Must be called by the
+ * owner of the queue.
+ *
+ * This function does not take any lock, so the returned element is only a
+ * hint and it may have been stolen when the function returns.
+ *
+ *******************************************************************************
+ *
+ * @param[in] q
+ *          The pointer to the queue.
+ *
+ *******************************************************************************
+ *
+ * @return The most recent element of the highest priority non empty bucket, -1
+ *         if the queue is empty.
+ *
+ *******************************************************************************/
+pastix_int_t
+wsqueueRead( const pastix_wsqueue_t *q )
+{
+    const pastix_wsdeque_t *d = q->buckets;
+    pastix_wsarray_t       *a;
+    int64_t                 b;
+    int                     i;
+
+    for( i=0; i<q->nbuckets; i++, d++ ) {
+        b = d->bottom;
+        if ( (b - d->top) > 0 ) {
+            a = d->array;
+            return a->elttab[ (b-1) & a->mask ].eltptr;
+        }
+    }
+    return -1;
+}
+
+/**
+ *@}
+ */
@@ -0,0 +1,83 @@
+/**
+ *
+ * @file wsqueue.h
+ *
+ * PaStiX work-stealing queue structure header.
+ *
+ * @copyright 2004-2023 Bordeaux INP, CNRS (LaBRI UMR 5800), Inria,
+ *                      Univ. Bordeaux. All rights reserved.
+ *
+ * @version 6.3.0
+ * @author Mathieu Faverge
+ * @date 2026-10-17
+ *
+ * @addtogroup blend_dev_queue
+ * @{
+ *    This module describes the lock-free work-stealing queue used by the
+ *    dynamic scheduler. Each queue is a set of Chase-Lev deques, one per
+ *    priority bucket. The owner thread pushes and pops at the bottom of the
+ *    deques without any lock, while the thieves remove elements from the top
+ *    with a single compare-and-swap. Elements are dispatched among the buckets
+ *    according to their first key, such that the priority order is roughly
+ *    respected: the owner and the thieves always serve the first non empty
+ *    bucket.
+ *
+ **/
+#ifndef _wsqueue_h_
+#define _wsqueue_h_
+
+#include "queue.h"
+
+/**
+ * @brief Default number of priority buckets of a work-stealing queue.
+ */
+#define PASTIX_WSQUEUE_NBUCKETS 32
+
+/**
+ * @brief Circular array storing the elements of a deque.
+ */
+typedef struct pastix_wsarray_s {
+    int64_t                  mask;   /**< Size of the array minus one (size is a power of 2) */
+    pastix_queue_item_t     *elttab; /**< Array of the elements                               */
+    struct pastix_wsarray_s *prev;   /**< Retired array that may still be read by a thief    */
+} pastix_wsarray_t;
+
+/**
+ * @brief Chase-Lev deque.
+ *
+ * The top and bottom indices are stored in different cache lines as the
+ * bottom one is only modified by the owner, while the top one is modified by
+ * the thieves.
+ */
+typedef struct pastix_wsdeque_s {
+    volatile int64_t            top;      /**< Index of the first element, modified by the thieves */
+    char                        pad0[56];
+    volatile int64_t            bottom;   /**< Index of the next free slot, modified by the owner  */
+    pastix_wsarray_t * volatile array;    /**< Current circular array                              */
+    char                        pad1[48];
+} pastix_wsdeque_t;
+
+/**
+ * @brief Work-stealing queue structure.
+ */
+typedef struct pastix_wsqueue_s {
+    double            keymin;   /**< Smallest key mapped to the first bucket               */
+    double            keyscale; /**< Scaling factor from a key to a bucket index           */
+    int               nbuckets; /**< Number of priority buckets                            */
+    pastix_wsdeque_t *buckets;  /**< Array of deques, ordered by decreasing priority       */
+} pastix_wsqueue_t;
+
+int          wsqueueInit (       pastix_wsqueue_t *, pastix_int_t, double, double );
+void         wsqueueExit (       pastix_wsqueue_t * );
+pastix_int_t wsqueueSize ( const pastix_wsqueue_t * );
+void         wsqueuePush (       pastix_wsqueue_t *, pastix_int_t, double, double );
+pastix_int_t wsqueuePop  (       pastix_wsqueue_t *, double *, double * );
+pastix_int_t wsqueueSteal(       pastix_wsqueue_t *, double *, double * );
+int          wsqueuePeek ( const pastix_wsqueue_t *, double * );
+pastix_int_t wsqueueRead ( const pastix_wsqueue_t * );
+
+#endif /* _wsqueue_h_ */
+
+/**
+ * @}
+ */
@@ -77,6 +77,7 @@ struct coeftabinit_s {
     const char          *dirname;  /**< The pointer to the output directory       */
     pastix_coefside_t    side;     /**< The side of the matrix beeing initialized */
     pastix_int_t         mixed;    /**< The mixed-precision parameter             */
+    volatile int32_t     running;  /**< The number of threads still initializing  */
 };
 
 /**
@@ -85,7 +86,9 @@ struct coeftabinit_s {
  * @brief Allocates the entire coeftab matrix with a single allocation.
  *
  * The different cblk coeftabs are assigned inside the
- * allocation, each one with their right size.
+ * allocation, each one with their right size. For the LU factorization, the
+ * upper part of each cblk follows its lower part, as in cpucblk_zalloc(), such
+ * that both parts of a panel are contiguous in memory.
  *
  *******************************************************************************
  *
@@ -99,24 +102,25 @@ coeftabAlloc( pastix_data_t *pastix_data )
 {
     SolverMatrix     *solvmatr = pastix_data->solvmatr;
     SolverCblk       *cblk     = solvmatr->cblktab;
-    pastix_int_t      i, step  = 0;
+    pastix_int_t      i;
     pastix_coeftype_t flttype  = solvmatr->flttype;
     size_t            size     = solvmatr->coefnbr * pastix_size_of( flttype );
-    char             *workL    = NULL;
-    char             *workU    = NULL;
-
-    workL = pastix_malloc_pinned( size );
-    memset( workL, 0, size );
+    size_t            step     = 0;
+    size_t            cblksize;
+    int               nbsides  = 1;
+    char             *work     = NULL;
 
     /* Only allocates the U part if necessary */
     if ( pastix_data->iparm[IPARM_FACTORIZATION] == PastixFactLU ) {
-        workU = pastix_malloc_pinned( size );
-        memset( workU, 0, size );
+        nbsides = 2;
     }
 
+    work = pastix_malloc_pinned( nbsides * size );
+    memset( work, 0, nbsides * size );
+
     /*
      * Assign the cblks to their corresponding index in work
-     * lcoeftabs and ucoeftabs are both one allocation
+     * lcoeftabs and ucoeftabs are both in the same allocation
      */
     for ( i=0; i<solvmatr->cblknbr; i++, cblk++ ) {
 
@@ -125,16 +129,18 @@ coeftabAlloc( pastix_data_t *pastix_data )
             continue;
         }
 
+        cblksize = cblk_colnbr( cblk ) * cblk->stride * pastix_size_of( flttype );
+
         assert( cblk->lcoeftab == NULL );
-        assert( (size_t) (step) < size );
-        cblk->lcoeftab = workL + step;
+        assert( step < nbsides * size );
+        cblk->lcoeftab = work + step;
 
-        if ( pastix_data->iparm[IPARM_FACTORIZATION] == PastixFactLU ) {
+        if ( nbsides == 2 ) {
             assert( cblk->ucoeftab == NULL );
-            cblk->ucoeftab = workU + step;
+            cblk->ucoeftab = work + step + cblksize;
         }
 
-        step += cblk_colnbr( cblk ) * cblk->stride * pastix_size_of( flttype );
+        step += nbsides * cblksize;
     }
 }
 
@@ -146,6 +152,8 @@ coeftabAlloc( pastix_data_t *pastix_data )
  *
  * This routine is the routine called by each thread in the static scheduler and
  * launched by the coeftabinit().
+ * Once its own cblks are initialized, the thread helps the compression of the
+ * large cblks of the other threads (see cpucblk_zcompress()).
  *
  *******************************************************************************
  *
@@ -170,6 +178,7 @@ pcoeftabInit( isched_thread_t *ctx,
     pastix_int_t task;
     int rank = ctx->rank;
 
+    pastix_lrmem_bind( datacode->lowrank.lrmem, rank );
     for (i=0; i < datacode->ttsknbr[rank]; i++)
     {
         task = datacode->ttsktab[rank][i];
@@ -178,6 +187,17 @@ pcoeftabInit( isched_thread_t *ctx,
         /* Init as full rank */
         initfunc[mixed][bcsc->flttype - 2]( side, datacode, bcsc, itercblk, dirname );
     }
+
+    /* Help the compression of the large cblks of the other threads */
+    pastix_atomic_dec_32b( &(ciargs->running) );
+    if ( datacode->lowrank.compress_team_bloknbr > 0 ) {
+        while ( ciargs->running > 0 ) {
+            if ( !solverTeamHelp( (SolverMatrix *)datacode, NULL, 0 ) ) {
+                pastix_yield();
+            }
+        }
+    }
+    pastix_lrmem_bind( NULL, 0 );
 }
 
 /**
@@ -211,6 +231,7 @@ coeftabInit( pastix_data_t    *pastix_data,
     args.bcsc     = pastix_data->bcsc;
     args.side     = side;
     args.mixed    = pastix_data->iparm[IPARM_MIXED];
+    args.running  = pastix_data->isched->world_size;
 
     /* Allocates the coeftab matrix before multi-threading if global allocation is enabled */
     if ( args.datacode->globalalloc )
@@ -287,12 +308,12 @@ coeftabExit( SolverMatrix *solvmtx )
     }
 #endif
 
-    /* If the coeftab is a single allocation, only free the first block */
+    /*
+     * If the coeftab is a single allocation, only free the first block, the
+     * upper part being stored in the same allocation
+     */
     if ( solvmtx->globalalloc ) {
         pastix_free_pinned( solvmtx->cblktab->lcoeftab );
-        if ( solvmtx->cblktab->ucoeftab ) {
-            pastix_free_pinned( solvmtx->cblktab->ucoeftab );
-        }
     }
 
     /* Free arrays of solvmtx */
@@ -317,16 +338,21 @@ coeftabExit( SolverMatrix *solvmtx )
             }
         }
     }
+
+    /* Release the memory pool once all the low-rank blocks have been returned */
+    pastix_lrmem_exit( solvmtx->lowrank.lrmem );
+    solvmtx->lowrank.lrmem = NULL;
 }
 
 /**
  * @brief Internal structure specific to the parallel call of pcoeftabComp()
  */
 struct coeftabcomp_s {
-    SolverMatrix        *solvmtx; /**< The solver matrix               */
-    pastix_coeftype_t    flttype; /**< The arithmetic type             */
-    pastix_atomic_lock_t lock;    /**< Lock to protect the gain update */
-    pastix_int_t         gain;    /**< The memory gain on output       */
+    SolverMatrix        *solvmtx; /**< The solver matrix                      */
+    pastix_coeftype_t    flttype; /**< The arithmetic type                    */
+    pastix_atomic_lock_t lock;    /**< Lock to protect the gain update        */
+    pastix_int_t         gain;    /**< The memory gain on output              */
+    volatile int32_t     running; /**< The number of threads still compressing */
 };
 
 /**
@@ -337,6 +363,8 @@ struct coeftabcomp_s {
  *
  * This routine is the routine called by each thread in the static scheduler and
  * launched by the coeftabCompress().
+ * Once its own cblks are compressed, the thread helps the compression of the
+ * large cblks of the other threads (see cpucblk_zcompress()).
  *
  *******************************************************************************
  *
@@ -380,6 +408,7 @@ pcoeftabComp( isched_thread_t *ctx,
         compfunc = cpucblk_dcompress;
     }
 
+    pastix_lrmem_bind( solvmtx->lowrank.lrmem, rank );
     for (i=0; i < solvmtx->ttsknbr[rank]; i++)
     {
         task     = solvmtx->ttsktab[rank][i];
@@ -394,6 +423,17 @@ pcoeftabComp( isched_thread_t *ctx,
     pastix_atomic_lock( lock );
     *fullgain += gain;
     pastix_atomic_unlock( lock );
+
+    /* Help the compression of the large cblks of the other threads */
+    pastix_atomic_dec_32b( &(ccargs->running) );
+    if ( solvmtx->lowrank.compress_team_bloknbr > 0 ) {
+        while ( ccargs->running > 0 ) {
+            if ( !solverTeamHelp( solvmtx, NULL, 0 ) ) {
+                pastix_yield();
+            }
+        }
+    }
+    pastix_lrmem_bind( NULL, 0 );
 }
 
 /**
@@ -425,6 +465,7 @@ coeftabCompress( pastix_data_t *pastix_data )
     args.flttype = pastix_data->bcsc->flttype;
     args.lock    = PASTIX_ATOMIC_UNLOCKED;
     args.gain    = 0;
+    args.running = pastix_data->isched->world_size;
 
     /* Set the lowrank properties */
     lr = &(pastix_data->solvmatr->lowrank);
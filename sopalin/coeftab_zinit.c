@@ -256,7 +256,12 @@ cpucblk_zinit( pastix_coefside_t    side,
         if ( solvmtx->clustnbr == 1 )
 #endif
         {
-            do { pastix_yield(); } while( cblk->ctrbcnt > 0 );
+            /* Help the compression of the large cblks while waiting */
+            while ( cblk->ctrbcnt > 0 ) {
+                if ( !solverTeamHelp( (SolverMatrix *)solvmtx, NULL, 0 ) ) {
+                    pastix_yield();
+                }
+            }
             coeftabComputeCblkILULevels( solvmtx, cblk );
         }
     }
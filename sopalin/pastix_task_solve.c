@@ -339,6 +339,9 @@ pastix_subtask_trsm( pastix_data_t *pastix_data,
     pastix_check_and_correct_scheduler( pastix_data );
 
     sopalin_data.solvmtx = solvmtx;
+    solvmtx->queuetype   = pastix_data->iparm[IPARM_SCHED_QUEUE];
+    solvmtx->stealpolicy = pastix_data->iparm[IPARM_SCHED_STEAL];
+    solvmtx->idlepolicy  = pastix_data->iparm[IPARM_SCHED_IDLE];
 
     switch (flttype) {
     case PastixComplex64:
@@ -451,6 +454,9 @@ pastix_subtask_diag( pastix_data_t *pastix_data,
     pastix_check_and_correct_scheduler( pastix_data );
 
     sopalin_data.solvmtx = pastix_data->solvmatr;
+    sopalin_data.solvmtx->queuetype   = pastix_data->iparm[IPARM_SCHED_QUEUE];
+    sopalin_data.solvmtx->stealpolicy = pastix_data->iparm[IPARM_SCHED_STEAL];
+    sopalin_data.solvmtx->idlepolicy  = pastix_data->iparm[IPARM_SCHED_IDLE];
 
     switch (flttype) {
     case PastixComplex64:
@@ -573,6 +579,7 @@ pastix_subtask_solve_adv( pastix_data_t  *pastix_data,
         double timer, energy;
 
         papiEnergyStart();
+        solverThrdStatsInit( pastix_data->solvmatr, pastix_data->isched->world_size );
 
         /* Start timer */
         clockSyncStart( timer, pastix_data->inter_node_comm );
@@ -663,6 +670,9 @@ pastix_subtask_solve_adv( pastix_data_t  *pastix_data,
         if ( pastix_data->iparm[IPARM_VERBOSE] > PastixVerboseNot ) {
             pastix_print( pastix_data->inter_node_procnum, 0, OUT_TIME_SOLV,
                           pastix_data->dparm[DPARM_SOLV_TIME] );
+            if ( pastix_data->iparm[IPARM_SCHEDULER] == PastixSchedDynamic ) {
+                solverThrdStatsPrint( pastix_data->solvmatr, pastix_data->inter_node_procnum );
+            }
 #if defined(PASTIX_WITH_PAPI)
             pastix_print( pastix_data->inter_node_procnum, 0, OUT_SOLVE_ENERGY,
                           pastix_print_value_deci( pastix_data->dparm[DPARM_SOLV_ENERGY] ),
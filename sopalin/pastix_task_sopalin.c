@@ -216,6 +216,7 @@ pastix_subtask_bcsc2ctab( pastix_data_t *pastix_data )
     pastix_lr_t     *lr;
     Clock            timer;
     pastix_mtxtype_t mtxtype;
+    int              rkreset;
 
     /*
      * Check parameters
@@ -240,6 +241,23 @@ pastix_subtask_bcsc2ctab( pastix_data_t *pastix_data )
 
     /* Initialize low-rank parameters */
     lr = &(pastix_data->solvmatr->lowrank);
+
+    /*
+     * The ranks of the previous factorization are forgotten if the rank cache
+     * was disabled, or if the parameters that define the ranks have changed.
+     */
+    rkreset = pastix_data->iparm[IPARM_COMPRESS_RANK_CACHE] &&
+        ( !lr->rank_cache ||
+          ( lr->compress_when   != (pastix_compress_when_t)pastix_data->iparm[IPARM_COMPRESS_WHEN] ) ||
+          ( lr->compress_method != (pastix_compress_method_t)pastix_data->iparm[IPARM_COMPRESS_METHOD] ) ||
+          ( lr->compress_min_width  != pastix_data->iparm[IPARM_COMPRESS_MIN_WIDTH] ) ||
+          ( lr->compress_min_height != pastix_data->iparm[IPARM_COMPRESS_MIN_HEIGHT] ) ||
+          ( lr->compress_preselect  != pastix_data->iparm[IPARM_COMPRESS_PRESELECT] ) ||
+          ( lr->ilu_lvl         != pastix_data->iparm[IPARM_COMPRESS_ILUK] ) ||
+          ( lr->use_reltol      != pastix_data->iparm[IPARM_COMPRESS_RELTOL] ) ||
+          ( lr->tolerance       != pastix_data->dparm[DPARM_COMPRESS_TOLERANCE] ) ||
+          ( pastix_lr_minratio  != pastix_data->dparm[DPARM_COMPRESS_MIN_RATIO] ) );
+
     lr->compress_when       = pastix_data->iparm[IPARM_COMPRESS_WHEN];
     lr->compress_method     = pastix_data->iparm[IPARM_COMPRESS_METHOD];
     lr->compress_min_width  = pastix_data->iparm[IPARM_COMPRESS_MIN_WIDTH];
@@ -248,6 +266,27 @@ pastix_subtask_bcsc2ctab( pastix_data_t *pastix_data )
     lr->use_reltol          = pastix_data->iparm[IPARM_COMPRESS_RELTOL];
     lr->tolerance           = pastix_data->dparm[DPARM_COMPRESS_TOLERANCE];
     lr->ilu_lvl             = pastix_data->iparm[IPARM_COMPRESS_ILUK];
+    /* The blocks are shared with the idle threads of the internal schedulers only */
+    lr->compress_team_bloknbr = isSchedRuntime( pastix_data->iparm[IPARM_SCHEDULER] ) ?
+        0 : pastix_data->iparm[IPARM_COMPRESS_TEAM_BLOKNBR];
+    lr->rank_cache          = pastix_data->iparm[IPARM_COMPRESS_RANK_CACHE];
+
+    if ( rkreset ) {
+        SolverBlok  *blok = pastix_data->solvmatr->bloktab;
+        pastix_int_t i;
+
+        for (i=0; i<pastix_data->solvmatr->bloknbr; i++, blok++) {
+            blok->rkcache[0] = -2;
+            blok->rkcache[1] = -2;
+            blok->rkskip[0]  = 0;
+            blok->rkskip[1]  = 0;
+            blok->rktime[0]  = 0.;
+            blok->rktime[1]  = 0.;
+        }
+    }
+    kernels_rkcache_stats[0] = 0;
+    kernels_rkcache_stats[1] = 0;
+    kernels_rkcache_stats[2] = 0;
 
     pastix_lr_minratio      = pastix_data->dparm[DPARM_COMPRESS_MIN_RATIO];
     pastix_lr_ortho         = pastix_data->iparm[IPARM_COMPRESS_ORTHO];
@@ -321,6 +360,14 @@ pastix_subtask_bcsc2ctab( pastix_data_t *pastix_data )
         coeftabExit( pastix_data->solvmatr );
     }
 
+    /* The memory pool of the low-rank buffers has been released with the coefficients */
+    assert( lr->lrmem == NULL );
+    if ( pastix_data->iparm[IPARM_COMPRESS_MEM_POOL] &&
+         ( pastix_data->iparm[IPARM_COMPRESS_WHEN] != PastixCompressNever ) )
+    {
+        lr->lrmem = pastix_lrmem_init( pastix_data->isched->world_size );
+    }
+
     coeftabInit( pastix_data,
                  pastix_data->iparm[IPARM_FACTORIZATION] == PastixFactLU ? PastixLUCoef : PastixLCoef );
 
@@ -382,6 +429,44 @@ pastix_subtask_bcsc2ctab( pastix_data_t *pastix_data )
     return PASTIX_SUCCESS;
 }
 
+/**
+ *******************************************************************************
+ *
+ * @brief Print the distribution of the static pivots among the cblks.
+ *
+ *******************************************************************************
+ *
+ * @param[in] pastix_data
+ *          The pastix_data structure that describes the solver instance.
+ *
+ * @param[in] solvmtx
+ *          The solver matrix structure that holds the number of static pivots
+ *          of each cblk during the last factorization.
+ *
+ *******************************************************************************/
+static inline void
+sopalin_print_cblkpivots( const pastix_data_t *pastix_data,
+                          const SolverMatrix  *solvmtx )
+{
+    const pastix_int_t *cblkpivots = solvmtx->cblkpivots;
+    pastix_int_t        i;
+    long                stats_l[2] = { 0, 0 };
+    long                stats_g[2] = { 0, 0 };
+
+    for( i=0; i<solvmtx->cblknbr; i++, cblkpivots++ ) {
+        if ( *cblkpivots > 0 ) {
+            stats_l[0]++;
+            stats_l[1] = pastix_imax( stats_l[1], *cblkpivots );
+        }
+    }
+
+    MPI_Reduce( stats_l,   stats_g,   1, MPI_LONG, MPI_SUM, 0, pastix_data->inter_node_comm );
+    MPI_Reduce( stats_l+1, stats_g+1, 1, MPI_LONG, MPI_MAX, 0, pastix_data->inter_node_comm );
+
+    pastix_print( pastix_data->inter_node_procnum, 0, OUT_SOPALIN_CBLKPIVOTS,
+                  stats_g[0], stats_g[1] );
+}
+
 /**
  *******************************************************************************
  *
@@ -484,6 +569,44 @@ pastix_subtask_sopalin( pastix_data_t *pastix_data )
 
         sopalin_data.solvmtx->diagthreshold = threshold;
         sopalin_data.solvmtx->nbpivots      = 0;
+        if ( sopalin_data.solvmtx->cblkpivots == NULL ) {
+            MALLOC_INTERN( sopalin_data.solvmtx->cblkpivots,
+                           sopalin_data.solvmtx->cblknbr, pastix_int_t );
+        }
+        memset( sopalin_data.solvmtx->cblkpivots, 0,
+                sopalin_data.solvmtx->cblknbr * sizeof(pastix_int_t) );
+        /* The partial pivoting is only available for the LU factorization */
+        sopalin_data.solvmtx->pivthreshold  = ( (iparm[IPARM_FACTORIZATION] == PastixFactLU) &&
+                                                (pastix_data->sched != PastixSchedStarPU) ) ?
+            dparm[DPARM_PIVOT_THRESHOLD] : 0.;
+        if ( sopalin_data.solvmtx->pivthreshold > 0. ) {
+            if ( sopalin_data.solvmtx->pivtab == NULL ) {
+                MALLOC_INTERN( sopalin_data.solvmtx->pivtab,
+                               sopalin_data.solvmtx->nodenbr, pastix_int_t );
+            }
+        }
+        else if ( sopalin_data.solvmtx->pivtab != NULL ) {
+            memFree_null( sopalin_data.solvmtx->pivtab );
+        }
+        sopalin_data.solvmtx->lufused       = ( iparm[IPARM_FACTORIZATION] == PastixFactLU ) &&
+            iparm[IPARM_FACTO_LU_FUSED];
+        sopalin_data.solvmtx->queuetype     = iparm[IPARM_SCHED_QUEUE];
+        sopalin_data.solvmtx->stealpolicy   = iparm[IPARM_SCHED_STEAL];
+        sopalin_data.solvmtx->idlepolicy    = iparm[IPARM_SCHED_IDLE];
+        /* The left-looking algorithm of the internal schedulers is shared memory only */
+        sopalin_data.solvmtx->lookside      = ( sopalin_data.solvmtx->clustnbr > 1 ) ?
+            PastixFactRightLooking : iparm[IPARM_FACTO_LOOK_SIDE];
+        sopalin_data.solvmtx->lookahead     = iparm[IPARM_SCHED_LOOKAHEAD];
+        /* Only the threads of the static scheduler wait for their dependencies */
+        sopalin_data.solvmtx->teamwidth     = ( pastix_data->sched == PastixSchedStatic ) ?
+            iparm[IPARM_SCHED_TEAM_WIDTH] : 0;
+        sopalin_data.solvmtx->team          = NULL;
+        sopalin_data.solvmtx->teamhelpers   = 0;
+        sopalin_data.solvmtx->prefetch      = iparm[IPARM_SCHED_PREFETCH];
+        /* The deferred updates are flushed when the dependencies of the internal schedulers are released */
+        sopalin_data.solvmtx->lowrank.compress_deferred = iparm[IPARM_COMPRESS_DEFERRED] &&
+            !isSchedRuntime( pastix_data->sched );
+        solverThrdStatsInit( sopalin_data.solvmtx, pastix_data->isched->world_size );
 
         sopalin_data.cpu_coefs = &(pastix_data->cpu_models->coefficients[bcsc->flttype-2]);
         sopalin_data.gpu_coefs = &(pastix_data->gpu_models->coefficients[bcsc->flttype-2]);
@@ -540,6 +663,33 @@ pastix_subtask_sopalin( pastix_data_t *pastix_data )
                           pastix_print_value( flops_g ),
                           pastix_print_unit(  flops_g ),
                           (long)pastix_data->iparm[IPARM_STATIC_PIVOTING] );
+            if ( pastix_data->iparm[IPARM_STATIC_PIVOTING] > 0 ) {
+                sopalin_print_cblkpivots( pastix_data, sopalin_data.solvmtx );
+            }
+            if ( iparm[IPARM_SCHEDULER] == PastixSchedDynamic ) {
+                solverThrdStatsPrint( sopalin_data.solvmtx, pastix_data->inter_node_procnum );
+            }
+            if ( kernels_lock_stats[0] > 0 ) {
+                pastix_print( pastix_data->inter_node_procnum, 0, OUT_KERNELS_LOCKWAIT,
+                              (long)(kernels_lock_stats[0]),
+                              pastix_data->dparm[DPARM_FACT_LOCKWAIT] );
+            }
+            if ( sopalin_data.solvmtx->lowrank.rank_cache ) {
+                pastix_print( pastix_data->inter_node_procnum, 0, OUT_LOWRANK_RKCACHE,
+                              (long)(kernels_rkcache_stats[0]),
+                              (long)(kernels_rkcache_stats[1]),
+                              pastix_data->dparm[DPARM_FACT_RKCACHE_SAVED] );
+            }
+            if ( sopalin_data.solvmtx->lowrank.lrmem != NULL ) {
+                uint64_t lrmem_stats[3];
+
+                pastix_lrmem_getstats( sopalin_data.solvmtx->lowrank.lrmem, lrmem_stats );
+                pastix_print( pastix_data->inter_node_procnum, 0, OUT_LOWRANK_MEMPOOL,
+                              pastix_print_value( pastix_data->dparm[DPARM_MEM_LR_PEAK] ),
+                              pastix_print_unit(  pastix_data->dparm[DPARM_MEM_LR_PEAK] ),
+                              (long)(lrmem_stats[1]),
+                              (long)(lrmem_stats[0]) );
+            }
 #if defined(PASTIX_WITH_PAPI)
             pastix_print( pastix_data->inter_node_procnum, 0, OUT_SOPALIN_ENERGY,
                           pastix_print_value_deci( pastix_data->dparm[DPARM_FACT_ENERGY] ),
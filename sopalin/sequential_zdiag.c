@@ -210,7 +210,8 @@ thread_zdiag_dynamic( isched_thread_t *ctx,
     tasknbr = datacode->ttsknbr[rank];
     tasktab = datacode->ttsktab[rank];
     computeQueue = datacode->computeQueue[rank];
-    pqueueInit( computeQueue, tasknbr );
+    pqueueInitType( computeQueue, datacode->queuetype, tasknbr,
+                    0., (double)(datacode->tasknbr) );
     cblknbr = (mode == PastixSolvModeSchur) ? datacode->cblknbr : datacode->cblkschur;
 
     for (ii=0; ii<tasknbr; ii++) {
@@ -236,8 +237,7 @@ thread_zdiag_dynamic( isched_thread_t *ctx,
                 pastix_atomic_sub_32b( &(arg->taskcnt), local_taskcnt );
                 local_taskcnt = 0;
             }
-            cblknum = stealQueue( datacode, rank,
-                                  ctx->global_ctx->world_size );
+            cblknum = stealQueue( datacode, ctx );
         }
         if( cblknum != -1 ){
             cblk = datacode->cblktab + cblknum;
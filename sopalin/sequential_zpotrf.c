@@ -63,10 +63,16 @@ sequential_zpotrf( pastix_data_t  *pastix_data,
         lwork = pastix_imax( lwork, 2 * datacode->blokmax );
     }
     MALLOC_INTERN( work, lwork, pastix_complex64_t );
+    pastix_lrmem_bind( datacode->lowrank.lrmem, 0 );
 
     cblk = datacode->cblktab;
     for (i=0; i<datacode->cblknbr; i++, cblk++){
         if ( cblk->cblktype & CBLK_IN_SCHUR ) {
+            /* In left-looking, the Schur complement pulls its contributions */
+            if ( datacode->lookside == PastixFactLeftLooking ) {
+                cpucblk_zpotrfsp1d_gather( datacode, cblk, work, lwork );
+                continue;
+            }
             break;
         }
 
@@ -78,10 +84,17 @@ sequential_zpotrf( pastix_data_t  *pastix_data,
         }
 
         /* Compute */
-        cpucblk_zpotrfsp1d( datacode, cblk,
-                            work, lwork );
+        if ( datacode->lookside == PastixFactLeftLooking ) {
+            cpucblk_zpotrfsp1d_ll( datacode, cblk,
+                                   work, lwork );
+        }
+        else {
+            cpucblk_zpotrfsp1d( datacode, cblk,
+                                work, lwork );
+        }
     }
 
+    pastix_lrmem_bind( NULL, 0 );
     memFree_null( work );
 }
 
@@ -108,7 +121,8 @@ thread_zpotrf_static( isched_thread_t *ctx, void *args )
     Task               *t;
     pastix_complex64_t *work;
     pastix_int_t i, ii, lwork;
-    pastix_int_t tasknbr, *tasktab;
+    pastix_int_t tasknbr, *tasktab, first;
+    int8_t      *done = NULL;
     int rank = ctx->rank;
 
     lwork = datacode->gemmmax;
@@ -118,31 +132,72 @@ thread_zpotrf_static( isched_thread_t *ctx, void *args )
         lwork = pastix_imax( lwork, 2 * datacode->blokmax );
     }
     MALLOC_INTERN( work, lwork, pastix_complex64_t );
+    pastix_lrmem_bind( datacode->lowrank.lrmem, rank );
 
     tasknbr = datacode->ttsknbr[rank];
     tasktab = datacode->ttsktab[rank];
+    if ( (datacode->lookahead > 0) && (tasknbr > 0) ) {
+        MALLOC_INTERN( done, tasknbr, int8_t );
+        memset( done, 0, tasknbr * sizeof(int8_t) );
+    }
 
-    for (ii=0; ii<tasknbr; ii++) {
+    first = 0;
+    while ( first < tasknbr ) {
+        ii = solverStaticNext( datacode, rank, &first, done );
+        if ( ii == -1 ) {
+            /* None of the tasks of the lookahead window is ready */
+            if ( !solverTeamHelp( datacode, work, lwork ) ) {
+                cpucblk_zincoming_progress( rank, PastixLCoef, datacode );
+            }
+            continue;
+        }
         i = tasktab[ii];
         t = datacode->tasktab + i;
         cblk = datacode->cblktab + t->cblknum;
 
-        if ( cblk->cblktype & CBLK_IN_SCHUR ) {
-            continue;
+        /* Help the large panels while waiting for the contributions */
+        if ( datacode->teamwidth > 0 ) {
+            while ( !(cblk->cblktype & (CBLK_FANIN | CBLK_RECV | CBLK_IN_SCHUR)) &&
+                    (cblk->ctrbcnt > 0) )
+            {
+                if ( !solverTeamHelp( datacode, work, lwork ) ) {
+                    cpucblk_zincoming_progress( rank, PastixLCoef, datacode );
+                }
+            }
         }
 
         /* Wait for incoming dependencies */
-        if ( cpucblk_zincoming_deps( rank, PastixLCoef,
+        if ( ( !(cblk->cblktype & CBLK_IN_SCHUR) ||
+               (datacode->lookside == PastixFactLeftLooking) ) &&
+             cpucblk_zincoming_deps( rank, PastixLCoef,
                                      datacode, cblk ) )
         {
             continue;
         }
 
+        if ( cblk->cblktype & CBLK_IN_SCHUR ) {
+            /* In left-looking, the Schur complement pulls its contributions */
+            if ( datacode->lookside == PastixFactLeftLooking ) {
+                cpucblk_zpotrfsp1d_gather( datacode, cblk, work, lwork );
+            }
+            continue;
+        }
+
         /* Compute */
-        cpucblk_zpotrfsp1d( datacode, cblk,
-                            work, lwork );
+        if ( datacode->lookside == PastixFactLeftLooking ) {
+            cpucblk_zpotrfsp1d_ll( datacode, cblk,
+                                   work, lwork );
+        }
+        else {
+            cpucblk_zpotrfsp1d( datacode, cblk,
+                                work, lwork );
+        }
     }
 
+    if ( done != NULL ) {
+        memFree_null( done );
+    }
+    pastix_lrmem_bind( NULL, 0 );
     memFree_null( work );
 }
 
@@ -176,6 +231,130 @@ struct args_zpotrf_t
     volatile int32_t    taskcnt;
 };
 
+/**
+ *******************************************************************************
+ *
+ * @brief Execute one task of the dynamic scheduler.
+ *
+ * The 1D cblks are factorized and applied to the trailing submatrix in a
+ * single task. The 2D cblks are split into: the factorization of the diagonal
+ * block, the TRSMs of each set of off-diagonal blocks facing the same cblk,
+ * and the updates generated by each off-diagonal block. Each stage is
+ * submitted by the thread that completes the last task of the previous one.
+ *
+ *******************************************************************************
+ *
+ * @param[inout] datacode
+ *          The solver matrix structure.
+ *
+ * @param[inout] queue
+ *          The queue of the calling thread.
+ *
+ * @param[in] rank
+ *          The rank of the calling thread.
+ *
+ * @param[in] elt
+ *          The element popped from the queues that encodes the task.
+ *
+ * @param[inout] work
+ *          Temporary memory buffer.
+ *
+ * @param[in] lwork
+ *          Temporary workspace dimension.
+ *
+ *******************************************************************************
+ *
+ * @return 1 if the task completed the processing of a cblk, 0 otherwise.
+ *
+ *******************************************************************************/
+static inline int
+zpotrf_dynamic_task( SolverMatrix       *datacode,
+                     pastix_queue_t     *queue,
+                     int                 rank,
+                     pastix_int_t        elt,
+                     pastix_complex64_t *work,
+                     pastix_int_t        lwork )
+{
+    SolverCblk  *cblk, *fcblk;
+    SolverBlok  *blok;
+    pastix_int_t num = elt;
+
+    switch( solver_task_decode( datacode, &num ) ) {
+    case SolverTaskCblk:
+        cblk = datacode->cblktab + num;
+
+        /*
+         * In left-looking, the cblk gathers its updates before its
+         * factorization, and the Schur complement is a task on its own.
+         */
+        if ( datacode->lookside == PastixFactLeftLooking ) {
+            cblk->threadid = rank;
+            if ( cblk->cblktype & CBLK_IN_SCHUR ) {
+                cpucblk_zpotrfsp1d_gather( datacode, cblk, work, lwork );
+            }
+            else {
+                cpucblk_zpotrfsp1d_ll( datacode, cblk, work, lwork );
+            }
+            return 1;
+        }
+
+        if ( cblk->cblktype & CBLK_IN_SCHUR ) {
+            return 0;
+        }
+        cblk->threadid = rank;
+
+        if ( !(cblk->cblktype & CBLK_TASKS_2D) ) {
+            cpucblk_zpotrfsp1d( datacode, cblk,
+                                work, lwork );
+            return 1;
+        }
+
+        cpucblk_zpotrfsp1d_potrf( datacode, cblk,
+                                  cblk_getdataL( cblk ) );
+        return solverSubmit2DTasks( datacode, queue, cblk, SolverTaskTrsm ) ? 0 : 1;
+
+    case SolverTaskTrsm:
+        blok = datacode->bloktab + num;
+        cblk = datacode->cblktab + blok->lcblknm;
+
+        cpublok_ztrsmsp( PastixRight, PastixLower,
+                         PastixConjTrans, PastixNonUnit,
+                         cblk, blok - cblk->fblokptr,
+                         cblk_getdataL( cblk ),
+                         blok_getdata( cblk, blok, PastixLCoef, PastixComplex64 ),
+                         &(datacode->lowrank) );
+
+        /* The last TRSM submits the updates */
+        if ( pastix_atomic_dec_32b( &(cblk->subtasks) ) ) {
+            return 0;
+        }
+        solverSubmit2DTasks( datacode, queue, cblk, SolverTaskGemm );
+        return 0;
+
+    case SolverTaskGemm:
+        blok  = datacode->bloktab + num;
+        cblk  = datacode->cblktab + blok->lcblknm;
+        fcblk = datacode->cblktab + blok->fcblknm;
+
+        if ( fcblk->cblktype & CBLK_FANIN ) {
+            cpucblk_zalloc( PastixLCoef, fcblk );
+        }
+
+        cpucblk_zgemmsp( PastixLCoef, PastixConjTrans,
+                         cblk, blok, fcblk,
+                         cblk_getdataL( cblk ), cblk_getdataL( cblk ),
+                         cblk_getdataL( fcblk ),
+                         work, lwork, &(datacode->lowrank) );
+
+        cpucblk_zrelease_deps( PastixLCoef, datacode, cblk, fcblk );
+
+        /* The last update releases the cblk */
+        return pastix_atomic_dec_32b( &(cblk->subtasks) ) ? 0 : 1;
+    }
+
+    return 0;
+}
+
 /**
  *******************************************************************************
  *
@@ -201,7 +380,7 @@ thread_zpotrf_dynamic( isched_thread_t *ctx, void *args )
     pastix_queue_t       *computeQueue;
     pastix_complex64_t   *work;
     pastix_int_t          i, ii, lwork;
-    pastix_int_t          tasknbr, *tasktab, cblknum;
+    pastix_int_t          tasknbr, *tasktab, elt;
     int32_t               local_taskcnt = 0;
     int                   rank = ctx->rank;
 
@@ -212,12 +391,14 @@ thread_zpotrf_dynamic( isched_thread_t *ctx, void *args )
         lwork = pastix_imax( lwork, 2 * datacode->blokmax );
     }
     MALLOC_INTERN( work, lwork, pastix_complex64_t );
+    pastix_lrmem_bind( datacode->lowrank.lrmem, rank );
     MALLOC_INTERN( datacode->computeQueue[rank], 1, pastix_queue_t );
 
     tasknbr      = datacode->ttsknbr[rank];
     tasktab      = datacode->ttsktab[rank];
     computeQueue = datacode->computeQueue[rank];
-    pqueueInit( computeQueue, tasknbr );
+    pqueueInitType( computeQueue, datacode->queuetype, tasknbr,
+                    0., (double)(datacode->tasknbr) );
 
     /* Initialize the local task queue with available cblks */
     for (ii=0; ii<tasknbr; ii++) {
@@ -226,52 +407,54 @@ thread_zpotrf_dynamic( isched_thread_t *ctx, void *args )
 
         if ( !(t->ctrbcnt) ) {
             cblk = datacode->cblktab + t->cblknum;
-            assert( t->prionum == cblk->priority );
             pqueuePush1( computeQueue, t->cblknum, cblk->priority );
         }
     }
 
     /* Make sure that all computeQueues are allocated */
     isched_barrier_wait( &(ctx->global_ctx->barrier) );
+    solverCacheStart( datacode, rank );
 
     while( arg->taskcnt > 0 )
     {
-        cblknum = pqueuePop(computeQueue);
+        elt = pqueuePop(computeQueue);
 
 #if defined(PASTIX_WITH_MPI)
         /* Nothing to do, let's make progress on communications */
-        if( cblknum == -1 ) {
+        if( elt == -1 ) {
             cpucblk_zmpi_progress( PastixLCoef, datacode, rank );
-            cblknum = pqueuePop(computeQueue);
+            elt = pqueuePop(computeQueue);
         }
 #endif
 
         /* No more local job, let's steal our neighbors */
-        if( cblknum == -1 ) {
+        if( elt == -1 ) {
             if ( local_taskcnt ) {
-                pastix_atomic_sub_32b( &(arg->taskcnt), local_taskcnt );
+                if ( !pastix_atomic_sub_32b( &(arg->taskcnt), local_taskcnt ) ) {
+                    solverIdleWakeup( datacode, 1 );
+                }
                 local_taskcnt = 0;
             }
-            cblknum = stealQueue( datacode, rank,
-                                  ctx->global_ctx->world_size );
+            elt = stealQueue( datacode, ctx );
         }
 
-        /* Still no job, let's loop again */
-        if ( cblknum == -1 ) {
-            continue;
-        }
-
-        cblk = datacode->cblktab + cblknum;
-        if ( cblk->cblktype & CBLK_IN_SCHUR ) {
+        /* Still no job, help a large cblk or wait, and loop again */
+        if ( elt == -1 ) {
+            if ( !solverTeamHelp( datacode, work, lwork ) ) {
+                solverIdleWait( datacode, rank, &(arg->taskcnt) );
+            }
             continue;
         }
-        cblk->threadid = rank;
+        solverIdleStop( datacode, rank );
+        solverPrefetchNext( datacode, computeQueue );
 
         /* Compute */
-        cpucblk_zpotrfsp1d( datacode, cblk,
-                            work, lwork );
-        local_taskcnt++;
+        local_taskcnt += zpotrf_dynamic_task( datacode, computeQueue, rank,
+                                              elt, work, lwork );
     }
+    solverIdleStop( datacode, rank );
+    solverCacheStop( datacode, rank );
+    pastix_lrmem_bind( NULL, 0 );
     memFree_null( work );
 
     /* Make sure that everyone is done before freeing */
@@ -299,8 +482,15 @@ dynamic_zpotrf( pastix_data_t  *pastix_data,
                 sopalin_data_t *sopalin_data )
 {
     SolverMatrix        *datacode = sopalin_data->solvmtx;
-    int32_t              taskcnt = datacode->tasknbr - (datacode->cblknbr - datacode->cblkschur);
-    struct args_zpotrf_t args_zpotrf = { sopalin_data, taskcnt };
+    int32_t              taskcnt = datacode->tasknbr;
+    struct args_zpotrf_t args_zpotrf;
+
+    /* The Schur complement is processed only by the left-looking algorithm */
+    if ( datacode->lookside != PastixFactLeftLooking ) {
+        taskcnt -= datacode->cblknbr - datacode->cblkschur;
+    }
+    args_zpotrf.sopalin_data = sopalin_data;
+    args_zpotrf.taskcnt      = taskcnt;
 
     /* Allocate the computeQueue */
     MALLOC_INTERN( datacode->computeQueue,
@@ -56,15 +56,20 @@ sequential_zsytrf( pastix_data_t  *pastix_data,
     pastix_int_t  N, i, lwork1, lwork2;
     (void)sopalin_data;
 
-    lwork1 = datacode->offdmax;
+    /* The copy of the panels scaled by D is only used by the low-rank updates */
+    lwork1 = ( datacode->lowrank.compress_when != PastixCompressNever ) ? datacode->offdmax : 0;
     lwork2 = pastix_imax( datacode->gemmmax, datacode->blokmax );
     if ( (datacode->lowrank.compress_when != PastixCompressNever) &&
          (datacode->lowrank.ilu_lvl < INT_MAX) )
     {
         lwork2 = pastix_imax( lwork2, 2 * datacode->blokmax );
     }
-    MALLOC_INTERN( work1, lwork1, pastix_complex64_t );
+    work1 = NULL;
+    if ( lwork1 > 0 ) {
+        MALLOC_INTERN( work1, lwork1, pastix_complex64_t );
+    }
     MALLOC_INTERN( work2, lwork2, pastix_complex64_t );
+    pastix_lrmem_bind( datacode->lowrank.lrmem, 0 );
 
     cblk = datacode->cblktab;
     for (i=0; i<datacode->cblknbr; i++, cblk++){
@@ -89,10 +94,14 @@ sequential_zsytrf( pastix_data_t  *pastix_data,
                              * TRSM and GEMM kernels, we must shift the DLh workspace
                              * by the diagonal block size
                              */
-                            work1 - (N*N), work2, lwork2 );
+                            ( work1 == NULL ) ? NULL : work1 - (N*N),
+                            work2, lwork2 );
     }
 
-    memFree_null( work1 );
+    if ( work1 != NULL ) {
+        memFree_null( work1 );
+    }
+    pastix_lrmem_bind( NULL, 0 );
     memFree_null( work2 );
 }
 
@@ -120,23 +129,40 @@ thread_zsytrf_static( isched_thread_t *ctx,
     Task               *t;
     pastix_complex64_t *work1, *work2;
     pastix_int_t  N, i, ii, lwork1, lwork2;
-    pastix_int_t  tasknbr, *tasktab;
+    pastix_int_t  tasknbr, *tasktab, first;
+    int8_t       *done = NULL;
     int rank = ctx->rank;
 
-    lwork1 = datacode->offdmax;
+    /* The copy of the panels scaled by D is only used by the low-rank updates */
+    lwork1 = ( datacode->lowrank.compress_when != PastixCompressNever ) ? datacode->offdmax : 0;
     lwork2 = pastix_imax( datacode->gemmmax, datacode->blokmax );
     if ( (datacode->lowrank.compress_when != PastixCompressNever) &&
          (datacode->lowrank.ilu_lvl < INT_MAX) )
     {
         lwork2 = pastix_imax( lwork2, 2 * datacode->blokmax );
     }
-    MALLOC_INTERN( work1, lwork1, pastix_complex64_t );
+    work1 = NULL;
+    if ( lwork1 > 0 ) {
+        MALLOC_INTERN( work1, lwork1, pastix_complex64_t );
+    }
     MALLOC_INTERN( work2, lwork2, pastix_complex64_t );
+    pastix_lrmem_bind( datacode->lowrank.lrmem, rank );
 
     tasknbr = datacode->ttsknbr[rank];
     tasktab = datacode->ttsktab[rank];
+    if ( (datacode->lookahead > 0) && (tasknbr > 0) ) {
+        MALLOC_INTERN( done, tasknbr, int8_t );
+        memset( done, 0, tasknbr * sizeof(int8_t) );
+    }
 
-    for (ii=0; ii<tasknbr; ii++) {
+    first = 0;
+    while ( first < tasknbr ) {
+        ii = solverStaticNext( datacode, rank, &first, done );
+        if ( ii == -1 ) {
+            /* None of the tasks of the lookahead window is ready */
+            cpucblk_zincoming_progress( rank, PastixLCoef, datacode );
+            continue;
+        }
         i = tasktab[ii];
         t = datacode->tasktab + i;
         cblk = datacode->cblktab + t->cblknum;
@@ -162,10 +188,17 @@ thread_zsytrf_static( isched_thread_t *ctx,
                              * TRSM and GEMM kernels, we must shift the DLh workspace
                              * by the diagonal block size
                              */
-                            work1 - (N*N), work2, lwork2 );
+                            ( work1 == NULL ) ? NULL : work1 - (N*N),
+                            work2, lwork2 );
     }
 
-    memFree_null( work1 );
+    if ( done != NULL ) {
+        memFree_null( done );
+    }
+    if ( work1 != NULL ) {
+        memFree_null( work1 );
+    }
+    pastix_lrmem_bind( NULL, 0 );
     memFree_null( work2 );
 }
 
@@ -229,21 +262,27 @@ thread_zsytrf_dynamic( isched_thread_t *ctx,
     int32_t               local_taskcnt = 0;
     int                   rank = ctx->rank;
 
-    lwork1 = datacode->offdmax;
+    /* The copy of the panels scaled by D is only used by the low-rank updates */
+    lwork1 = ( datacode->lowrank.compress_when != PastixCompressNever ) ? datacode->offdmax : 0;
     lwork2 = pastix_imax( datacode->gemmmax, datacode->blokmax );
     if ( (datacode->lowrank.compress_when != PastixCompressNever) &&
          (datacode->lowrank.ilu_lvl < INT_MAX) )
     {
         lwork2 = pastix_imax( lwork2, 2 * datacode->blokmax );
     }
-    MALLOC_INTERN( work1, lwork1, pastix_complex64_t );
+    work1 = NULL;
+    if ( lwork1 > 0 ) {
+        MALLOC_INTERN( work1, lwork1, pastix_complex64_t );
+    }
     MALLOC_INTERN( work2, lwork2, pastix_complex64_t );
+    pastix_lrmem_bind( datacode->lowrank.lrmem, rank );
     MALLOC_INTERN( datacode->computeQueue[rank], 1, pastix_queue_t );
 
     tasknbr      = datacode->ttsknbr[rank];
     tasktab      = datacode->ttsktab[rank];
     computeQueue = datacode->computeQueue[rank];
-    pqueueInit( computeQueue, tasknbr );
+    pqueueInitType( computeQueue, datacode->queuetype, tasknbr,
+                    0., (double)(datacode->tasknbr) );
 
     /* Initialize the local task queue with available cblks */
     for (ii=0; ii<tasknbr; ii++) {
@@ -258,6 +297,7 @@ thread_zsytrf_dynamic( isched_thread_t *ctx,
 
     /* Make sure that all computeQueues are allocated */
     isched_barrier_wait( &(ctx->global_ctx->barrier) );
+    solverCacheStart( datacode, rank );
 
     while( arg->taskcnt > 0 )
     {
@@ -274,17 +314,23 @@ thread_zsytrf_dynamic( isched_thread_t *ctx,
         /* No more local job, let's steal our neighbors */
         if( cblknum == -1 ) {
             if ( local_taskcnt ) {
-                pastix_atomic_sub_32b( &(arg->taskcnt), local_taskcnt );
+                if ( !pastix_atomic_sub_32b( &(arg->taskcnt), local_taskcnt ) ) {
+                    solverIdleWakeup( datacode, 1 );
+                }
                 local_taskcnt = 0;
             }
-            cblknum = stealQueue( datacode, rank,
-                                  ctx->global_ctx->world_size );
+            cblknum = stealQueue( datacode, ctx );
         }
 
-        /* Still no job, let's loop again */
+        /* Still no job, help a large cblk or wait, and loop again */
         if ( cblknum == -1 ) {
+            if ( !solverTeamHelp( datacode, work2, lwork2 ) ) {
+                solverIdleWait( datacode, rank, &(arg->taskcnt) );
+            }
             continue;
         }
+        solverIdleStop( datacode, rank );
+        solverPrefetchNext( datacode, computeQueue );
 
         cblk = datacode->cblktab + cblknum;
         if ( cblk->cblktype & CBLK_IN_SCHUR ) {
@@ -302,10 +348,16 @@ thread_zsytrf_dynamic( isched_thread_t *ctx,
                              * TRSM and GEMM kernels, we must shift the DLh workspace
                              * by the diagonal block size
                              */
-                            work1 - (N*N), work2, lwork2 );
+                            ( work1 == NULL ) ? NULL : work1 - (N*N),
+                            work2, lwork2 );
         local_taskcnt++;
     }
-    memFree_null( work1 );
+    solverIdleStop( datacode, rank );
+    solverCacheStop( datacode, rank );
+    if ( work1 != NULL ) {
+        memFree_null( work1 );
+    }
+    pastix_lrmem_bind( NULL, 0 );
     memFree_null( work2 );
 
     /* Make sure that everyone is done before freeing */
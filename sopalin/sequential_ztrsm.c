@@ -306,10 +306,12 @@ thread_ztrsm_dynamic( isched_thread_t *ctx,
 
     tasknbr      = datacode->ttsknbr[thrd_rank];
     computeQueue = datacode->computeQueue[thrd_rank];
-    pqueueInit( computeQueue, tasknbr );
 
     /* Backward like */
     if ( enums->solve_step == PastixSolveBackward ) {
+        pqueueInitType( computeQueue, datacode->queuetype, tasknbr,
+                        - (double)(datacode->tasknbr), 0. );
+
         /* Init ctrbcnt in parallel */
         cblk = datacode->cblktab + cblkfirst;
         for (ii=cblkfirst; ii<cblklast; ii++, cblk++) {
@@ -339,16 +341,20 @@ thread_ztrsm_dynamic( isched_thread_t *ctx,
             /* No more local job, let's steal our neighbors */
             if ( cblknum == -1 ) {
                 if ( local_taskcnt ) {
-                    pastix_atomic_sub_32b( &(arg->taskcnt), local_taskcnt );
+                    if ( !pastix_atomic_sub_32b( &(arg->taskcnt), local_taskcnt ) ) {
+                        solverIdleWakeup( datacode, 1 );
+                    }
                     local_taskcnt = 0;
                 }
-                cblknum = stealQueue( datacode, thrd_rank, thrd_size );
+                cblknum = stealQueue( datacode, ctx );
             }
 
-            /* Still no job, let's loop again */
+            /* Still no job, let's wait and loop again */
             if ( cblknum == -1 ) {
+                solverIdleWait( datacode, thrd_rank, &(arg->taskcnt) );
                 continue;
             }
+            solverIdleStop( datacode, thrd_rank );
 
             cblk           = datacode->cblktab + cblknum;
             cblk->threadid = thrd_rank;
@@ -360,6 +366,9 @@ thread_ztrsm_dynamic( isched_thread_t *ctx,
     }
     /* Forward like */
     else {
+        pqueueInitType( computeQueue, datacode->queuetype, tasknbr,
+                        0., (double)(datacode->tasknbr) );
+
         /* Init ctrbcnt in parallel */
         cblk = datacode->cblktab + cblkfirst;
         for (ii=cblkfirst; ii<cblklast; ii++, cblk++) {
@@ -386,17 +395,20 @@ thread_ztrsm_dynamic( isched_thread_t *ctx,
             /* No more local job, let's steal our neighbors */
             if ( cblknum == -1 ) {
                 if ( local_taskcnt ) {
-                    pastix_atomic_sub_32b( &(arg->taskcnt), local_taskcnt );
+                    if ( !pastix_atomic_sub_32b( &(arg->taskcnt), local_taskcnt ) ) {
+                        solverIdleWakeup( datacode, 1 );
+                    }
                     local_taskcnt = 0;
                 }
-                cblknum = stealQueue( datacode, thrd_rank,
-                                      thrd_size );
+                cblknum = stealQueue( datacode, ctx );
             }
 
-            /* Still no job, let's loop again */
+            /* Still no job, let's wait and loop again */
             if ( cblknum == -1 ) {
+                solverIdleWait( datacode, thrd_rank, &(arg->taskcnt) );
                 continue;
             }
+            solverIdleStop( datacode, thrd_rank );
 
             cblk           = datacode->cblktab + cblknum;
             cblk->threadid = thrd_rank;
@@ -411,6 +423,8 @@ thread_ztrsm_dynamic( isched_thread_t *ctx,
             local_taskcnt++;
         }
     }
+    solverIdleStop( datacode, thrd_rank );
+
     /* Make sure that everyone is done before freeing */
     isched_barrier_wait( &(ctx->global_ctx->barrier) );
     assert( computeQueue->used == 0 );
@@ -0,0 +1,108 @@
+/**
+ *
+ * @file gemmsp_scatter_time.c
+ *
+ * Tests performance of the assembly of the 1D updates in the facing column
+ * blocks, with and without the maps of the facing blocks.
+ *
+ * @copyright 2015-2023 Bordeaux INP, CNRS (LaBRI UMR 5800), Inria,
+ *                      Univ. Bordeaux. All rights reserved.
+ *
+ * @version 6.3.0
+ * @author Mathieu Faverge
+ * @date 2026-10-17
+ *
+ **/
+#include <pastix.h>
+#include "common.h"
+
+#include "z_tests.h"
+#include "c_tests.h"
+#include "d_tests.h"
+#include "s_tests.h"
+
+int main ( int argc, char **argv )
+{
+    pastix_data_t   *pastix_data = NULL; /*< Pointer to the storage structure required by pastix */
+    pastix_int_t     iparm[IPARM_SIZE];  /*< Integer in/out parameters for pastix                */
+    pastix_fixdbl_t  dparm[DPARM_SIZE];  /*< Floating in/out parameters for pastix               */
+    spm_driver_t     driver;
+    char            *filename;
+    pastix_spm_t    *spm, spm2;
+    int              check = 1;
+    int              scatter = 0;
+    int              rc, nbiter = 20;
+
+    /**
+     * Initialize parameters to default values
+     */
+    pastixInitParam( iparm, dparm );
+    iparm[IPARM_VERBOSE] = PastixVerboseNot;
+
+    /**
+     * Get options from command line
+     */
+    pastixGetOptions( argc, argv,
+                      iparm, dparm,
+                      &check, &scatter, &driver, &filename );
+
+    /**
+     * Initialize the PaStiX library
+     */
+    pastixInit( &pastix_data, MPI_COMM_WORLD, iparm, dparm );
+
+    /**
+     * Read the sparse matrix with the driver
+     */
+    spm = malloc( sizeof( pastix_spm_t ) );
+    rc = spmReadDriver( driver, filename, spm );
+    free( filename );
+    if ( rc != SPM_SUCCESS ) {
+        pastixFinalize( &pastix_data );
+        return rc;
+    }
+    spmPrintInfo( spm, stdout );
+
+    rc = spmCheckAndCorrect( spm, &spm2 );
+    if ( rc != 0 ) {
+        spmExit( spm );
+        *spm = spm2;
+    }
+
+    if ( spm->flttype == SpmPattern ) {
+        spmGenFakeValues( spm );
+    }
+
+    /**
+     * Startup pastix to perform the analyze step, and initialize the
+     * coefficients of the factorized matrix
+     */
+    pastix_task_analyze( pastix_data, spm );
+    pastix_subtask_spm2bcsc( pastix_data, spm );
+    pastix_subtask_bcsc2ctab( pastix_data );
+
+    switch( spm->flttype ){
+    case SpmComplex64:
+        rc = z_gemmsp_scatter_time( pastix_data, nbiter );
+        break;
+
+    case SpmComplex32:
+        rc = c_gemmsp_scatter_time( pastix_data, nbiter );
+        break;
+
+    case SpmFloat:
+        rc = s_gemmsp_scatter_time( pastix_data, nbiter );
+        break;
+
+    case SpmDouble:
+    default:
+        rc = d_gemmsp_scatter_time( pastix_data, nbiter );
+    }
+
+    spmExit( spm );
+    free( spm );
+
+    pastixFinalize( &pastix_data );
+
+    return rc;
+}
@@ -0,0 +1,90 @@
+/**
+ *
+ * @file isched_time.c
+ *
+ * Micro-benchmark of the dispatch of the internal scheduler. It measures the
+ * cost of an isched_parallel_call() with a tiny function when the threads sleep
+ * on a condition variable, and when they spin between the calls. Each call
+ * must be executed once by each thread for the test to succeed.
+ *
+ * @copyright 2015-2023 Bordeaux INP, CNRS (LaBRI UMR 5800), Inria,
+ *                      Univ. Bordeaux. All rights reserved.
+ *
+ * @version 6.3.0
+ * @author Mathieu Faverge
+ * @date 2026-10-17
+ *
+ **/
+#include <pastix.h>
+#include "common.h"
+#include "common/isched.h"
+
+static void
+thread_isched_time( isched_thread_t *ctx,
+                    void            *args )
+{
+    volatile int32_t *counter = (volatile int32_t*)args;
+    pastix_atomic_inc_32b( counter );
+    (void)ctx;
+}
+
+static int
+isched_time( int         nbthreads,
+             int         spinning,
+             pastix_int_t nbcalls )
+{
+    isched_t        *isched;
+    volatile int32_t counter = 0;
+    pastix_int_t     i;
+    double           timer;
+    int              rc;
+
+    isched = ischedInit( nbthreads, NULL, spinning );
+
+    /* Warmup */
+    isched_parallel_call( isched, thread_isched_time, (void*)&counter );
+
+    timer = clockGetLocal();
+    for( i=0; i<nbcalls; i++ ) {
+        isched_parallel_call( isched, thread_isched_time, (void*)&counter );
+    }
+    timer = clockGetLocal() - timer;
+
+    rc = ( counter != (nbcalls + 1) * isched->world_size );
+
+    printf( "  %-8s: %e s (%e s/call) %s\n",
+            spinning ? "spin" : "sleep",
+            timer, timer / (double)nbcalls,
+            rc ? "FAILED" : "SUCCESS" );
+
+    ischedFinalize( isched );
+    return rc;
+}
+
+int main ( int argc, char **argv )
+{
+    pastix_int_t nbcalls = 10000;
+    int          nbthreads = -1;
+    int          rc = 0;
+
+    if ( argc > 1 ) {
+        nbthreads = atoi( argv[1] );
+    }
+    if ( argc > 2 ) {
+        nbcalls = atol( argv[2] );
+    }
+
+    printf( "Dispatch benchmark with %ld parallel calls\n", (long)nbcalls );
+
+    rc += isched_time( nbthreads, 0, nbcalls );
+    rc += isched_time( nbthreads, 1, nbcalls );
+
+    if ( rc == 0 ) {
+        printf( " -- All tests PASSED --\n" );
+        return EXIT_SUCCESS;
+    }
+    else {
+        printf( " -- %d tests FAILED --\n", rc );
+        return EXIT_FAILURE;
+    }
+}
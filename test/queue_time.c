@@ -0,0 +1,166 @@
+/**
+ *
+ * @file queue_time.c
+ *
+ * Micro-benchmark of the queues used by the dynamic scheduler. It compares the
+ * locked binary heap with the lock-free work-stealing queue when:
+ *    - each thread pushes and pops its own elements (owner fast path),
+ *    - all the elements are pushed by a single thread and stolen by the others
+ *      (contention on the same queue).
+ * Each element must be popped exactly once for the test to succeed.
+ *
+ * @copyright 2015-2023 Bordeaux INP, CNRS (LaBRI UMR 5800), Inria,
+ *                      Univ. Bordeaux. All rights reserved.
+ *
+ * @version 6.3.0
+ * @author Mathieu Faverge
+ * @date 2026-10-17
+ *
+ **/
+#include <pastix.h>
+#include "common.h"
+#include "common/isched.h"
+#include "kernels/queue.h"
+
+/**
+ * @brief Arguments of the benchmark threads
+ */
+struct args_queue_t {
+    pastix_queue_t     **queues;   /**< One queue per thread                         */
+    pastix_sched_queue_t type;     /**< Implementation of the queues                 */
+    pastix_int_t         nbelts;   /**< Number of elements per thread                */
+    int                  single;   /**< If true, thread 0 pushes all the elements    */
+    volatile int32_t     remain;   /**< Number of elements that remain to be popped  */
+    volatile int32_t    *seen;     /**< Number of times each element has been popped */
+    double               time;     /**< Time of the pop/steal phase                  */
+};
+
+static void
+thread_queue_time( isched_thread_t *ctx,
+                   void            *args )
+{
+    struct args_queue_t *arg = (struct args_queue_t*)args;
+    pastix_queue_t      *queue;
+    pastix_int_t         i, first, nbelts, elt;
+    int                  rank   = ctx->rank;
+    int                  size   = ctx->global_ctx->world_size;
+    int32_t              popped = 0;
+    int                  rk;
+    double               timer  = 0.;
+
+    nbelts = arg->single ? ( (rank == 0) ? arg->nbelts * size : 0 ) : arg->nbelts;
+    first  = arg->single ? 0 : rank * arg->nbelts;
+
+    MALLOC_INTERN( arg->queues[rank], 1, pastix_queue_t );
+    queue = arg->queues[rank];
+    pqueueInitType( queue, arg->type, nbelts,
+                    0., (double)(arg->nbelts * size) );
+
+    /* Push the elements in random priority order */
+    for( i=0; i<nbelts; i++ ) {
+        elt = first + i;
+        pqueuePush1( queue, elt, (double)( ((int64_t)elt * 7919) % (arg->nbelts * size) ) );
+    }
+
+    isched_barrier_wait( &(ctx->global_ctx->barrier) );
+    if ( rank == 0 ) {
+        timer = clockGetLocal();
+    }
+
+    while( arg->remain > 0 ) {
+        elt = pqueuePop( queue );
+        if ( elt == -1 ) {
+            if ( popped ) {
+                pastix_atomic_sub_32b( &(arg->remain), popped );
+                popped = 0;
+            }
+            for( rk = (rank+1)%size; (rk != rank) && (elt == -1); rk = (rk+1)%size ) {
+                elt = pqueuePop( arg->queues[rk] );
+            }
+        }
+        if ( elt == -1 ) {
+            continue;
+        }
+        pastix_atomic_inc_32b( arg->seen + elt );
+        popped++;
+    }
+
+    isched_barrier_wait( &(ctx->global_ctx->barrier) );
+    if ( rank == 0 ) {
+        arg->time = clockGetLocal() - timer;
+    }
+    pqueueExit( queue );
+    memFree_null( queue );
+}
+
+static int
+queue_time( isched_t            *isched,
+            pastix_sched_queue_t type,
+            pastix_int_t         nbelts,
+            int                  single )
+{
+    struct args_queue_t args;
+    pastix_int_t        i, total = nbelts * isched->world_size;
+    int                 rc = 0;
+
+    args.type   = type;
+    args.nbelts = nbelts;
+    args.single = single;
+    args.remain = total;
+    args.time   = 0.;
+    MALLOC_INTERN( args.queues, isched->world_size, pastix_queue_t * );
+    args.seen = calloc( total, sizeof(int32_t) );
+
+    isched_parallel_call( isched, thread_queue_time, &args );
+
+    for( i=0; i<total; i++ ) {
+        if ( args.seen[i] != 1 ) {
+            rc++;
+        }
+    }
+
+    printf( "  %-13s %-8s: %e s (%e s/elt) %s\n",
+            pastix_sched_queue_getstr( type ) + 16,
+            single ? "steal" : "local",
+            args.time, args.time / (double)total,
+            rc ? "FAILED" : "SUCCESS" );
+
+    free( (void*)args.seen );
+    memFree_null( args.queues );
+    return rc;
+}
+
+int main ( int argc, char **argv )
+{
+    isched_t    *isched;
+    pastix_int_t nbelts = 100000;
+    int          nbthreads = -1;
+    int          rc = 0;
+
+    if ( argc > 1 ) {
+        nbthreads = atoi( argv[1] );
+    }
+    if ( argc > 2 ) {
+        nbelts = atol( argv[2] );
+    }
+
+    isched = ischedInit( nbthreads, NULL, 0 );
+    printf( "Queue benchmark with %d threads and %ld elements per thread\n",
+            isched->world_size, (long)nbelts );
+
+    rc += queue_time( isched, PastixSchedQueueHeap,         nbelts, 0 );
+    rc += queue_time( isched, PastixSchedQueueWorkStealing, nbelts, 0 );
+    rc += queue_time( isched, PastixSchedQueueHeap,         nbelts, 1 );
+    rc += queue_time( isched, PastixSchedQueueWorkStealing, nbelts, 1 );
+
+    ischedFinalize( isched );
+
+    if ( rc == 0 ) {
+        printf( " -- All tests PASSED --\n" );
+        return EXIT_SUCCESS;
+    }
+    else {
+        printf( " -- %d tests FAILED --\n", rc );
+        return EXIT_FAILURE;
+    }
+}
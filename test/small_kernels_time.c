@@ -0,0 +1,52 @@
+/**
+ *
+ * @file small_kernels_time.c
+ *
+ * Tests performance of the fixed-size kernels of the small blocks against the
+ * generic kernels, in all the precisions.
+ *
+ * @copyright 2015-2023 Bordeaux INP, CNRS (LaBRI UMR 5800), Inria,
+ *                      Univ. Bordeaux. All rights reserved.
+ *
+ * @version 6.3.0
+ * @author Mathieu Faverge
+ * @date 2026-10-17
+ *
+ **/
+#include <pastix.h>
+#include "common.h"
+
+#include "z_tests.h"
+#include "c_tests.h"
+#include "d_tests.h"
+#include "s_tests.h"
+
+int main ( int argc, char **argv )
+{
+    int nbiter = 1000;
+    int rc = 0;
+
+    if ( argc > 1 ) {
+        nbiter = atoi( argv[1] );
+    }
+
+    printf( "Fixed-size kernels with %d iterations\n", nbiter );
+
+    printf( "  PastixFloat\n" );
+    rc += s_small_kernels_time( nbiter );
+    printf( "  PastixDouble\n" );
+    rc += d_small_kernels_time( nbiter );
+    printf( "  PastixComplex32\n" );
+    rc += c_small_kernels_time( nbiter );
+    printf( "  PastixComplex64\n" );
+    rc += z_small_kernels_time( nbiter );
+
+    if ( rc == 0 ) {
+        printf( " -- All tests PASSED --\n" );
+        return EXIT_SUCCESS;
+    }
+    else {
+        printf( " -- %d tests FAILED --\n", rc );
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,593 @@
+/**
+ *
+ * @file z_gemmsp_tests.c
+ *
+ * Tests and validate the update kernels of the small column blocks, the
+ * assembly of the 1D updates, and the fused L and U updates.
+ *
+ * @copyright 2015-2023 Bordeaux INP, CNRS (LaBRI UMR 5800), Inria,
+ *                      Univ. Bordeaux. All rights reserved.
+ *
+ * @version 6.3.0
+ * @author Mathieu Faverge
+ * @date 2026-10-17
+ *
+ * @precisions normal z -> c d s
+ *
+ **/
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <string.h>
+#include <assert.h>
+#include <pastix.h>
+#include <common.h>
+#include <lapacke.h>
+#include "blend/solver.h"
+#include "kernels/pastix_zcores.h"
+#include "z_tests.h"
+
+/**
+ * @brief Check if the coefficients of a cblk are stored locally in full rank.
+ */
+static inline int
+z_gemmsp_local( const SolverCblk *cblk )
+{
+    return !( cblk->cblktype & (CBLK_FANIN | CBLK_RECV | CBLK_COMPRESSED) )
+        && ( cblk->lcoeftab != NULL );
+}
+
+/**
+ * @brief Return the number of coefficients of a local cblk. The upper part is
+ * stored right after the lower part in the same allocation.
+ */
+static inline pastix_int_t
+z_gemmsp_size( const SolverCblk *cblk )
+{
+    pastix_int_t size = cblk_colnbr( cblk ) * cblk->stride;
+
+    assert( (cblk->ucoeftab == NULL) ||
+            (cblk->ucoeftab == (pastix_complex64_t *)(cblk->lcoeftab) + size) );
+    return ( cblk->ucoeftab != NULL ) ? 2 * size : size;
+}
+
+/**
+ * @brief Copy the coefficients of all the local cblks from/to a buffer.
+ */
+static void
+z_gemmsp_copy( SolverMatrix       *solvmtx,
+               pastix_complex64_t *buffer,
+               int                 restore )
+{
+    SolverCblk  *cblk = solvmtx->cblktab;
+    pastix_int_t cblknum, size;
+
+    for ( cblknum = 0; cblknum < solvmtx->cblknbr; cblknum++, cblk++ ) {
+        if ( !z_gemmsp_local( cblk ) ) {
+            continue;
+        }
+        size = z_gemmsp_size( cblk );
+        if ( restore ) {
+            memcpy( cblk->lcoeftab, buffer, size * sizeof(pastix_complex64_t) );
+        }
+        else {
+            memcpy( buffer, cblk->lcoeftab, size * sizeof(pastix_complex64_t) );
+        }
+        buffer += size;
+    }
+}
+
+/**
+ * @brief Apply the updates of the selected cblks either one block at a time,
+ * or with the batched kernel.
+ *
+ * The cblks are traversed backward such that the contributions are always
+ * computed from the original coefficients. The selected array is filled by the
+ * batched version, and used to select the same cblks in the per-block version.
+ */
+static double
+z_gemmsp_apply( SolverMatrix       *solvmtx,
+                int                 batch,
+                int8_t             *selected,
+                pastix_int_t       *nbupd,
+                pastix_complex64_t *work,
+                pastix_int_t        lwork )
+{
+    SolverCblk  *cblk, *fcblk;
+    SolverBlok  *blok, *lblk;
+    pastix_int_t cblknum;
+    Clock        timer;
+
+    *nbupd = 0;
+    timer  = clockGetLocal();
+    for ( cblknum = solvmtx->cblknbr-1; cblknum >= 0; cblknum-- ) {
+        cblk = solvmtx->cblktab + cblknum;
+        lblk = cblk[1].fblokptr;
+
+        if ( batch ) {
+            selected[cblknum] = z_gemmsp_local( cblk ) &&
+                ( cpucblk_zgemmsp_batch( PastixLCoef, PastixTrans, solvmtx, cblk,
+                                         cblk->lcoeftab, cblk->lcoeftab ) == PASTIX_SUCCESS );
+        }
+        else if ( selected[cblknum] ) {
+            for ( blok = cblk->fblokptr + 1; blok < lblk; blok++ ) {
+                fcblk = solvmtx->cblktab + blok->fcblknm;
+                cpucblk_zgemmsp( PastixLCoef, PastixTrans,
+                                 cblk, blok, fcblk,
+                                 cblk->lcoeftab, cblk->lcoeftab, fcblk->lcoeftab,
+                                 work, lwork, &(solvmtx->lowrank) );
+            }
+        }
+
+        if ( selected[cblknum] ) {
+            *nbupd += lblk - cblk->fblokptr - 1;
+        }
+    }
+    timer = clockGetLocal() - timer;
+
+    return clockVal(timer);
+}
+
+/**
+ * @brief Compare the coefficients of all the local cblks to a buffer.
+ */
+static double
+z_gemmsp_diff( SolverMatrix             *solvmtx,
+               const pastix_complex64_t *buffer )
+{
+    SolverCblk  *cblk = solvmtx->cblktab;
+    pastix_int_t cblknum, i, size;
+    double       diff, maxdiff = 0., maxval = 0.;
+
+    for ( cblknum = 0; cblknum < solvmtx->cblknbr; cblknum++, cblk++ ) {
+        const pastix_complex64_t *lcoeftab = cblk->lcoeftab;
+
+        if ( !z_gemmsp_local( cblk ) ) {
+            continue;
+        }
+        size = z_gemmsp_size( cblk );
+        for ( i = 0; i < size; i++, buffer++, lcoeftab++ ) {
+            diff    = cabs( *lcoeftab - *buffer );
+            maxdiff = ( diff > maxdiff ) ? diff : maxdiff;
+            diff    = cabs( *buffer );
+            maxval  = ( diff > maxval ) ? diff : maxval;
+        }
+    }
+
+    return ( maxval > 0. ) ? maxdiff / maxval : maxdiff;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Compare the per-block and the batched updates of the small cblks.
+ *
+ * All the updates emitted by the cblks eligible to cpucblk_zgemmsp_batch() are
+ * first computed with the batched kernel, and then one block at a time with
+ * cpucblk_zgemmsp(). The results are compared, and the average time per
+ * update of both versions is reported.
+ *
+ *******************************************************************************
+ *
+ * @param[in] pastix_data
+ *          The pastix_data structure with the initialized coefficients.
+ *
+ * @param[in] nbiter
+ *          The number of runs of each version used to measure the time.
+ *
+ *******************************************************************************
+ *
+ * @retval 0 if the results are identical up to the rounding errors,
+ * @retval 1 otherwise.
+ *
+ *******************************************************************************/
+int
+z_gemmsp_batch_time( pastix_data_t *pastix_data,
+                     int            nbiter )
+{
+    SolverMatrix       *solvmtx = pastix_data->solvmatr;
+    SolverCblk         *cblk;
+    pastix_complex64_t *work, *save, *result;
+    int8_t             *selected;
+    pastix_int_t        cblknum, lwork, size = 0, nbupd = 0;
+    double              eps = LAPACKE_dlamch_work( 'e' );
+    double              t_blok = 0., t_batch = 0., diff;
+    int                 i, rc;
+
+    cblk = solvmtx->cblktab;
+    for ( cblknum = 0; cblknum < solvmtx->cblknbr; cblknum++, cblk++ ) {
+        if ( z_gemmsp_local( cblk ) ) {
+            size += z_gemmsp_size( cblk );
+        }
+    }
+
+    lwork = pastix_imax( solvmtx->gemmmax, 1 );
+    MALLOC_INTERN( work,     lwork,            pastix_complex64_t );
+    MALLOC_INTERN( save,     size,             pastix_complex64_t );
+    MALLOC_INTERN( result,   size,             pastix_complex64_t );
+    MALLOC_INTERN( selected, solvmtx->cblknbr, int8_t             );
+
+    /* Check the batched kernel against the per-block one */
+    z_gemmsp_copy( solvmtx, save, 0 );
+
+    z_gemmsp_apply( solvmtx, 1, selected, &nbupd, work, lwork );
+    z_gemmsp_copy( solvmtx, result, 0 );
+    z_gemmsp_copy( solvmtx, save,   1 );
+
+    z_gemmsp_apply( solvmtx, 0, selected, &nbupd, work, lwork );
+    diff = z_gemmsp_diff( solvmtx, result );
+    z_gemmsp_copy( solvmtx, save, 1 );
+
+    rc = ( diff > (10. * PASTIX_GEMMSP_BATCH_WIDTH * eps) ) || isnan( diff );
+    printf( "    Batched updates: ||C_blok - C_batch|| / ||C_blok|| = %e %s\n",
+            diff, rc ? "FAILED" : "SUCCESS" );
+
+    /* Time both versions from the same coefficients */
+    for ( i = 0; i < nbiter; i++ ) {
+        t_batch += z_gemmsp_apply( solvmtx, 1, selected, &nbupd, work, lwork );
+        z_gemmsp_copy( solvmtx, save, 1 );
+
+        t_blok += z_gemmsp_apply( solvmtx, 0, selected, &nbupd, work, lwork );
+        z_gemmsp_copy( solvmtx, save, 1 );
+    }
+    t_blok  /= (double)nbiter;
+    t_batch /= (double)nbiter;
+
+    if ( nbupd > 0 ) {
+        printf( "    Time per block  ( %ld updates ) : %e s ( %e s/update )\n"
+                "    Time batched    ( %ld updates ) : %e s ( %e s/update )\n"
+                "    Speedup                       : %.2lf\n",
+                (long)nbupd, t_blok,  t_blok  / (double)nbupd,
+                (long)nbupd, t_batch, t_batch / (double)nbupd,
+                t_blok / t_batch );
+    }
+    else {
+        printf( "    No cblk eligible to the batched updates\n" );
+    }
+
+    memFree_null( work );
+    memFree_null( save );
+    memFree_null( result );
+    memFree_null( selected );
+
+    return rc;
+}
+
+/**
+ * @brief Add the 1D update of a block by searching for the facing blocks, as
+ * done before the maps were computed during the analysis.
+ */
+static void
+z_gemmsp_scatter_search( const SolverBlok         *blok,
+                         const SolverBlok         *lblok,
+                         SolverCblk               *fcblk,
+                         pastix_int_t              M,
+                         pastix_int_t              N,
+                         const pastix_complex64_t *W,
+                         pastix_complex64_t       *C,
+                         pastix_int_t              ldc )
+{
+    const SolverBlok *iterblok;
+    SolverBlok       *fblok = fcblk->fblokptr;
+    pastix_int_t      m;
+
+    for ( iterblok = blok; iterblok < lblok; iterblok++ ) {
+        while ( !is_block_inside_fblock( iterblok, fblok ) ) {
+            fblok++;
+        }
+        m = blok_rownbr( iterblok );
+
+        pastix_atomic_lock( &(fblok->lock) );
+        core_zgeadd( PastixNoTrans, m, N,
+                     -1.0, W, M,
+                      1.0, C + fblok->coefind + iterblok->frownum - fblok->frownum, ldc );
+        pastix_atomic_unlock( &(fblok->lock) );
+
+        W += m;
+    }
+}
+
+/**
+ * @brief Add the 1D updates of all the local blocks with one of the two
+ * assembly methods.
+ */
+static double
+z_gemmsp_scatter_apply( SolverMatrix             *solvmtx,
+                        int                       usemap,
+                        const pastix_complex64_t *W,
+                        pastix_int_t             *nbupd )
+{
+    SolverCblk         *cblk, *fcblk;
+    SolverBlok         *blok, *lblk;
+    pastix_complex64_t *C;
+    pastix_int_t        cblknum, M, N;
+    Clock               timer;
+
+    *nbupd = 0;
+    timer  = clockGetLocal();
+    cblk   = solvmtx->cblktab;
+    for ( cblknum = 0; cblknum < solvmtx->cblknbr; cblknum++, cblk++ ) {
+        if ( !z_gemmsp_local( cblk ) ) {
+            continue;
+        }
+        lblk = cblk[1].fblokptr;
+
+        for ( blok = cblk->fblokptr + 1; blok < lblk; blok++ ) {
+            fcblk = solvmtx->cblktab + blok->fcblknm;
+            if ( (blok->scatmap == NULL) || !z_gemmsp_local( fcblk ) ) {
+                continue;
+            }
+
+            M = cblk->stride - blok->coefind;
+            N = blok_rownbr( blok );
+            C = (pastix_complex64_t *)(fcblk->lcoeftab)
+                + (blok->frownum - fcblk->fcolnum) * fcblk->stride;
+
+            if ( usemap ) {
+                cpublok_zscatter( blok, lblk, fcblk, blok->scatmap,
+                                  M, N, W, C, fcblk->stride );
+            }
+            else {
+                z_gemmsp_scatter_search( blok, lblk, fcblk,
+                                         M, N, W, C, fcblk->stride );
+            }
+            (*nbupd)++;
+        }
+    }
+    timer = clockGetLocal() - timer;
+
+    return clockVal(timer);
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Compare the assembly of the 1D updates with and without the maps of
+ * the facing blocks.
+ *
+ * A random update is added to the facing cblk of every block stored in 1D,
+ * first by searching for the facing blocks and with core_zgeadd(), as
+ * previously done in the 1D update kernel, and then with cpublok_zscatter()
+ * and the maps computed during the analysis. The results must be identical,
+ * and the average time per update of both versions is reported.
+ *
+ *******************************************************************************
+ *
+ * @param[in] pastix_data
+ *          The pastix_data structure with the initialized coefficients.
+ *
+ * @param[in] nbiter
+ *          The number of runs of each version used to measure the time.
+ *
+ *******************************************************************************
+ *
+ * @retval 0 if the results are identical,
+ * @retval 1 otherwise.
+ *
+ *******************************************************************************/
+int
+z_gemmsp_scatter_time( pastix_data_t *pastix_data,
+                       int            nbiter )
+{
+    SolverMatrix       *solvmtx = pastix_data->solvmatr;
+    SolverCblk         *cblk;
+    pastix_complex64_t *W, *save, *result;
+    pastix_int_t        cblknum, lwork, size = 0, nbupd = 0;
+    double              t_search = 0., t_map = 0., diff;
+    int                 i, rc;
+
+    cblk = solvmtx->cblktab;
+    for ( cblknum = 0; cblknum < solvmtx->cblknbr; cblknum++, cblk++ ) {
+        if ( z_gemmsp_local( cblk ) ) {
+            size += z_gemmsp_size( cblk );
+        }
+    }
+
+    lwork = pastix_imax( solvmtx->gemmmax, 1 );
+    MALLOC_INTERN( W,      lwork, pastix_complex64_t );
+    MALLOC_INTERN( save,   size,  pastix_complex64_t );
+    MALLOC_INTERN( result, size,  pastix_complex64_t );
+    core_zplrnt( lwork, 1, W, lwork, lwork, 0, 0, 5476 );
+
+    /* Check the assembly with the maps against the search of the facing blocks */
+    z_gemmsp_copy( solvmtx, save, 0 );
+
+    z_gemmsp_scatter_apply( solvmtx, 0, W, &nbupd );
+    z_gemmsp_copy( solvmtx, result, 0 );
+    z_gemmsp_copy( solvmtx, save,   1 );
+
+    z_gemmsp_scatter_apply( solvmtx, 1, W, &nbupd );
+    diff = z_gemmsp_diff( solvmtx, result );
+    z_gemmsp_copy( solvmtx, save, 1 );
+
+    rc = ( diff != 0. );
+    printf( "    Scatter updates: ||C_search - C_map|| / ||C_search|| = %e %s\n",
+            diff, rc ? "FAILED" : "SUCCESS" );
+
+    for ( i = 0; i < nbiter; i++ ) {
+        t_search += z_gemmsp_scatter_apply( solvmtx, 0, W, &nbupd );
+        t_map    += z_gemmsp_scatter_apply( solvmtx, 1, W, &nbupd );
+    }
+    z_gemmsp_copy( solvmtx, save, 1 );
+    t_search /= (double)nbiter;
+    t_map    /= (double)nbiter;
+
+    if ( nbupd > 0 ) {
+        printf( "    Time search     ( %ld updates ) : %e s ( %e s/update )\n"
+                "    Time map        ( %ld updates ) : %e s ( %e s/update )\n"
+                "    Speedup                       : %.2lf\n",
+                (long)nbupd, t_search, t_search / (double)nbupd,
+                (long)nbupd, t_map,    t_map    / (double)nbupd,
+                t_search / t_map );
+    }
+    else {
+        printf( "    No 1D update to assemble\n" );
+    }
+
+    memFree_null( W );
+    memFree_null( save );
+    memFree_null( result );
+
+    return rc;
+}
+
+/**
+ * @brief Apply the L and U updates of all the local cblks either with two
+ * calls to cpucblk_zgemmsp(), or with the fused kernel.
+ *
+ * The cblks are traversed backward such that the contributions are always
+ * computed from the original coefficients.
+ */
+static double
+z_gemmsp_lu_apply( SolverMatrix       *solvmtx,
+                   int                 fused,
+                   pastix_int_t       *nbupd,
+                   pastix_complex64_t *work,
+                   pastix_int_t        lwork )
+{
+    SolverCblk  *cblk, *fcblk;
+    SolverBlok  *blok, *lblk;
+    pastix_int_t cblknum;
+    Clock        timer;
+
+    *nbupd = 0;
+    timer  = clockGetLocal();
+    for ( cblknum = solvmtx->cblknbr-1; cblknum >= 0; cblknum-- ) {
+        cblk = solvmtx->cblktab + cblknum;
+        lblk = cblk[1].fblokptr;
+
+        if ( !z_gemmsp_local( cblk ) ) {
+            continue;
+        }
+
+        for ( blok = cblk->fblokptr + 1; blok < lblk; blok++ ) {
+            fcblk = solvmtx->cblktab + blok->fcblknm;
+            if ( !z_gemmsp_local( fcblk ) ) {
+                continue;
+            }
+
+            if ( fused ) {
+                cpucblk_zgemmsp_lu( cblk, blok, fcblk,
+                                    cblk->lcoeftab, cblk->ucoeftab,
+                                    work, lwork, &(solvmtx->lowrank) );
+            }
+            else {
+                cpucblk_zgemmsp( PastixLCoef, PastixTrans,
+                                 cblk, blok, fcblk,
+                                 cblk->lcoeftab, cblk->ucoeftab, fcblk->lcoeftab,
+                                 work, lwork, &(solvmtx->lowrank) );
+                if ( blok+1 < lblk ) {
+                    cpucblk_zgemmsp( PastixUCoef, PastixTrans,
+                                     cblk, blok, fcblk,
+                                     cblk->ucoeftab, cblk->lcoeftab, fcblk->ucoeftab,
+                                     work, lwork, &(solvmtx->lowrank) );
+                }
+            }
+            (*nbupd)++;
+        }
+    }
+    timer = clockGetLocal() - timer;
+
+    return clockVal(timer);
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Compare the separate and the fused L and U updates of the LU
+ * factorization.
+ *
+ * All the updates between local cblks are applied with two calls to
+ * cpucblk_zgemmsp() per block, and then with cpucblk_zgemmsp_lu(). The results
+ * are compared, and the average time per update of both versions is reported.
+ *
+ *******************************************************************************
+ *
+ * @param[in] pastix_data
+ *          The pastix_data structure with the initialized coefficients of an
+ *          LU factorization.
+ *
+ * @param[in] nbiter
+ *          The number of runs of each version used to measure the time.
+ *
+ *******************************************************************************
+ *
+ * @retval 0 if the results are identical up to the arithmetic precision,
+ * @retval 1 otherwise.
+ *
+ *******************************************************************************/
+int
+z_gemmsp_lu_time( pastix_data_t *pastix_data,
+                  int            nbiter )
+{
+    SolverMatrix       *solvmtx = pastix_data->solvmatr;
+    SolverCblk         *cblk;
+    pastix_complex64_t *work, *save, *result;
+    pastix_int_t        cblknum, lwork, size = 0, nbupd = 0;
+    double              eps = LAPACKE_dlamch_work( 'e' );
+    double              t_split = 0., t_fused = 0., diff;
+    int                 i, rc;
+
+    if ( pastix_data->iparm[IPARM_FACTORIZATION] != PastixFactLU ) {
+        printf( "    The fused updates require the LU factorization\n" );
+        return 1;
+    }
+
+    cblk = solvmtx->cblktab;
+    for ( cblknum = 0; cblknum < solvmtx->cblknbr; cblknum++, cblk++ ) {
+        if ( z_gemmsp_local( cblk ) ) {
+            size += z_gemmsp_size( cblk );
+        }
+    }
+
+    /* Both products of the fused kernel are stored in the work buffer */
+    lwork = pastix_imax( 2 * solvmtx->gemmmax, 1 );
+    MALLOC_INTERN( work,   lwork, pastix_complex64_t );
+    MALLOC_INTERN( save,   size,  pastix_complex64_t );
+    MALLOC_INTERN( result, size,  pastix_complex64_t );
+
+    /* Check the fused kernel against the separate updates */
+    z_gemmsp_copy( solvmtx, save, 0 );
+
+    z_gemmsp_lu_apply( solvmtx, 0, &nbupd, work, lwork );
+    z_gemmsp_copy( solvmtx, result, 0 );
+    z_gemmsp_copy( solvmtx, save,   1 );
+
+    z_gemmsp_lu_apply( solvmtx, 1, &nbupd, work, lwork );
+    diff = z_gemmsp_diff( solvmtx, result );
+    z_gemmsp_copy( solvmtx, save, 1 );
+
+    rc = ( diff > (10. * eps) ) || isnan( diff );
+    printf( "    LU updates: ||C_split - C_fused|| / ||C_split|| = %e %s\n",
+            diff, rc ? "FAILED" : "SUCCESS" );
+
+    /* Time both versions from the same coefficients */
+    for ( i = 0; i < nbiter; i++ ) {
+        t_split += z_gemmsp_lu_apply( solvmtx, 0, &nbupd, work, lwork );
+        z_gemmsp_copy( solvmtx, save, 1 );
+
+        t_fused += z_gemmsp_lu_apply( solvmtx, 1, &nbupd, work, lwork );
+        z_gemmsp_copy( solvmtx, save, 1 );
+    }
+    t_split /= (double)nbiter;
+    t_fused /= (double)nbiter;
+
+    if ( nbupd > 0 ) {
+        printf( "    Time split      ( %ld updates ) : %e s ( %e s/update )\n"
+                "    Time fused      ( %ld updates ) : %e s ( %e s/update )\n"
+                "    Speedup                       : %.2lf\n",
+                (long)nbupd, t_split, t_split / (double)nbupd,
+                (long)nbupd, t_fused, t_fused / (double)nbupd,
+                t_split / t_fused );
+    }
+    else {
+        printf( "    No update between local cblks\n" );
+    }
+
+    memFree_null( work );
+    memFree_null( save );
+    memFree_null( result );
+
+    return rc;
+}
@@ -685,6 +685,9 @@ z_lowrank_check_rradd( pastix_lr_t         *lowrank,
  * Note that if we consider absolute compression, \f$ \tau_A = \eps \f$,
  * otherwise \f$ \tau_A = \eps * ||A|| \f$.
  *
+ * The same update is also applied in two halves through the accumulator of the
+ * deferred updates, and the flushed result d(C) is checked against c(C).
+ *
  *******************************************************************************
  *
  * @param[in] lowrank
@@ -740,17 +743,20 @@ z_lowrank_check_lrmm( pastix_lr_t         *lowrank,
                       pastix_complex64_t   beta,
                       const test_matrix_t *C )
 {
-    pastix_lrblock_t    lrC2;
-    pastix_complex64_t *Clr;
-    double              norm_diff, res;
+    pastix_lrblock_t    lrC2, lrC3;
+    pastix_lrblock_t   *lrCacc = NULL;
+    pastix_complex64_t *Clr, *Cdef;
+    double              norm_diff, norm_defer, res, resdef;
     Clock               timer;
     int                 rc = 0;
 
     /* Init lrC */
     memset( &lrC2, 0, sizeof( pastix_lrblock_t ) );
+    memset( &lrC3, 0, sizeof( pastix_lrblock_t ) );
 
-    /* Backup C into C2 */
+    /* Backup C into C2 and C3 */
     core_zlrcpy( NULL, PastixNoTrans, 1., C->m, C->n, &(C->lr), C->m, C->n, &lrC2, 0, 0 );
+    core_zlrcpy( NULL, PastixNoTrans, 1., C->m, C->n, &(C->lr), C->m, C->n, &lrC3, 0, 0 );
 
     /* Compute the low-rank matrix-matrix */
     {
@@ -775,10 +781,23 @@ z_lowrank_check_lrmm( pastix_lr_t         *lowrank,
         zlrmm_params.lwork   = -1;
         zlrmm_params.lwused  = -1;
         zlrmm_params.lock    = &lock;
+        zlrmm_params.Cacc    = NULL;
 
         timer = clockGetLocal();
         core_zlrmm( &zlrmm_params );
         timer = clockGetLocal() - timer;
+
+        /*
+         * Apply the same update to C3 in two halves through the deferred
+         * accumulator, and flush it to get the final C3
+         */
+        zlrmm_params.alpha = alpha / 2.;
+        zlrmm_params.C     = &lrC3;
+        zlrmm_params.Cacc  = &lrCacc;
+        core_zlrmm( &zlrmm_params );
+        core_zlrmm( &zlrmm_params );
+        core_zlrflush( lowrank, C->m, C->n, &lrC3, &lrCacc );
+        assert( lrCacc == NULL );
     }
 
     /*
@@ -799,26 +818,58 @@ z_lowrank_check_lrmm( pastix_lr_t         *lowrank,
     norm_diff = LAPACKE_zlange_work( LAPACK_COL_MAJOR, 'f', C->m, C->n,
                                      Clr, C->ld, NULL );
 
+    /*
+     * Check || c(A+B) - c_defer(A+B) || < tol * || A+B ||
+     */
+    Cdef = malloc( C->m * C->n * sizeof( pastix_complex64_t ) );
+
+    /* Uncompress the deferred sum, and compare it to the direct one */
+    core_zlr2ge( PastixNoTrans, C->m, C->n,
+                 &lrC3, Cdef, C->ld );
+
+    /* Clr already stores c(A+B) - (A+B) */
+
+    core_zgeadd( PastixNoTrans, C->m, C->n,
+                 -1., C->fr, C->ld,
+                  1., Cdef,  C->ld );
+
+    core_zgeadd( PastixNoTrans, C->m, C->n,
+                 -1., Clr,   C->ld,
+                  1., Cdef,  C->ld );
+
+    norm_defer = LAPACKE_zlange_work( LAPACK_COL_MAJOR, 'f', C->m, C->n,
+                                      Cdef, C->ld, NULL );
+
     if ( ( C->lr.rk != 0.0 ) && ( ( A->lr.rk + B->lr.rk ) != 0 ) ) {
         double errbound = lowrank->use_reltol ? C->norm : 1.;
-        res = norm_diff / ( lowrank->tolerance * errbound );
+        res    = norm_diff  / ( lowrank->tolerance * errbound );
+        resdef = norm_defer / ( lowrank->tolerance * errbound );
     }
     else {
-        res = norm_diff;
+        res    = norm_diff;
+        resdef = norm_defer;
     }
 
-    fprintf( stdout, "%7s %4d %e %e %e %e ",
+    fprintf( stdout, "%7s %4d %e %e %e %e %4d %e ",
              compmeth_shnames[lowrank->compress_method],
-             (int)lrC2.rk, clockVal(timer), C->norm, norm_diff, res );
+             (int)lrC2.rk, clockVal(timer), C->norm, norm_diff, res,
+             (int)lrC3.rk, resdef );
 
     free( Clr );
+    free( Cdef );
     core_zlrfree( &lrC2 );
+    core_zlrfree( &lrC3 );
 
     /* Check the correctness of the result */
     if ( res > 10.0 ) {
         rc += 1;
     }
 
+    /* Check the deferred result against the direct one */
+    if ( resdef > 20.0 ) {
+        rc += 2;
+    }
+
     if ( rc == 0 ) {
         fprintf( stdout, "SUCCESS\n" );
     }
@@ -826,5 +877,5 @@ z_lowrank_check_lrmm( pastix_lr_t         *lowrank,
         fprintf( stdout, "FAILED(%d)\n", rc );
     }
 
-    return rc;
+    return ( rc > 0 ) ? 1 : 0;
 }
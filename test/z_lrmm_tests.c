@@ -128,9 +128,10 @@ int main( int argc, char **argv )
                         C.norm = LAPACKE_zlange_work( LAPACK_COL_MAJOR, 'f', Cm, Cn,
                                                       Cfr, C.ld, NULL );
 
-                        fprintf( stdout, "%7s %4s %12s %12s %12s %12s\n",
+                        fprintf( stdout, "%7s %4s %12s %12s %12s %12s %4s %12s\n",
                                  "Method", "Rank", "Time", "||C||_f", "||c(C)-C||_f",
-                                 "||c(C)-C||_f/(||C||_f * eps)" );
+                                 "||c(C)-C||_f/(||C||_f * eps)",
+                                 "RkD", "||d(C)-c(C)||_f/(||C||_f * eps)" );
 
                         ret = 0;
 
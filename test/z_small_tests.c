@@ -0,0 +1,219 @@
+/**
+ *
+ * @file z_small_tests.c
+ *
+ * Tests and validate the fixed-size kernels of the small blocks against the
+ * generic kernels.
+ *
+ * @copyright 2015-2023 Bordeaux INP, CNRS (LaBRI UMR 5800), Inria,
+ *                      Univ. Bordeaux. All rights reserved.
+ *
+ * @version 6.3.0
+ * @author Mathieu Faverge
+ * @date 2026-10-17
+ *
+ * @precisions normal z -> c d s
+ *
+ **/
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <string.h>
+#include <assert.h>
+#include <pastix.h>
+#include <common.h>
+#include <cblas.h>
+#include <lapacke.h>
+#include "blend/solver.h"
+#include "kernels/kernels.h"
+#include "kernels/pastix_zcores.h"
+#include "z_tests.h"
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+static pastix_complex64_t mzone = -1.0;
+static pastix_complex64_t zone  =  1.0;
+
+static const char *z_small_names[PastixKernelSmallNbr] = {
+    "geadd", "scalo", "gemdm", "gemm", "trsm"
+};
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+/**
+ * @brief Apply once a kernel on n -by- n blocks, as it is called in the
+ * factorization and the solve. The fixed-size variant is used if the threshold
+ * of the kernel allows it.
+ */
+static void
+z_small_apply( pastix_ksmall_t           kernel,
+               pastix_int_t              n,
+               const pastix_complex64_t *A,
+               const pastix_complex64_t *B,
+               const pastix_complex64_t *D,
+               pastix_complex64_t       *C,
+               pastix_complex64_t       *work )
+{
+    switch( kernel ) {
+    case PastixKernelSmallGEADD:
+        core_zgeadd( PastixNoTrans, n, n, 0.5, A, n, 0.5, C, n );
+        break;
+
+    case PastixKernelSmallSCALO:
+        core_zscalo( PastixNoTrans, n, n, A, n, D, 1, C, n );
+        break;
+
+    case PastixKernelSmallGEMDM:
+        core_zgemdm( PastixNoTrans, PastixTrans, n, n, n,
+                     -1.0, A, n, B, n, 1.0, C, n,
+                     D, 1, work, (n+1) * n );
+        break;
+
+    case PastixKernelSmallGEMM:
+        if ( core_zgemm_small( PastixTrans, PastixNoTrans, n, n, n,
+                               -1.0, A, n, B, n, 1.0, C, n ) != PASTIX_SUCCESS )
+        {
+            cblas_zgemm( CblasColMajor, CblasTrans, CblasNoTrans,
+                         n, n, n,
+                         CBLAS_SADDR(mzone), A, n,
+                                             B, n,
+                         CBLAS_SADDR(zone),  C, n );
+        }
+        break;
+
+    case PastixKernelSmallTRSM:
+    default:
+        if ( core_ztrsm_small( PastixLower, PastixNoTrans, PastixNonUnit,
+                               n, n, A, n, C, n ) != PASTIX_SUCCESS )
+        {
+            cblas_ztrsm( CblasColMajor, CblasLeft, CblasLower,
+                         CblasNoTrans, CblasNonUnit, n, n,
+                         CBLAS_SADDR(zone), A, n,
+                                            C, n );
+        }
+    }
+}
+
+/**
+ * @brief Time nbiter applications of a kernel. The output block is restored
+ * before each application to keep the values bounded.
+ */
+static double
+z_small_time( pastix_ksmall_t           kernel,
+              pastix_int_t              n,
+              int                       nbiter,
+              const pastix_complex64_t *A,
+              const pastix_complex64_t *B,
+              const pastix_complex64_t *D,
+              const pastix_complex64_t *C0,
+              pastix_complex64_t       *C,
+              pastix_complex64_t       *work )
+{
+    double timer;
+    int    i;
+
+    timer = clockGetLocal();
+    for( i=0; i<nbiter; i++ ) {
+        memcpy( C, C0, n * n * sizeof(pastix_complex64_t) );
+        z_small_apply( kernel, n, A, B, D, C, work );
+    }
+    timer = clockGetLocal() - timer;
+
+    return timer;
+}
+
+/**
+ *******************************************************************************
+ *
+ * @brief Compare the fixed-size kernels of the small blocks with the generic
+ * kernels, and time both versions for all the sizes up to
+ * PASTIX_KERNEL_SMALL_MAX.
+ *
+ *******************************************************************************
+ *
+ * @param[in] nbiter
+ *          The number of applications of each kernel to time.
+ *
+ *******************************************************************************
+ *
+ * @return The number of failed tests.
+ *
+ *******************************************************************************/
+int
+z_small_kernels_time( int nbiter )
+{
+    pastix_int_t        thresholds[PastixKernelSmallNbr];
+    pastix_complex64_t *A, *B, *D, *C0, *Cg, *Cf, *work;
+    pastix_int_t        n, i, max = PASTIX_KERNEL_SMALL_MAX;
+    pastix_ksmall_t     kernel;
+    double              eps = LAPACKE_dlamch_work( 'e' );
+    double              normC, normR, tg, tf;
+    int                 rc = 0, failed;
+
+    memcpy( thresholds, pastix_kernel_small[PastixComplex64 - PastixFloat],
+            PastixKernelSmallNbr * sizeof(pastix_int_t) );
+
+    MALLOC_INTERN( A,    max * max,       pastix_complex64_t );
+    MALLOC_INTERN( B,    max * max,       pastix_complex64_t );
+    MALLOC_INTERN( D,    max,             pastix_complex64_t );
+    MALLOC_INTERN( C0,   max * max,       pastix_complex64_t );
+    MALLOC_INTERN( Cg,   max * max,       pastix_complex64_t );
+    MALLOC_INTERN( Cf,   max * max,       pastix_complex64_t );
+    MALLOC_INTERN( work, (max + 1) * max, pastix_complex64_t );
+
+    for( kernel=0; kernel<PastixKernelSmallNbr; kernel++ ) {
+        for( n=1; n<=max; n++ ) {
+            core_zplrnt( n, n, A,  n, n, 0, 0, 3872 );
+            core_zplrnt( n, n, B,  n, n, 0, 0, 4764 );
+            core_zplrnt( n, 1, D,  n, n, 0, 0, 2873 );
+            core_zplrnt( n, n, C0, n, n, 0, 0, 1258 );
+
+            /* Make the triangular matrix well conditioned */
+            for( i=0; i<n; i++ ) {
+                A[n * i + i] += (double)n;
+            }
+
+            /* Generic kernel */
+            kernelsSmallSetThreshold( PastixComplex64, kernel, 0 );
+            memcpy( Cg, C0, n * n * sizeof(pastix_complex64_t) );
+            z_small_apply( kernel, n, A, B, D, Cg, work );
+            tg = z_small_time( kernel, n, nbiter, A, B, D, C0, Cf, work );
+
+            /* Fixed-size kernel */
+            kernelsSmallSetThreshold( PastixComplex64, kernel, max );
+            memcpy( Cf, C0, n * n * sizeof(pastix_complex64_t) );
+            z_small_apply( kernel, n, A, B, D, Cf, work );
+
+            normC = LAPACKE_zlange_work( LAPACK_COL_MAJOR, 'M', n, n, Cg, n, NULL );
+            for( i=0; i<n*n; i++ ) {
+                Cf[i] -= Cg[i];
+            }
+            normR = LAPACKE_zlange_work( LAPACK_COL_MAJOR, 'M', n, n, Cf, n, NULL );
+            if ( normC > 0. ) {
+                normR /= normC;
+            }
+            failed = ( normR > (10. * (double)n * eps) );
+            rc += failed;
+
+            tf = z_small_time( kernel, n, nbiter, A, B, D, C0, Cf, work );
+
+            printf( "    %-5s n=%2ld: ||C_gen - C_fix|| / ||C_gen|| = %e, generic %e s, fixed %e s, speedup %5.2f %s\n",
+                    z_small_names[kernel], (long)n, normR,
+                    tg / (double)nbiter, tf / (double)nbiter,
+                    ( tf > 0. ) ? tg / tf : 0.,
+                    failed ? "FAILED" : "SUCCESS" );
+        }
+    }
+
+    memcpy( pastix_kernel_small[PastixComplex64 - PastixFloat], thresholds,
+            PastixKernelSmallNbr * sizeof(pastix_int_t) );
+
+    memFree_null( A );
+    memFree_null( B );
+    memFree_null( D );
+    memFree_null( C0 );
+    memFree_null( Cg );
+    memFree_null( Cf );
+    memFree_null( work );
+
+    return rc;
+}
@@ -31,6 +31,10 @@ int z_bcsc_norm_check( const spmatrix_t   *spm, const pastix_bcsc_t *bcsc );
 int z_bvec_gemv_check( pastix_data_t *pastix_data, int check, int m, int n );
 int z_bvec_check( pastix_data_t *pastix_data );
 int z_bvec_time( pastix_data_t *pastix_data );
+int z_gemmsp_batch_time( pastix_data_t *pastix_data, int nbiter );
+int z_gemmsp_scatter_time( pastix_data_t *pastix_data, int nbiter );
+int z_gemmsp_lu_time( pastix_data_t *pastix_data, int nbiter );
+int z_small_kernels_time( int nbiter );
 int z_bvec_compare( pastix_data_t            *pastix_data,
                     pastix_int_t              m,
                     pastix_int_t              n,
@@ -83,6 +83,17 @@ A long description in the doxygen format
 }
 dparm.append(dparm_epsilon_magn_ctrl)
 
+dparm_pivot_threshold = {
+    "name" : "dparm_pivot_threshold",
+    "default" : "0.",
+    "brief" : "LU pivoting threshold in diag blocks (0: none)",
+    "access" : "IN",
+    "description" : r'''
+A long description in the doxygen format
+'''
+}
+dparm.append(dparm_pivot_threshold)
+
 dparm_order_time = {
     "name" : "dparm_order_time",
     "default" : "-",
@@ -204,6 +215,28 @@ A long description in the doxygen format
 }
 dparm.append(dparm_fact_energy)
 
+dparm_fact_lockwait = {
+    "name" : "dparm_fact_lockwait",
+    "default" : "-",
+    "brief" : "Time spent waiting on the update locks",
+    "access" : "OUT",
+    "description" : r'''
+A long description in the doxygen format
+'''
+}
+dparm.append(dparm_fact_lockwait)
+
+dparm_fact_rkcache_saved = {
+    "name" : "dparm_fact_rkcache_saved",
+    "default" : "-",
+    "brief" : "Compression time saved by the rank cache",
+    "access" : "OUT",
+    "description" : r'''
+A long description in the doxygen format
+'''
+}
+dparm.append(dparm_fact_rkcache_saved)
+
 dparm_mem_fr = {
     "name" : "dparm_mem_fr",
     "default" : "-",
@@ -226,6 +259,17 @@ A long description in the doxygen format
 }
 dparm.append(dparm_mem_lr)
 
+dparm_mem_lr_peak = {
+    "name" : "dparm_mem_lr_peak",
+    "default" : "-",
+    "brief" : "Peak memory of the low-rank pool (-1 if off)",
+    "access" : "OUT",
+    "description" : r'''
+A long description in the doxygen format
+'''
+}
+dparm.append(dparm_mem_lr_peak)
+
 dparm_solv_time = {
     "name" : "dparm_solv_time",
     "default" : "-",
@@ -452,6 +452,116 @@ scheduler = {
 }
 enums.append(scheduler)
 
+sched_queue = {
+    "name" : "sched_queue",
+    "doc" : {
+        "brief" : "Ready task queue used by the dynamic scheduler",
+    },
+    "values" : [
+        {
+            "name": "PastixSchedQueueHeap",
+            "value": 0,
+            "brief": "Binary heap protected by a lock"
+        },
+        {
+            "name": "PastixSchedQueueWorkStealing",
+            "value": 1,
+            "brief": "Lock-free work-stealing deques with priority buckets"
+        }
+    ]
+}
+enums.append(sched_queue)
+
+sched_steal = {
+    "name" : "sched_steal",
+    "doc" : {
+        "brief" : "Victim selection policy of the dynamic scheduler",
+    },
+    "values" : [
+        {
+            "name": "PastixSchedStealRoundRobin",
+            "value": 0,
+            "brief": "Steal the first available task from the next threads in round-robin order"
+        },
+        {
+            "name": "PastixSchedStealLocality",
+            "value": 1,
+            "brief": "Steal the highest priority task from the same socket first, then from the other sockets"
+        },
+        {
+            "name": "PastixSchedStealLocalityRandom",
+            "value": 2,
+            "brief": "Same as locality, but victims are visited in a random order"
+        }
+    ]
+}
+enums.append(sched_steal)
+
+sched_idle = {
+    "name" : "sched_idle",
+    "doc" : {
+        "brief" : "Behavior of the threads of the dynamic scheduler without task",
+    },
+    "values" : [
+        {
+            "name": "PastixSchedIdleSpin",
+            "value": 0,
+            "brief": "Busy loop on the queues until new tasks are available"
+        },
+        {
+            "name": "PastixSchedIdleBackoff",
+            "value": 1,
+            "brief": "Spin for a short time, then sleep with an exponential backoff"
+        },
+        {
+            "name": "PastixSchedIdlePark",
+            "value": 2,
+            "brief": "Spin, back off, and finally park the thread until new tasks are released"
+        }
+    ]
+}
+enums.append(sched_idle)
+
+sched_prio = {
+    "name" : "sched_prio",
+    "doc" : {
+        "brief" : "Priorities given to the tasks of the dynamic scheduler",
+    },
+    "values" : [
+        {
+            "name": "PastixSchedPrioSimulation",
+            "value": 0,
+            "brief": "Use the order of the static simulation"
+        },
+        {
+            "name": "PastixSchedPrioCriticalPath",
+            "value": 1,
+            "brief": "Use the longest path to the root of the elimination tree, weighted by the kernel models"
+        }
+    ]
+}
+enums.append(sched_prio)
+
+sched_dispatch = {
+    "name" : "sched_dispatch",
+    "doc" : {
+        "brief" : "Dispatch mode of the parallel calls to the internal threads",
+    },
+    "values" : [
+        {
+            "name": "PastixSchedDispatchSleep",
+            "value": 0,
+            "brief": "Threads sleep on a condition variable between parallel calls"
+        },
+        {
+            "name": "PastixSchedDispatchSpin",
+            "value": 1,
+            "brief": "Threads spin between parallel calls for a low-latency fork/join"
+        }
+    ]
+}
+enums.append(sched_dispatch)
+
 ordering = {
     "name" : "ordering",
     "doc" : {
@@ -639,6 +749,10 @@ compress_method = {
             "name": "PastixCompressMethodRQRRT",
             "brief": "Use randomized QR with rotation for low-rank compression"
         },
+        {
+            "name": "PastixCompressMethodARRF",
+            "brief": "Use adaptive randomized range finder for low-rank compression"
+        },
         {
             "name": "PastixCompressMethodNbr",
             "brief": "Total number of available compression methods"
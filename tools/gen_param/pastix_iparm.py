@@ -681,6 +681,16 @@ A long description in the doxygen format
     "enum" : "fact_mode",
 }
 
+iparm_facto_lu_fused = {
+    "name" : "iparm_facto_lu_fused",
+    "default" : "0",
+    "brief" : "Fuse the L and U updates of the LU factorization",
+    "access" : "IN",
+    "description" : r'''
+A long description in the doxygen format
+''',
+}
+
 iparm_factorization_group = {
     "subgroup" : [
         iparm_factorization,
@@ -688,6 +698,7 @@ iparm_factorization_group = {
         iparm_static_pivoting,
         iparm_free_cscuser,
         iparm_schur_fact_mode,
+        iparm_facto_lu_fused,
     ],
     "name" : "factorization",
     "brief" : "Factorization",
@@ -810,6 +821,91 @@ A long description in the doxygen format
     "enum" : "scheduler",
 }
 
+iparm_sched_queue = {
+    "name" : "iparm_sched_queue",
+    "default" : "PastixSchedQueueHeap",
+    "brief" : "Ready task queue of the dynamic scheduler",
+    "access" : "IN",
+    "description" : r'''
+A long description in the doxygen format
+''',
+    "enum" : "sched_queue",
+}
+
+iparm_sched_steal = {
+    "name" : "iparm_sched_steal",
+    "default" : "PastixSchedStealLocality",
+    "brief" : "Victim selection policy of the dynamic scheduler",
+    "access" : "IN",
+    "description" : r'''
+A long description in the doxygen format
+''',
+    "enum" : "sched_steal",
+}
+
+iparm_sched_idle = {
+    "name" : "iparm_sched_idle",
+    "default" : "PastixSchedIdlePark",
+    "brief" : "Behavior of the threads of the dynamic scheduler without task",
+    "access" : "IN",
+    "description" : r'''
+A long description in the doxygen format
+''',
+    "enum" : "sched_idle",
+}
+
+iparm_sched_priority = {
+    "name" : "iparm_sched_priority",
+    "default" : "PastixSchedPrioSimulation",
+    "brief" : "Priorities given to the tasks of the dynamic scheduler",
+    "access" : "IN",
+    "description" : r'''
+A long description in the doxygen format
+''',
+    "enum" : "sched_prio",
+}
+
+iparm_sched_dispatch = {
+    "name" : "iparm_sched_dispatch",
+    "default" : "PastixSchedDispatchSleep",
+    "brief" : "Dispatch mode of the parallel calls to the internal threads",
+    "access" : "IN",
+    "description" : r'''
+A long description in the doxygen format
+''',
+    "enum" : "sched_dispatch",
+}
+
+iparm_sched_team_width = {
+    "name" : "iparm_sched_team_width",
+    "default" : "0",
+    "brief" : "Minimal cblk width shared with idle static threads (0: off)",
+    "access" : "IN",
+    "description" : r'''
+A long description in the doxygen format
+''',
+}
+
+iparm_sched_prefetch = {
+    "name" : "iparm_sched_prefetch",
+    "default" : "0",
+    "brief" : "Prefetch the next task of the dynamic scheduler",
+    "access" : "IN",
+    "description" : r'''
+A long description in the doxygen format
+''',
+}
+
+iparm_sched_lookahead = {
+    "name" : "iparm_sched_lookahead",
+    "default" : "0",
+    "brief" : "Lookahead window of the static scheduler (0 for none)",
+    "access" : "IN",
+    "description" : r'''
+A long description in the doxygen format
+''',
+}
+
 iparm_thread_nbr = {
     "name" : "iparm_thread_nbr",
     "default" : "-1",
@@ -843,6 +939,14 @@ A long description in the doxygen format
 iparm_context_group = {
     "subgroup" : [
         iparm_scheduler,
+        iparm_sched_queue,
+        iparm_sched_steal,
+        iparm_sched_idle,
+        iparm_sched_priority,
+        iparm_sched_dispatch,
+        iparm_sched_lookahead,
+        iparm_sched_team_width,
+        iparm_sched_prefetch,
         iparm_thread_nbr,
         iparm_socket_nbr,
         iparm_autosplit_comm,
@@ -995,6 +1099,46 @@ A long description in the doxygen format
 ''',
 }
 
+iparm_compress_deferred = {
+    "name" : "iparm_compress_deferred",
+    "default" : "0",
+    "brief" : "Enable/Disable deferred accumulation of LR updates",
+    "access" : "IN",
+    "description" : r'''
+A long description in the doxygen format
+''',
+}
+
+iparm_compress_team_bloknbr = {
+    "name" : "iparm_compress_team_bloknbr",
+    "default" : "0",
+    "brief" : "Minimal number of blocks compressed by a team (0: off)",
+    "access" : "IN",
+    "description" : r'''
+A long description in the doxygen format
+''',
+}
+
+iparm_compress_rank_cache = {
+    "name" : "iparm_compress_rank_cache",
+    "default" : "0",
+    "brief" : "Reuse the ranks of the previous factorization",
+    "access" : "IN",
+    "description" : r'''
+A long description in the doxygen format
+''',
+}
+
+iparm_compress_mem_pool = {
+    "name" : "iparm_compress_mem_pool",
+    "default" : "0",
+    "brief" : "Pool the buffers of the low-rank blocks",
+    "access" : "IN",
+    "description" : r'''
+A long description in the doxygen format
+''',
+}
+
 iparm_compression_group = {
     "subgroup" : [
         iparm_compress_min_width,
@@ -1005,6 +1149,10 @@ iparm_compression_group = {
         iparm_compress_reltol,
         iparm_compress_preselect,
         iparm_compress_iluk,
+        iparm_compress_deferred,
+        iparm_compress_team_bloknbr,
+        iparm_compress_rank_cache,
+        iparm_compress_mem_pool,
     ],
     "name" : "compression",
     "brief" : "Compression",
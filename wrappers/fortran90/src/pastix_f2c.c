@@ -168,12 +168,38 @@ pastixInitWithAffinity_f2c( pastix_data_t **pastix_data,
                             dparm, bindtab );
 }
 
+void
+pastixInitWithPool_f2c( pastix_data_t **pastix_data,
+                        int             pastix_comm,
+                        pastix_int_t   *iparm,
+                        double         *dparm,
+                        pastix_pool_t  *pool )
+{
+    pastixInitWithPool( pastix_data, _pastix_comm_f2c( pastix_comm ), iparm,
+                        dparm, pool );
+}
+
 void
 pastixFinalize_f2c( pastix_data_t **pastix_data )
 {
     pastixFinalize( pastix_data );
 }
 
+int
+pastixPoolInit_f2c( pastix_pool_t **pool,
+                    int             cores,
+                    int             partnbr,
+                    const int      *bindtab )
+{
+    return pastixPoolInit( pool, cores, partnbr, bindtab );
+}
+
+int
+pastixPoolFinalize_f2c( pastix_pool_t **pool )
+{
+    return pastixPoolFinalize( pool );
+}
+
 int
 pastix_task_analyze_f2c( pastix_data_t    *pastix_data,
                          const spmatrix_t *spm )
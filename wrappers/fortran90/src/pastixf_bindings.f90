@@ -208,6 +208,18 @@ module pastixf_bindings
        type(c_ptr),         value :: bindtab
      end subroutine pastixInitWithAffinity_f2c
 
+     subroutine pastixInitWithPool_f2c(pastix_data, pastix_comm, iparm, dparm, &
+          pool) &
+          bind(c, name='pastixInitWithPool_f2c')
+       use :: iso_c_binding, only : c_int, c_ptr
+       implicit none
+       type(c_ptr)                :: pastix_data
+       integer(kind=c_int), value :: pastix_comm
+       type(c_ptr),         value :: iparm
+       type(c_ptr),         value :: dparm
+       type(c_ptr),         value :: pool
+     end subroutine pastixInitWithPool_f2c
+
      subroutine pastixFinalize_f2c(pastix_data) &
           bind(c, name='pastixFinalize_f2c')
        use :: iso_c_binding, only : c_ptr
@@ -215,6 +227,25 @@ module pastixf_bindings
        type(c_ptr) :: pastix_data
      end subroutine pastixFinalize_f2c
 
+     function pastixPoolInit_f2c(pool, cores, partnbr, bindtab) &
+          bind(c, name='pastixPoolInit_f2c')
+       use :: iso_c_binding, only : c_int, c_ptr
+       implicit none
+       integer(kind=c_int)        :: pastixPoolInit_f2c
+       type(c_ptr)                :: pool
+       integer(kind=c_int), value :: cores
+       integer(kind=c_int), value :: partnbr
+       type(c_ptr),         value :: bindtab
+     end function pastixPoolInit_f2c
+
+     function pastixPoolFinalize_f2c(pool) &
+          bind(c, name='pastixPoolFinalize_f2c')
+       use :: iso_c_binding, only : c_int, c_ptr
+       implicit none
+       integer(kind=c_int) :: pastixPoolFinalize_f2c
+       type(c_ptr)         :: pool
+     end function pastixPoolFinalize_f2c
+
      function pastix_task_analyze_f2c(pastix_data, spm) &
           bind(c, name='pastix_task_analyze_f2c')
        use :: iso_c_binding, only : c_int, c_ptr
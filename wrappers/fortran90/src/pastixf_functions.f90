@@ -373,6 +373,30 @@ subroutine pastixInitWithAffinity_f08(pastix_data, pastix_comm, iparm, dparm, &
 
 end subroutine pastixInitWithAffinity_f08
 
+subroutine pastixInitWithPool_f08(pastix_data, pastix_comm, iparm, dparm, &
+     pool)
+  use :: pastixf_interfaces, only : pastixInitWithPool
+  use :: pastixf_bindings,   only : pastixInitWithPool_f2c
+  use :: iso_c_binding,      only : c_double, c_f_pointer, c_loc, c_ptr
+  use :: pastixf_enums,      only : pastix_data_t, pastix_int_t, pastix_pool_t
+  use :: spmf_enums,         only : MPI_Comm
+  implicit none
+  type(pastix_data_t),        intent(inout), pointer :: pastix_data
+  type(MPI_Comm),             intent(in)             :: pastix_comm
+  integer(kind=pastix_int_t), intent(inout), target  :: iparm(:)
+  real(kind=c_double),        intent(inout), target  :: dparm(:)
+  type(pastix_pool_t),        intent(inout), target  :: pool
+
+  type(c_ptr) :: x_pastix_data
+
+  x_pastix_data = c_loc(pastix_data)
+
+  call pastixInitWithPool_f2c(x_pastix_data, pastix_comm%MPI_VAL, &
+       c_loc(iparm), c_loc(dparm), c_loc(pool))
+  call c_f_pointer(x_pastix_data, pastix_data)
+
+end subroutine pastixInitWithPool_f08
+
 subroutine pastixFinalize_f08(pastix_data)
   use :: pastixf_interfaces, only : pastixFinalize
   use :: pastixf_bindings,   only : pastixFinalize_f2c
@@ -390,6 +414,49 @@ subroutine pastixFinalize_f08(pastix_data)
 
 end subroutine pastixFinalize_f08
 
+subroutine pastixPoolInit_f08(pool, cores, partnbr, bindtab, info)
+  use :: pastixf_interfaces, only : pastixPoolInit
+  use :: pastixf_bindings,   only : pastixPoolInit_f2c
+  use :: iso_c_binding,      only : c_f_pointer, c_int, c_loc, c_ptr
+  use :: pastixf_enums,      only : pastix_pool_t
+  implicit none
+  type(pastix_pool_t), intent(inout), pointer  :: pool
+  integer(kind=c_int), intent(in)              :: cores
+  integer(kind=c_int), intent(in)              :: partnbr
+  integer(kind=c_int), intent(in),    target   :: bindtab(:)
+  integer(kind=c_int), intent(out),   optional :: info
+
+  type(c_ptr)         :: x_pool
+  integer(kind=c_int) :: x_info
+
+  x_pool = c_loc(pool)
+
+  x_info = pastixPoolInit_f2c(x_pool, cores, partnbr, c_loc(bindtab))
+  call c_f_pointer(x_pool, pool)
+  if ( present(info) ) info = x_info
+
+end subroutine pastixPoolInit_f08
+
+subroutine pastixPoolFinalize_f08(pool, info)
+  use :: pastixf_interfaces, only : pastixPoolFinalize
+  use :: pastixf_bindings,   only : pastixPoolFinalize_f2c
+  use :: iso_c_binding,      only : c_f_pointer, c_int, c_loc, c_ptr
+  use :: pastixf_enums,      only : pastix_pool_t
+  implicit none
+  type(pastix_pool_t), intent(inout), pointer  :: pool
+  integer(kind=c_int), intent(out),   optional :: info
+
+  type(c_ptr)         :: x_pool
+  integer(kind=c_int) :: x_info
+
+  x_pool = c_loc(pool)
+
+  x_info = pastixPoolFinalize_f2c(x_pool)
+  call c_f_pointer(x_pool, pool)
+  if ( present(info) ) info = x_info
+
+end subroutine pastixPoolFinalize_f08
+
 subroutine pastix_task_analyze_f08(pastix_data, spm, info)
   use :: pastixf_interfaces, only : pastix_task_analyze
   use :: pastixf_bindings,   only : pastix_task_analyze_f2c
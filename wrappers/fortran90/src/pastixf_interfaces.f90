@@ -214,6 +214,21 @@ module pastixf_interfaces
      end subroutine pastixInitWithAffinity_f08
   end interface pastixInitWithAffinity
 
+  interface pastixInitWithPool
+     subroutine pastixInitWithPool_f08(pastix_data, pastix_comm, iparm, dparm, &
+          pool)
+       use :: iso_c_binding, only : c_double, c_ptr
+       use :: pastixf_enums, only : pastix_data_t, pastix_int_t, pastix_pool_t
+       use :: spmf_enums,    only : MPI_Comm
+       implicit none
+       type(pastix_data_t),        intent(inout), pointer :: pastix_data
+       type(MPI_Comm),             intent(in)             :: pastix_comm
+       integer(kind=pastix_int_t), intent(inout), target  :: iparm(:)
+       real(kind=c_double),        intent(inout), target  :: dparm(:)
+       type(pastix_pool_t),        intent(inout), target  :: pool
+     end subroutine pastixInitWithPool_f08
+  end interface pastixInitWithPool
+
   interface pastixFinalize
      subroutine pastixFinalize_f08(pastix_data)
        use :: iso_c_binding, only : c_ptr
@@ -223,6 +238,29 @@ module pastixf_interfaces
      end subroutine pastixFinalize_f08
   end interface pastixFinalize
 
+  interface pastixPoolInit
+     subroutine pastixPoolInit_f08(pool, cores, partnbr, bindtab, info)
+       use :: iso_c_binding, only : c_int, c_ptr
+       use :: pastixf_enums, only : pastix_pool_t
+       implicit none
+       type(pastix_pool_t), intent(inout), pointer  :: pool
+       integer(kind=c_int), intent(in)              :: cores
+       integer(kind=c_int), intent(in)              :: partnbr
+       integer(kind=c_int), intent(in),    target   :: bindtab(:)
+       integer(kind=c_int), intent(out),   optional :: info
+     end subroutine pastixPoolInit_f08
+  end interface pastixPoolInit
+
+  interface pastixPoolFinalize
+     subroutine pastixPoolFinalize_f08(pool, info)
+       use :: iso_c_binding, only : c_int, c_ptr
+       use :: pastixf_enums, only : pastix_pool_t
+       implicit none
+       type(pastix_pool_t), intent(inout), pointer  :: pool
+       integer(kind=c_int), intent(out),   optional :: info
+     end subroutine pastixPoolFinalize_f08
+  end interface pastixPoolFinalize
+
   interface pastix_task_analyze
      subroutine pastix_task_analyze_f08(pastix_data, spm, info)
        use :: iso_c_binding, only : c_int
@@ -94,10 +94,22 @@ end
     @cextern pastixInitWithAffinity( pastix_data::Ptr{Cvoid}, pastix_comm::__get_mpi_type__(), iparm::Ptr{Pastix_int_t}, dparm::Ptr{Cdouble}, bindtab::Ptr{Cint} )::Cvoid
 end
 
+@cbindings libpastix begin
+    @cextern pastixInitWithPool( pastix_data::Ptr{Cvoid}, pastix_comm::__get_mpi_type__(), iparm::Ptr{Pastix_int_t}, dparm::Ptr{Cdouble}, pool::Ptr{Pastix_pool_t} )::Cvoid
+end
+
 @cbindings libpastix begin
     @cextern pastixFinalize( pastix_data::Ptr{Cvoid} )::Cvoid
 end
 
+@cbindings libpastix begin
+    @cextern pastixPoolInit( pool::Ptr{Cvoid}, cores::Cint, partnbr::Cint, bindtab::Ptr{Cint} )::Cint
+end
+
+@cbindings libpastix begin
+    @cextern pastixPoolFinalize( pool::Ptr{Cvoid} )::Cint
+end
+
 @cbindings libpastix begin
     @cextern pastix_task_analyze( pastix_data::Ptr{Pastix_data_t}, spm::Ptr{spm.spmatrix_t} )::Cint
 end
@@ -180,10 +180,31 @@ def pypastix_pastixInitWithAffinity( pastix_data, pastix_comm, iparm, dparm,
                                       dparm.ctypes.data_as( POINTER(c_double) ),
                                       bindtab.ctypes.data_as( c_int_p ) )
 
+def pypastix_pastixInitWithPool( pastix_data, pastix_comm, iparm, dparm, pool ):
+    libpastix.pastixInitWithPool.argtypes = [ c_void_p, pypastix_mpi_comm,
+                                              POINTER(__pastix_int__),
+                                              POINTER(c_double), c_void_p ]
+    libpastix.pastixInitWithPool( pointer( pastix_data ),
+                                  pypastix_convert_comm( pastix_comm ),
+                                  iparm.ctypes.data_as( POINTER(__pastix_int__) ),
+                                  dparm.ctypes.data_as( POINTER(c_double) ),
+                                  pool )
+
 def pypastix_pastixFinalize( pastix_data ):
     libpastix.pastixFinalize.argtypes = [ c_void_p ]
     libpastix.pastixFinalize( pointer( pastix_data ) )
 
+def pypastix_pastixPoolInit( pool, cores, partnbr, bindtab ):
+    libpastix.pastixPoolInit.argtypes = [ c_void_p, c_int, c_int, c_int_p ]
+    libpastix.pastixPoolInit.restype = c_int
+    return libpastix.pastixPoolInit( pointer( pool ), cores, partnbr,
+                                     bindtab.ctypes.data_as( c_int_p ) )
+
+def pypastix_pastixPoolFinalize( pool ):
+    libpastix.pastixPoolFinalize.argtypes = [ c_void_p ]
+    libpastix.pastixPoolFinalize.restype = c_int
+    return libpastix.pastixPoolFinalize( pointer( pool ) )
+
 def pypastix_pastix_task_analyze( pastix_data, spm ):
     libpastix.pastix_task_analyze.argtypes = [ c_void_p,
                                                POINTER(pyspm_spmatrix_t) ]